@@ -0,0 +1,64 @@
+#include "StdAfx.h"
+#include "BoundedData.h"
+
+BoundedData::BoundedData(IntPtr data, int count, int stride)
+{
+	Data = data;
+	Count = count;
+	Stride = stride;
+}
+BoundedData::BoundedData(Array^ buffer, int byteOffset, int count, int stride)
+{
+	ThrowIfNull(buffer, "buffer");
+
+	Buffer = buffer;
+	ByteOffset = byteOffset;
+	Count = count;
+	Stride = stride;
+}
+
+PxBoundedData BoundedData::ToUnmanaged(GCHandle% pin, int elementSize)
+{
+	PxBoundedData d;
+
+	if (this->Count == 0)
+		return d;
+
+	if (this->Count < 0)
+		throw gcnew ArgumentOutOfRangeException("Count", "Count cannot be negative");
+	if (this->Stride < elementSize)
+		throw gcnew ArgumentOutOfRangeException("Stride", String::Format("Stride must be at least the element size of {0} bytes", elementSize));
+
+	Byte* data;
+
+	if (this->Buffer != nullptr)
+	{
+		Type^ elementType = this->Buffer->GetType()->GetElementType();
+		if (!elementType->IsValueType)
+			throw gcnew ArgumentException("Buffer must be an array of value types", "Buffer");
+
+		// Everything read must fall inside the array
+		__int64 bufferSize = (__int64)this->Buffer->LongLength * Marshal::SizeOf(elementType);
+		__int64 end = (__int64)this->ByteOffset + (__int64)(this->Count - 1) * this->Stride + elementSize;
+
+		if (this->ByteOffset < 0 || end > bufferSize)
+			throw gcnew ArgumentOutOfRangeException("Count", "The elements extend past the end of Buffer");
+
+		pin = GCHandle::Alloc(this->Buffer, GCHandleType::Pinned);
+
+		data = (Byte*)pin.AddrOfPinnedObject().ToPointer() + this->ByteOffset;
+	}
+	else
+	{
+		if (this->Data == IntPtr::Zero)
+			throw gcnew ArgumentException("Either Buffer or Data must be set", "Data");
+
+		data = (Byte*)this->Data.ToPointer();
+	}
+
+	d.data = data;
+	d.count = this->Count;
+	d.stride = this->Stride;
+
+	return d;
+}
\ No newline at end of file
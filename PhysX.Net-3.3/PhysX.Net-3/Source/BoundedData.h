@@ -0,0 +1,61 @@
+#pragma once
+
+using namespace System::Runtime::InteropServices;
+
+namespace PhysX
+{
+	/// <summary>
+	/// Describes a run of equally spaced elements in either native memory or a managed array, without copying them.
+	/// Maps to PxBoundedData, so interleaved buffers (e.g. a renderer's vertex buffer) can be read in place by
+	/// setting Stride to the size of the whole vertex.
+	/// </summary>
+	public value class BoundedData
+	{
+	public:
+		/// <summary>
+		/// Describes elements in native memory. The memory must stay valid while PhysX reads it.
+		/// </summary>
+		/// <param name="data">A pointer to the first element.</param>
+		/// <param name="count">The number of elements.</param>
+		/// <param name="stride">The number of bytes from the start of one element to the start of the next.</param>
+		BoundedData(IntPtr data, int count, int stride);
+		/// <summary>
+		/// Describes elements in a managed array of value types. The array is pinned only while PhysX reads it.
+		/// </summary>
+		/// <param name="buffer">The array holding the elements.</param>
+		/// <param name="byteOffset">The offset in bytes of the first element from the start of the array.</param>
+		/// <param name="count">The number of elements.</param>
+		/// <param name="stride">The number of bytes from the start of one element to the start of the next.</param>
+		BoundedData(Array^ buffer, int byteOffset, int count, int stride);
+
+	internal:
+		// Pins Buffer (if set) into pin, which the caller must free once PhysX is done with the data
+		PxBoundedData ToUnmanaged(GCHandle% pin, int elementSize);
+
+	public:
+		/// <summary>
+		/// Gets or sets the managed array holding the elements. If set, Data is ignored.
+		/// </summary>
+		property Array^ Buffer;
+
+		/// <summary>
+		/// Gets or sets a pointer to the first element in native memory.
+		/// </summary>
+		property IntPtr Data;
+
+		/// <summary>
+		/// Gets or sets the offset in bytes of the first element from the start of Buffer.
+		/// </summary>
+		property int ByteOffset;
+
+		/// <summary>
+		/// Gets or sets the number of elements.
+		/// </summary>
+		property int Count;
+
+		/// <summary>
+		/// Gets or sets the number of bytes from the start of one element to the start of the next.
+		/// </summary>
+		property int Stride;
+	};
+};
\ No newline at end of file
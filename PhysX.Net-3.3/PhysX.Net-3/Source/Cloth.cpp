@@ -3,6 +3,7 @@
 #include "ClothFabric.h"
 #include "Bounds3.h"
 #include "ClothParticleData.h"
+#include "ClothParticleView.h"
 
 Cloth::Cloth(PxCloth* cloth, PhysX::Physics^ owner)
 	: Actor(cloth, owner)
@@ -30,31 +31,28 @@ void Cloth::SetParticles(array<ClothParticle>^ currentParticles, array<ClothPart
 	if (previousParticles != nullptr && previousParticles->Length != particleCount)
 		throw gcnew ArgumentException(String::Format("Previous particles array must of length {0} to match what particles are in the cloth currently", particleCount));
 
-	PxClothParticle* cp;
-	if (currentParticles == nullptr)
-	{
-		cp = NULL;
-	}
-	else
-	{
-		cp = new PxClothParticle[particleCount];
-		Util::AsUnmanagedArray<ClothParticle>(currentParticles, cp, particleCount);
-	}
+	SetParticles(currentParticles, 0, previousParticles, 0);
+}
+void Cloth::SetParticles(array<ClothParticle>^ currentParticles, int currentOffset, array<ClothParticle>^ previousParticles, int previousOffset)
+{
+	int particleCount = this->UnmanagedPointer->getNbParticles();
 
-	PxClothParticle* pp;
-	if (previousParticles == nullptr)
-	{
-		pp = NULL;
-	}
-	else
-	{
-		pp = new PxClothParticle[particleCount];
-		Util::AsUnmanagedArray<ClothParticle>(previousParticles, pp, particleCount);
-	}
+	CheckParticleRange(currentParticles, currentOffset, particleCount, "currentParticles");
+	CheckParticleRange(previousParticles, previousOffset, particleCount, "previousParticles");
+
+	if (particleCount == 0)
+		return;
+
+	// ClothParticle has the same layout as PxClothParticle, and PhysX copies the particles, so pinning is enough
+	pin_ptr<ClothParticle> cp = nullptr;
+	if (currentParticles != nullptr)
+		cp = &currentParticles[currentOffset];
 
-	this->UnmanagedPointer->setParticles(cp, pp);
+	pin_ptr<ClothParticle> pp = nullptr;
+	if (previousParticles != nullptr)
+		pp = &previousParticles[previousOffset];
 
-	delete[] cp, pp;
+	this->UnmanagedPointer->setParticles((PxClothParticle*)cp, (PxClothParticle*)pp);
 }
 
 array<ClothParticleMotionConstraint>^ Cloth::GetMotionConstraints()
@@ -89,13 +87,23 @@ void Cloth::SetMotionConstraints(array<ClothParticleMotionConstraint>^ motionCon
 		if (motionConstraints->Length != particleCount)
 			throw gcnew ArgumentException(String::Format("Motion constraints array must of length {0} to match what particles are in the cloth currently", particleCount));
 
-		PxClothParticleMotionConstraint* c = new PxClothParticleMotionConstraint[particleCount];
-		Util::AsUnmanagedArray(motionConstraints, c, particleCount);
+		SetMotionConstraints(motionConstraints, 0);
+	}
+}
+void Cloth::SetMotionConstraints(array<ClothParticleMotionConstraint>^ motionConstraints, int offset)
+{
+	ThrowIfNull(motionConstraints, "motionConstraints");
 
-		this->UnmanagedPointer->setMotionConstraints(c);
+	int particleCount = this->UnmanagedPointer->getNbParticles();
 
-		delete[] c;
-	}
+	CheckParticleRange(motionConstraints, offset, particleCount, "motionConstraints");
+
+	if (particleCount == 0)
+		return;
+
+	pin_ptr<ClothParticleMotionConstraint> c = &motionConstraints[offset];
+
+	this->UnmanagedPointer->setMotionConstraints((PxClothParticleMotionConstraint*)c);
 }
 
 array<ClothParticleSeparationConstraint>^ Cloth::GetSeparationConstraints()
@@ -127,13 +135,12 @@ void Cloth::SetSeparationConstraints(array<ClothParticleSeparationConstraint>^ s
 		if (separationConstraints->Length != particleCount)
 			throw gcnew ArgumentException(String::Format("Motion constraints array must of length {0} to match what particles are in the cloth currently", particleCount));
 
-		PxClothParticleSeparationConstraint* c = new PxClothParticleSeparationConstraint[particleCount];
-
-		Util::AsUnmanagedArray(separationConstraints, c, particleCount);
+		if (particleCount == 0)
+			return;
 
-		this->UnmanagedPointer->setSeparationConstraints(c);
+		pin_ptr<ClothParticleSeparationConstraint> c = &separationConstraints[0];
 
-		delete[] c;
+		this->UnmanagedPointer->setSeparationConstraints((PxClothParticleSeparationConstraint*)c);
 	}
 }
 
@@ -167,6 +174,8 @@ array<Vector3>^ Cloth::GetParticleAccelerations3()
 		v3[i].Z = (v + i)->z;
 	}
 
+	delete[] v;
+
 	return v3;
 }
 void Cloth::SetParticleAccelerations(array<Vector4>^ particleAccelerations)
@@ -177,11 +186,24 @@ void Cloth::SetParticleAccelerations(array<Vector4>^ particleAccelerations)
 	}
 	else
 	{
-		pin_ptr<Vector4> a = &particleAccelerations[0];
-
-		this->UnmanagedPointer->setParticleAccelerations((PxVec4*)a);
+		SetParticleAccelerations(particleAccelerations, 0);
 	}
 }
+void Cloth::SetParticleAccelerations(array<Vector4>^ particleAccelerations, int offset)
+{
+	ThrowIfNull(particleAccelerations, "particleAccelerations");
+
+	int particleCount = this->UnmanagedPointer->getNbParticles();
+
+	CheckParticleRange(particleAccelerations, offset, particleCount, "particleAccelerations");
+
+	if (particleCount == 0)
+		return;
+
+	pin_ptr<Vector4> a = &particleAccelerations[offset];
+
+	this->UnmanagedPointer->setParticleAccelerations((PxVec4*)a);
+}
 void Cloth::SetParticleAccelerations(array<Vector3>^ particleAccelerations)
 {
 	if (particleAccelerations == nullptr)
@@ -195,18 +217,16 @@ void Cloth::SetParticleAccelerations(array<Vector3>^ particleAccelerations)
 		if (particleAccelerations->Length != particleCount)
 			throw gcnew ArgumentException(String::Format("Particle accelerations array must of length {0} to match what particles are in the cloth currently", particleCount));
 
-		pin_ptr<Vector3> a = &particleAccelerations[0];
-		PxVec3* apin = new PxVec3[particleCount];
-
-		PxVec4* a4 = new PxVec4[particleCount];
+		// PhysX takes 4 component accelerations, widen them into a buffer kept for the next call
+		if (_particleAccelerations4 == nullptr || _particleAccelerations4->Length != particleCount)
+			_particleAccelerations4 = gcnew array<Vector4>(particleCount);
 
 		for (int i = 0; i < particleCount; i++)
 		{
-			PxVec3* q = apin + i;
-			*(a4 + i) = PxVec4(q->x, q->y, q->z, 0);
+			_particleAccelerations4[i] = Vector4(particleAccelerations[i], 0);
 		}
 
-		this->UnmanagedPointer->setParticleAccelerations(a4);
+		SetParticleAccelerations(_particleAccelerations4, 0);
 	}
 }
 
@@ -214,16 +234,25 @@ void Cloth::SetCollisionSpheres(array<ClothCollisionSphere>^ spheres)
 {
 	ThrowIfNull(spheres, "spheres");
 
-	if (spheres->Length == 0)
+	SetCollisionSpheres(spheres, 0, spheres->Length);
+}
+void Cloth::SetCollisionSpheres(array<ClothCollisionSphere>^ spheres, int offset, int count)
+{
+	ThrowIfNull(spheres, "spheres");
+
+	if (offset < 0 || count < 0 || offset + count > spheres->Length)
+		throw gcnew ArgumentOutOfRangeException("count", "The range of spheres must be within the array");
+
+	if (count == 0)
 	{
 		this->UnmanagedPointer->setCollisionSpheres(NULL, 0);
 	}
 	else
 	{
-		pin_ptr<ClothCollisionSphere> pin = &spheres[0];
+		pin_ptr<ClothCollisionSphere> pin = &spheres[offset];
 		PxClothCollisionSphere* first = (PxClothCollisionSphere*)pin;
 
-		this->UnmanagedPointer->setCollisionSpheres(first, spheres->Length);
+		this->UnmanagedPointer->setCollisionSpheres(first, count);
 	}
 }
 
@@ -268,12 +297,22 @@ void Cloth::SetVirtualParticles(array<int>^ triangleVertexAndWeightIndices, arra
 	ThrowIfNull(triangleVertexAndWeightIndices, "triangleVertexAndWeightIndices");
 	ThrowIfNull(triangleVertexWeightTable, "triangleVertexWeightTable");
 
+	if (triangleVertexAndWeightIndices->Length % 4 != 0)
+		throw gcnew ArgumentException("There must be four indices per virtual particle", "triangleVertexAndWeightIndices");
+
+	if (triangleVertexAndWeightIndices->Length == 0)
+	{
+		this->UnmanagedPointer->setVirtualParticles(0, NULL, 0, NULL);
+		return;
+	}
+
 	pin_ptr<int> i = &triangleVertexAndWeightIndices[0];
 	pin_ptr<Vector3> t = &triangleVertexWeightTable[0];
 
+	// PhysX takes the number of virtual particles, not the number of indices
 	this->UnmanagedPointer->setVirtualParticles
 	(
-		triangleVertexAndWeightIndices->Length,
+		triangleVertexAndWeightIndices->Length / 4,
 		(PxU32*)i,
 		triangleVertexWeightTable->Length,
 		(PxVec3*)t
@@ -287,7 +326,8 @@ array<int>^ Cloth::GetVirtualParticles()
 	if (n == 0)
 		return gcnew array<int>(0);
 	
-	auto vp = gcnew array<int>(n);
+	// Four indices per virtual particle
+	auto vp = gcnew array<int>(n * 4);
 
 	pin_ptr<int> vp_pin = &vp[0];
 	this->UnmanagedPointer->getVirtualParticles((PxU32*)vp_pin);
@@ -310,6 +350,92 @@ array<Vector3>^ Cloth::GetVirtualParticleWeights()
 	return vpw;
 }
 
+void Cloth::ApplyFrameUpdates(array<ClothFrameUpdate>^ updates, int count)
+{
+	ThrowIfNull(updates, "updates");
+	if (count < 0 || count > updates->Length)
+		throw gcnew ArgumentOutOfRangeException("count");
+
+	// Consecutive cloths usually share the same buffers, so only pin again when a buffer changes
+	array<ClothParticleMotionConstraint>^ motionConstraints = nullptr;
+	array<ClothCollisionSphere>^ collisionSpheres = nullptr;
+	array<Vector4>^ particleAccelerations = nullptr;
+
+	pin_ptr<ClothParticleMotionConstraint> mc = nullptr;
+	pin_ptr<ClothCollisionSphere> cs = nullptr;
+	pin_ptr<Vector4> pa = nullptr;
+
+	for (int i = 0; i < count; i++)
+	{
+		ClothFrameUpdate% u = updates[i];
+
+		ThrowIfNullOrDisposed(u.Cloth, "updates");
+
+		PxCloth* cloth = u.Cloth->UnmanagedPointer;
+		int particleCount = cloth->getNbParticles();
+
+		if (u.TargetPose.HasValue)
+			cloth->setTargetPose(MathUtil::MatrixToPxTransform(u.TargetPose.Value));
+
+		if (u.MotionConstraints != nullptr && particleCount > 0)
+		{
+			CheckParticleRange(u.MotionConstraints, u.MotionConstraintsOffset, particleCount, "updates");
+
+			if (u.MotionConstraints != motionConstraints)
+			{
+				motionConstraints = u.MotionConstraints;
+				mc = &motionConstraints[0];
+			}
+
+			cloth->setMotionConstraints((PxClothParticleMotionConstraint*)(mc + u.MotionConstraintsOffset));
+		}
+
+		if (u.CollisionSpheres != nullptr)
+		{
+			if (u.CollisionSpheresOffset < 0 || u.CollisionSphereCount < 0 || u.CollisionSpheresOffset + u.CollisionSphereCount > u.CollisionSpheres->Length)
+				throw gcnew ArgumentOutOfRangeException("updates", "The range of collision spheres must be within the array");
+
+			if (u.CollisionSphereCount == 0)
+			{
+				cloth->setCollisionSpheres(NULL, 0);
+			}
+			else
+			{
+				if (u.CollisionSpheres != collisionSpheres)
+				{
+					collisionSpheres = u.CollisionSpheres;
+					cs = &collisionSpheres[0];
+				}
+
+				cloth->setCollisionSpheres((PxClothCollisionSphere*)(cs + u.CollisionSpheresOffset), u.CollisionSphereCount);
+			}
+		}
+
+		if (u.ParticleAccelerations != nullptr && particleCount > 0)
+		{
+			CheckParticleRange(u.ParticleAccelerations, u.ParticleAccelerationsOffset, particleCount, "updates");
+
+			if (u.ParticleAccelerations != particleAccelerations)
+			{
+				particleAccelerations = u.ParticleAccelerations;
+				pa = &particleAccelerations[0];
+			}
+
+			cloth->setParticleAccelerations((PxVec4*)(pa + u.ParticleAccelerationsOffset));
+		}
+	}
+}
+
+generic<typename T>
+void Cloth::CheckParticleRange(array<T>^ values, int offset, int particleCount, String^ paramName)
+{
+	if (values == nullptr)
+		return;
+
+	if (offset < 0 || offset + particleCount > values->Length)
+		throw gcnew ArgumentOutOfRangeException(paramName, String::Format("There must be {0} elements, one per particle, from the offset onwards", particleCount));
+}
+
 void Cloth::SetTargetPose(Matrix pose)
 {
 	this->UnmanagedPointer->setTargetPose(MathUtil::MatrixToPxTransform(pose));
@@ -339,6 +465,18 @@ ClothParticleData^ Cloth::LockParticleData(DataAccessFlag flag)
 
 	return d;
 }
+ClothParticleView^ Cloth::LockParticleView([Optional] DataAccessFlag flag)
+{
+	if (flag == (DataAccessFlag)0)
+		flag = DataAccessFlag::Readable;
+
+	PxClothParticleData* data = this->UnmanagedPointer->lockParticleData(ToUnmanagedEnum(PxDataAccessFlag, flag));
+
+	if (data == NULL)
+		throw gcnew OperationFailedException("Failed to lock the cloth particle data");
+
+	return gcnew ClothParticleView(data, this->UnmanagedPointer->getNbParticles());
+}
 
 void Cloth::SetInertiaScale(float scale)
 {
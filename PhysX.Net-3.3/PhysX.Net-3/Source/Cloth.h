@@ -11,16 +11,19 @@
 #include "ClothCollisionPlane.h"
 #include "Bounds3.h"
 #include "PhysicsEnum.h"
+#include "ClothFrameUpdate.h"
 
 namespace PhysX
 {
 	ref class ClothFabric;
 	ref class ClothParticleData;
+	ref class ClothParticleView;
 
 	public ref class Cloth : Actor
 	{
 	private:
 		PhysX::ClothFabric^ _fabric;
+		array<Vector4>^ _particleAccelerations4;
 
 	public:
 		Cloth(PxCloth* cloth, PhysX::Physics^ owner);
@@ -37,6 +40,15 @@ namespace PhysX
 		/// <param name="currentParticles">The particle data for the current particle state or null if the state should not be changed.</param>
 		/// <param name="previousParticles">The particle data for the previous particle state or null if the state should not be changed.</param>
 		void SetParticles(array<ClothParticle>^ currentParticles, array<ClothParticle>^ previousParticles);
+		/// <summary>
+		/// Updates cloth particles from ranges of larger arrays, without copying them into intermediate buffers.
+		/// Each non-null array must hold NumberOfParticles particles from its offset onwards.
+		/// </summary>
+		/// <param name="currentParticles">The particle data for the current particle state or null if the state should not be changed.</param>
+		/// <param name="currentOffset">The index of the first current particle.</param>
+		/// <param name="previousParticles">The particle data for the previous particle state or null if the state should not be changed.</param>
+		/// <param name="previousOffset">The index of the first previous particle.</param>
+		void SetParticles(array<ClothParticle>^ currentParticles, int currentOffset, array<ClothParticle>^ previousParticles, int previousOffset);
 
 		/// <summary>
 		/// Copies motion constraints to the user provided buffer.
@@ -48,6 +60,11 @@ namespace PhysX
 		/// </summary>
 		/// <param name="motionConstraints">Motion constraints at the end of the next Simulate() call.</param>
 		void SetMotionConstraints(array<ClothParticleMotionConstraint>^ motionConstraints);
+		/// <summary>
+		/// Updates motion constraints from a range of a larger array, such as a buffer shared by many cloths.
+		/// The array must hold NumberOfParticles constraints from the offset onwards.
+		/// </summary>
+		void SetMotionConstraints(array<ClothParticleMotionConstraint>^ motionConstraints, int offset);
 
 		/// <summary>
 		/// 
@@ -68,11 +85,20 @@ namespace PhysX
 		array<Vector3>^ GetParticleAccelerations3();
 		void SetParticleAccelerations(array<Vector4>^ particleAccelerations);
 		void SetParticleAccelerations(array<Vector3>^ particleAccelerations);
+		/// <summary>
+		/// Updates particle accelerations from a range of a larger array.
+		/// The array must hold NumberOfParticles accelerations from the offset onwards.
+		/// </summary>
+		void SetParticleAccelerations(array<Vector4>^ particleAccelerations, int offset);
 
 		/// <summary>
 		/// Updates location and radii of collision spheres.
 		/// </summary>
 		void SetCollisionSpheres(array<ClothCollisionSphere>^ spheres);
+		/// <summary>
+		/// Updates location and radii of collision spheres from a range of a larger array.
+		/// </summary>
+		void SetCollisionSpheres(array<ClothCollisionSphere>^ spheres, int offset, int count);
 
 		/// <summary>
 		/// Adds a collision plane.
@@ -141,6 +167,13 @@ namespace PhysX
 
 		void PutToSleep();
 
+		/// <summary>
+		/// Applies the animation inputs of many cloths for a frame in a single call, pinning the shared buffers once.
+		/// </summary>
+		/// <param name="updates">The updates to apply.</param>
+		/// <param name="count">The number of updates to apply from the start of the array, so the array can be reused across frames.</param>
+		static void ApplyFrameUpdates(array<ClothFrameUpdate>^ updates, int count);
+
 		/// <summary>
 		/// Locks the cloth solver so that external applications can safely read back particle data.
 		/// </summary>
@@ -150,6 +183,13 @@ namespace PhysX
 		/// </summary>
 		ClothParticleData^ LockParticleData(DataAccessFlag flag);
 
+		/// <summary>
+		/// Locks the cloth solver and returns a view that reads the particle data in place, without copying it.
+		/// Dispose the view to unlock the data.
+		/// </summary>
+		/// <param name="flag">The access required. If not specified, DataAccessFlag.Readable is used.</param>
+		ClothParticleView^ LockParticleView([Optional] DataAccessFlag flag);
+
 		void SetInertiaScale(float scale);
 
 		//
@@ -404,6 +444,10 @@ namespace PhysX
 			void set(Vector3 value);
 		}
 
+	private:
+		generic<typename T>
+		static void CheckParticleRange(array<T>^ values, int offset, int particleCount, String^ paramName);
+
 	internal:
 		property PxCloth* UnmanagedPointer
 		{
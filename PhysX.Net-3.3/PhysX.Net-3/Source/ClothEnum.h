@@ -29,4 +29,30 @@ namespace PhysX
 		/// </summary>
 		SceneCollision = PxClothFlag::eSCENE_COLLISION
 	};
+
+	/// <summary>
+	/// The level of detail a ClothLodManager simulates a cloth at.
+	/// </summary>
+	public enum class ClothLod
+	{
+		/// <summary>
+		/// Full solver frequency, inertia scales and virtual particles.
+		/// </summary>
+		Full = 0,
+
+		/// <summary>
+		/// Reduced solver frequency and no virtual particles.
+		/// </summary>
+		Reduced = 1,
+
+		/// <summary>
+		/// Minimum solver frequency, reduced inertia scales and no virtual particles.
+		/// </summary>
+		Minimal = 2,
+
+		/// <summary>
+		/// The cloth is put to sleep.
+		/// </summary>
+		Asleep = 3
+	};
 };
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "ClothParticleMotionConstraint.h"
+#include "ClothCollisionSphere.h"
+
+namespace PhysX
+{
+	ref class Cloth;
+
+	/// <summary>
+	/// The per frame animation inputs of a cloth, applied with Cloth.ApplyFrameUpdates.
+	/// Arrays which are null are left unchanged on the cloth. The arrays can be ranges of buffers shared by many cloths.
+	/// </summary>
+	public value class ClothFrameUpdate
+	{
+	public:
+		/// <summary>
+		/// Gets or sets the cloth to update.
+		/// </summary>
+		property PhysX::Cloth^ Cloth;
+
+		/// <summary>
+		/// Gets or sets the target pose at the end of the next simulate call, or null to leave the pose unchanged.
+		/// </summary>
+		property Nullable<Matrix> TargetPose;
+
+		/// <summary>
+		/// Gets or sets the buffer holding the motion constraints, one per particle from MotionConstraintsOffset onwards.
+		/// </summary>
+		property array<ClothParticleMotionConstraint>^ MotionConstraints;
+		/// <summary>
+		/// Gets or sets the index of the cloth's first motion constraint in MotionConstraints.
+		/// </summary>
+		property int MotionConstraintsOffset;
+
+		/// <summary>
+		/// Gets or sets the buffer holding the collision spheres.
+		/// </summary>
+		property array<ClothCollisionSphere>^ CollisionSpheres;
+		/// <summary>
+		/// Gets or sets the index of the cloth's first collision sphere in CollisionSpheres.
+		/// </summary>
+		property int CollisionSpheresOffset;
+		/// <summary>
+		/// Gets or sets the number of collision spheres of the cloth.
+		/// </summary>
+		property int CollisionSphereCount;
+
+		/// <summary>
+		/// Gets or sets the buffer holding the particle accelerations, one per particle from ParticleAccelerationsOffset onwards.
+		/// </summary>
+		property array<Vector4>^ ParticleAccelerations;
+		/// <summary>
+		/// Gets or sets the index of the cloth's first particle acceleration in ParticleAccelerations.
+		/// </summary>
+		property int ParticleAccelerationsOffset;
+	};
+};
\ No newline at end of file
@@ -0,0 +1,307 @@
+#include "StdAfx.h"
+#include "ClothLodManager.h"
+#include "Cloth.h"
+
+namespace PhysX
+{
+	// The full detail settings and current state of a managed cloth
+	private ref class ClothLodEntry
+	{
+	public:
+		PhysX::Cloth^ Cloth;
+		int ParticleCount;
+		float FullSolverFrequency;
+		Vector3 LinearInertiaScale;
+		Vector3 AngularInertiaScale;
+		Vector3 CentrifugalInertiaScale;
+		array<int>^ VirtualParticles;
+		array<Vector3>^ VirtualParticleWeights;
+
+		ClothLod Level;
+		ClothLod AppliedLevel;
+		bool Visible;
+		float Distance;
+	};
+};
+
+ClothLodManager::ClothLodManager()
+{
+	_entries = gcnew List<ClothLodEntry^>();
+	_byDistance = gcnew List<ClothLodEntry^>();
+
+	FullDetailDistance = 10;
+	ReducedDetailDistance = 30;
+	SleepDistance = 60;
+	ReducedSolverFrequencyScale = 0.5f;
+	MinimalSolverFrequency = 30;
+	MinimalInertiaScale = 0.5f;
+	BudgetMilliseconds = 0;
+}
+
+void ClothLodManager::Add(Cloth^ cloth)
+{
+	ThrowIfNullOrDisposed(cloth, "cloth");
+
+	if (Find(cloth) != nullptr)
+		throw gcnew ArgumentException("The cloth is already managed", "cloth");
+
+	auto entry = gcnew ClothLodEntry();
+		entry->Cloth = cloth;
+		entry->ParticleCount = cloth->NumberOfParticles;
+		entry->FullSolverFrequency = cloth->SolverFrequency;
+		entry->LinearInertiaScale = cloth->LinearInertiaScale;
+		entry->AngularInertiaScale = cloth->AngularInertiaScale;
+		entry->CentrifugalInertiaScale = cloth->CentrifugalInertiaScale;
+		entry->VirtualParticles = cloth->GetVirtualParticles();
+		entry->VirtualParticleWeights = cloth->GetVirtualParticleWeights();
+		entry->Level = ClothLod::Full;
+		entry->AppliedLevel = ClothLod::Full;
+		entry->Visible = true;
+		entry->Distance = 0;
+
+	_entries->Add(entry);
+}
+bool ClothLodManager::Remove(Cloth^ cloth)
+{
+	ClothLodEntry^ entry = Find(cloth);
+
+	if (entry == nullptr)
+		return false;
+
+	_entries->Remove(entry);
+
+	if (!cloth->Disposed)
+	{
+		Apply(entry, ClothLod::Full);
+
+		if (cloth->UnmanagedPointer->isSleeping())
+			cloth->UnmanagedPointer->wakeUp();
+	}
+
+	return true;
+}
+
+void ClothLodManager::SetVisible(Cloth^ cloth, bool visible)
+{
+	GetEntry(cloth)->Visible = visible;
+}
+
+void ClothLodManager::Update(array<Vector3>^ viewerPositions)
+{
+	ThrowIfNull(viewerPositions, "viewerPositions");
+
+	// Forget cloths that have been disposed of
+	for (int i = _entries->Count - 1; i >= 0; i--)
+	{
+		if (_entries[i]->Cloth->Disposed)
+			_entries->RemoveAt(i);
+	}
+
+	// Choose the level from the distance to the nearest viewer
+	double totalWork = 0;
+
+	_byDistance->Clear();
+
+	for each (ClothLodEntry^ entry in _entries)
+	{
+		Vector3 center = entry->Cloth->WorldBounds.Center;
+
+		float distance = Single::MaxValue;
+		for each (Vector3 viewer in viewerPositions)
+		{
+			distance = Math::Min(distance, Vector3::Distance(center, viewer));
+		}
+
+		entry->Distance = distance;
+
+		ClothLod level;
+		if (!entry->Visible || distance > SleepDistance)
+			level = ClothLod::Asleep;
+		else if (distance > ReducedDetailDistance)
+			level = ClothLod::Minimal;
+		else if (distance > FullDetailDistance)
+			level = ClothLod::Reduced;
+		else
+			level = ClothLod::Full;
+
+		entry->Level = level;
+		totalWork += GetWork(entry, level);
+
+		_byDistance->Add(entry);
+	}
+
+	// Over budget, lower the furthest awake cloths a level at a time until the estimate fits
+	if (BudgetMilliseconds > 0 && _costPerUnitOfWork > 0 && totalWork * _costPerUnitOfWork > BudgetMilliseconds)
+	{
+		_byDistance->Sort(gcnew Comparison<ClothLodEntry^>(&ClothLodManager::CompareByDistanceDescending));
+
+		bool lowered = true;
+		while (lowered && totalWork * _costPerUnitOfWork > BudgetMilliseconds)
+		{
+			lowered = false;
+
+			for each (ClothLodEntry^ entry in _byDistance)
+			{
+				if (entry->Level == ClothLod::Asleep)
+					continue;
+
+				ClothLod level = (ClothLod)((int)entry->Level + 1);
+
+				totalWork += GetWork(entry, level) - GetWork(entry, entry->Level);
+				entry->Level = level;
+				lowered = true;
+
+				if (totalWork * _costPerUnitOfWork <= BudgetMilliseconds)
+					break;
+			}
+		}
+	}
+
+	for each (ClothLodEntry^ entry in _entries)
+	{
+		Apply(entry, entry->Level);
+	}
+
+	_lastWork = totalWork;
+}
+
+void ClothLodManager::ReportStepTime(TimeSpan clothStepTime)
+{
+	if (_lastWork <= 0)
+		return;
+
+	double sample = clothStepTime.TotalMilliseconds / _lastWork;
+
+	// Smooth out frame to frame noise
+	_costPerUnitOfWork = (_costPerUnitOfWork == 0 ? sample : _costPerUnitOfWork * 0.9 + sample * 0.1);
+}
+
+ClothLod ClothLodManager::GetLevel(Cloth^ cloth)
+{
+	return GetEntry(cloth)->Level;
+}
+double ClothLodManager::GetEstimatedCost(Cloth^ cloth)
+{
+	ClothLodEntry^ entry = GetEntry(cloth);
+
+	return GetWork(entry, entry->Level) * _costPerUnitOfWork;
+}
+
+ClothLodEntry^ ClothLodManager::Find(Cloth^ cloth)
+{
+	ThrowIfNull(cloth, "cloth");
+
+	for each (ClothLodEntry^ entry in _entries)
+	{
+		if (entry->Cloth == cloth)
+			return entry;
+	}
+
+	return nullptr;
+}
+ClothLodEntry^ ClothLodManager::GetEntry(Cloth^ cloth)
+{
+	ClothLodEntry^ entry = Find(cloth);
+
+	if (entry == nullptr)
+		throw gcnew ArgumentException("The cloth is not managed by this level of detail manager", "cloth");
+
+	return entry;
+}
+
+double ClothLodManager::GetWork(ClothLodEntry^ entry, ClothLod level)
+{
+	if (level == ClothLod::Asleep)
+		return 0;
+
+	// Solver iterations per 60 Hz frame, times the particles (real and, at full detail, virtual) processed by each
+	double particles = entry->ParticleCount;
+	if (level == ClothLod::Full)
+		particles += entry->VirtualParticles->Length / 4;
+
+	return particles * GetSolverFrequency(entry, level) / 60.0;
+}
+
+float ClothLodManager::GetSolverFrequency(ClothLodEntry^ entry, ClothLod level)
+{
+	switch (level)
+	{
+		case ClothLod::Reduced:
+			return entry->FullSolverFrequency * ReducedSolverFrequencyScale;
+		case ClothLod::Minimal:
+			return Math::Min(entry->FullSolverFrequency, MinimalSolverFrequency);
+		default:
+			return entry->FullSolverFrequency;
+	}
+}
+
+void ClothLodManager::Apply(ClothLodEntry^ entry, ClothLod level)
+{
+	Cloth^ cloth = entry->Cloth;
+	PxCloth* c = cloth->UnmanagedPointer;
+
+	bool wasAsleep = (entry->AppliedLevel == ClothLod::Asleep);
+	entry->AppliedLevel = level;
+
+	if (level == ClothLod::Asleep)
+	{
+		if (!c->isSleeping())
+			c->putToSleep();
+
+		return;
+	}
+
+	// Only wake the cloth when leaving the asleep level or changing its settings, so cloths that PhysX put to sleep
+	// stay asleep while their level doesn't change
+	bool changed = false;
+
+	float frequency = GetSolverFrequency(entry, level);
+	if (c->getSolverFrequency() != frequency)
+	{
+		c->setSolverFrequency(frequency);
+		changed = true;
+	}
+
+	float inertia = (level == ClothLod::Minimal ? MinimalInertiaScale : 1.0f);
+
+	PxVec3 linear = UV(entry->LinearInertiaScale * inertia);
+	if (c->getLinearInertiaScale() != linear)
+	{
+		c->setLinearInertiaScale(linear);
+		c->setAngularInertiaScale(UV(entry->AngularInertiaScale * inertia));
+		c->setCentrifugalInertiaScale(UV(entry->CentrifugalInertiaScale * inertia));
+		changed = true;
+	}
+
+	// Virtual particles are only dropped and restored when crossing the full detail boundary
+	bool virtualParticles = (level == ClothLod::Full && entry->VirtualParticles->Length > 0);
+	if (virtualParticles != (c->getNbVirtualParticles() > 0))
+	{
+		if (virtualParticles)
+			cloth->SetVirtualParticles(entry->VirtualParticles, entry->VirtualParticleWeights);
+		else
+			c->setVirtualParticles(0, NULL, 0, NULL);
+
+		changed = true;
+	}
+
+	if ((wasAsleep || changed) && c->isSleeping())
+		c->wakeUp();
+}
+
+int ClothLodManager::CompareByDistanceDescending(ClothLodEntry^ a, ClothLodEntry^ b)
+{
+	return b->Distance.CompareTo(a->Distance);
+}
+
+//
+
+double ClothLodManager::EstimatedCost::get()
+{
+	return _lastWork * _costPerUnitOfWork;
+}
+
+int ClothLodManager::Count::get()
+{
+	return _entries->Count;
+}
\ No newline at end of file
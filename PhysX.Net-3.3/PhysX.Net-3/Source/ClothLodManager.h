@@ -0,0 +1,127 @@
+#pragma once
+
+#include "ClothEnum.h"
+
+namespace PhysX
+{
+	ref class Cloth;
+	ref class ClothLodEntry;
+
+	/// <summary>
+	/// Adjusts the solver frequency, inertia scales and virtual particle usage of a set of cloths based on their
+	/// distance to the nearest viewer and their visibility, and puts far or invisible cloths to sleep.
+	/// When a step budget is set, the cost of each cloth is estimated from its particle count and solver frequency,
+	/// calibrated by the measured step times passed to ReportStepTime, and the furthest cloths are lowered further until
+	/// the estimate fits the budget.
+	/// </summary>
+	/// <remarks>
+	/// The settings a cloth has when it's added are its full detail settings, and are restored when it's removed.
+	/// PhysX doesn't time cloths individually, so per cloth costs are estimates.
+	/// </remarks>
+	public ref class ClothLodManager
+	{
+	private:
+		List<ClothLodEntry^>^ _entries;
+		List<ClothLodEntry^>^ _byDistance;
+		double _costPerUnitOfWork;
+		double _lastWork;
+
+	public:
+		ClothLodManager();
+
+		/// <summary>
+		/// Starts managing the level of detail of a cloth.
+		/// </summary>
+		void Add(Cloth^ cloth);
+		/// <summary>
+		/// Stops managing a cloth, restoring its full detail settings and waking it up.
+		/// </summary>
+		bool Remove(Cloth^ cloth);
+
+		/// <summary>
+		/// Sets whether a cloth is visible. Invisible cloths are put to sleep.
+		/// </summary>
+		void SetVisible(Cloth^ cloth, bool visible);
+
+		/// <summary>
+		/// Chooses and applies the level of detail of every cloth. Call once per frame before simulating.
+		/// </summary>
+		/// <param name="viewerPositions">The positions of the cameras or players the detail is relative to.</param>
+		void Update(array<Vector3>^ viewerPositions);
+
+		/// <summary>
+		/// Reports how long the cloth simulation of the last step took, to calibrate the cost estimates.
+		/// </summary>
+		void ReportStepTime(TimeSpan clothStepTime);
+
+		/// <summary>
+		/// Gets the level of detail a cloth was last set to.
+		/// </summary>
+		ClothLod GetLevel(Cloth^ cloth);
+		/// <summary>
+		/// Gets the estimated cost of a cloth in milliseconds at its current level of detail.
+		/// Zero until a step time has been reported.
+		/// </summary>
+		double GetEstimatedCost(Cloth^ cloth);
+
+		/// <summary>
+		/// Gets or sets the distance up to which cloths are simulated at full detail.
+		/// </summary>
+		property float FullDetailDistance;
+
+		/// <summary>
+		/// Gets or sets the distance up to which cloths are simulated at reduced detail.
+		/// </summary>
+		property float ReducedDetailDistance;
+
+		/// <summary>
+		/// Gets or sets the distance beyond which cloths are put to sleep.
+		/// </summary>
+		property float SleepDistance;
+
+		/// <summary>
+		/// Gets or sets the fraction of the full solver frequency used at reduced detail.
+		/// </summary>
+		property float ReducedSolverFrequencyScale;
+
+		/// <summary>
+		/// Gets or sets the solver frequency used at minimal detail.
+		/// </summary>
+		property float MinimalSolverFrequency;
+
+		/// <summary>
+		/// Gets or sets the fraction of the full inertia scales used at minimal detail.
+		/// </summary>
+		property float MinimalInertiaScale;
+
+		/// <summary>
+		/// Gets or sets the budget for the cloth simulation of a step in milliseconds, or zero for no budget.
+		/// </summary>
+		property double BudgetMilliseconds;
+
+		/// <summary>
+		/// Gets the estimated cost of all the cloths in milliseconds after the last update.
+		/// Zero until a step time has been reported.
+		/// </summary>
+		property double EstimatedCost
+		{
+			double get();
+		}
+
+		/// <summary>
+		/// Gets the number of cloths being managed.
+		/// </summary>
+		property int Count
+		{
+			int get();
+		}
+
+	private:
+		ClothLodEntry^ Find(Cloth^ cloth);
+		ClothLodEntry^ GetEntry(Cloth^ cloth);
+		double GetWork(ClothLodEntry^ entry, ClothLod level);
+		float GetSolverFrequency(ClothLodEntry^ entry, ClothLod level);
+		void Apply(ClothLodEntry^ entry, ClothLod level);
+		static int CompareByDistanceDescending(ClothLodEntry^ a, ClothLodEntry^ b);
+	};
+};
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "StdAfx.h"
+#include "ClothParticleReadback.h"
+#include "ClothParticleView.h"
+#include "Cloth.h"
+
+using namespace System::Threading;
+
+ClothParticleReadback::ClothParticleReadback(PhysX::Cloth^ cloth)
+{
+	ThrowIfNullOrDisposed(cloth, "cloth");
+
+	_cloth = cloth;
+
+	int n = cloth->NumberOfParticles;
+
+	_front = gcnew array<Vector3>(n);
+	_back = gcnew array<Vector3>(n);
+	_captureCount = 0;
+
+	ObjectTable::AddObjectOwner(this, cloth);
+}
+ClothParticleReadback::~ClothParticleReadback()
+{
+	this->!ClothParticleReadback();
+}
+ClothParticleReadback::!ClothParticleReadback()
+{
+	OnDisposing(this, nullptr);
+
+	if (this->Disposed)
+		return;
+
+	_cloth = nullptr;
+	_front = nullptr;
+	_back = nullptr;
+
+	OnDisposed(this, nullptr);
+}
+bool ClothParticleReadback::Disposed::get()
+{
+	return (_cloth == nullptr);
+}
+
+void ClothParticleReadback::Capture()
+{
+	ThrowIfThisDisposed();
+
+	PxCloth* cloth = _cloth->UnmanagedPointer;
+
+	int n = cloth->getNbParticles();
+
+	// The particle count can't change after creation, but be safe if it's ever made to
+	if (_back->Length != n)
+		_back = gcnew array<Vector3>(n);
+
+	PxClothParticleData* data = cloth->lockParticleData(PxDataAccessFlag::eREADABLE);
+
+	if (data == NULL)
+		throw gcnew OperationFailedException("Failed to lock the cloth particle data");
+
+	try
+	{
+		if (n > 0)
+		{
+			pin_ptr<Vector3> p = &_back[0];
+
+			ClothParticleView::CopyPositions(data->particles, n, (Byte*)p, sizeof(PxVec3));
+		}
+	}
+	finally
+	{
+		data->unlock();
+	}
+
+	// Publish the new positions, the old front becomes the next back buffer
+	array<Vector3>^ captured = _back;
+	_back = _front;
+	Volatile::Write(_front, captured);
+
+	_captureCount++;
+}
+
+//
+
+PhysX::Cloth^ ClothParticleReadback::Cloth::get()
+{
+	return _cloth;
+}
+
+array<Vector3>^ ClothParticleReadback::Positions::get()
+{
+	return Volatile::Read(_front);
+}
+
+int ClothParticleReadback::CaptureCount::get()
+{
+	return _captureCount;
+}
\ No newline at end of file
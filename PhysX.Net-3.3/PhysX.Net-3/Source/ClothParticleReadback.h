@@ -0,0 +1,72 @@
+#pragma once
+
+namespace PhysX
+{
+	ref class Cloth;
+
+	/// <summary>
+	/// Double buffered readback of cloth particle positions. Capture locks the cloth once, copies the positions into the
+	/// back buffer and swaps it to the front, so rendering can read the latest positions without locking the cloth.
+	/// </summary>
+	/// <remarks>
+	/// Call Capture after Scene.FetchResults. An array returned by Positions is not written to until the second Capture
+	/// after it was returned, so a render thread can read one frame while the next one is captured.
+	/// </remarks>
+	public ref class ClothParticleReadback : IDisposable
+	{
+	public:
+		/// <summary>Raised before any disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposing;
+		/// <summary>Raised once all disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposed;
+
+	private:
+		PhysX::Cloth^ _cloth;
+		array<Vector3>^ _front;
+		array<Vector3>^ _back;
+		int _captureCount;
+
+	public:
+		/// <summary>
+		/// Creates a readback for a cloth. The readback is disposed with the cloth.
+		/// </summary>
+		ClothParticleReadback(PhysX::Cloth^ cloth);
+		~ClothParticleReadback();
+	protected:
+		!ClothParticleReadback();
+	public:
+		property bool Disposed
+		{
+			virtual bool get();
+		}
+
+		/// <summary>
+		/// Copies the current particle positions of the cloth into the back buffer and swaps the buffers.
+		/// </summary>
+		void Capture();
+
+		/// <summary>
+		/// Gets the cloth the positions are read from.
+		/// </summary>
+		property PhysX::Cloth^ Cloth
+		{
+			PhysX::Cloth^ get();
+		}
+
+		/// <summary>
+		/// Gets the positions from the last capture.
+		/// </summary>
+		property array<Vector3>^ Positions
+		{
+			array<Vector3>^ get();
+		}
+
+		/// <summary>
+		/// Gets the number of captures performed.
+		/// </summary>
+		property int CaptureCount
+		{
+			int get();
+		}
+	};
+};
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "StdAfx.h"
+#include "ClothParticleView.h"
+
+#pragma managed(push, off)
+static void CopyParticlePositions(const PxClothParticle* particles, PxU32 count, PxU8* destination, PxU32 stride)
+{
+	for (PxU32 i = 0; i < count; i++)
+	{
+		*reinterpret_cast<PxVec3*>(destination) = particles[i].pos;
+
+		destination += stride;
+	}
+}
+#pragma managed(pop)
+
+ClothParticleView::ClothParticleView(PxClothParticleData* data, int particleCount)
+	: LockedData(data)
+{
+	_particles = data->particles;
+	_previousParticles = data->previousParticles;
+	_count = particleCount;
+}
+ClothParticleView::~ClothParticleView()
+{
+	if (_particles != NULL)
+		Unlock();
+}
+
+void ClothParticleView::Unlock()
+{
+	ThrowIfUnlocked();
+
+	LockedData::Unlock();
+
+	_particles = NULL;
+	_previousParticles = NULL;
+}
+
+ClothParticle ClothParticleView::GetParticle(int index)
+{
+	const PxClothParticle& p = _particles[CheckIndex(index)];
+
+	return ClothParticle(MathUtil::PxVec3ToVector3(p.pos), p.invWeight);
+}
+ClothParticle ClothParticleView::GetPreviousParticle(int index)
+{
+	index = CheckIndex(index);
+
+	if (_previousParticles == NULL)
+		throw gcnew InvalidOperationException("The previous particles are not available");
+
+	const PxClothParticle& p = _previousParticles[index];
+
+	return ClothParticle(MathUtil::PxVec3ToVector3(p.pos), p.invWeight);
+}
+Vector3 ClothParticleView::GetPosition(int index)
+{
+	return MathUtil::PxVec3ToVector3(_particles[CheckIndex(index)].pos);
+}
+
+void ClothParticleView::CopyPositions(array<Vector3>^ positions, int offset)
+{
+	ThrowIfUnlocked();
+	ThrowIfNull(positions, "positions");
+
+	if (offset < 0 || offset + _count > positions->Length)
+		throw gcnew ArgumentOutOfRangeException("offset", "The positions array is too small to hold the particles at the given offset");
+
+	if (_count == 0)
+		return;
+
+	pin_ptr<Vector3> p = &positions[offset];
+
+	CopyPositions(_particles, _count, (Byte*)p, sizeof(PxVec3));
+}
+void ClothParticleView::CopyPositions(BoundedData destination)
+{
+	ThrowIfUnlocked();
+
+	if (destination.Count > _count)
+		throw gcnew ArgumentOutOfRangeException("destination", "Count cannot exceed the number of particles");
+
+	GCHandle pin;
+	PxBoundedData d = destination.ToUnmanaged(pin, sizeof(PxVec3));
+
+	try
+	{
+		CopyPositions(_particles, d.count, (Byte*)d.data, d.stride);
+	}
+	finally
+	{
+		if (pin.IsAllocated)
+			pin.Free();
+	}
+}
+
+void ClothParticleView::CopyPositions(const PxClothParticle* particles, int count, Byte* destination, int stride)
+{
+	if (count > 0)
+		CopyParticlePositions(particles, count, destination, stride);
+}
+
+void ClothParticleView::ThrowIfUnlocked()
+{
+	if (_particles == NULL)
+		throw gcnew InvalidOperationException("The particle data has been unlocked");
+}
+int ClothParticleView::CheckIndex(int index)
+{
+	ThrowIfUnlocked();
+
+	if (index < 0 || index >= _count)
+		throw gcnew ArgumentOutOfRangeException("index");
+
+	return index;
+}
+
+//
+
+IntPtr ClothParticleView::Particles::get()
+{
+	ThrowIfUnlocked();
+
+	return IntPtr(_particles);
+}
+
+IntPtr ClothParticleView::PreviousParticles::get()
+{
+	ThrowIfUnlocked();
+
+	return IntPtr(_previousParticles);
+}
+
+int ClothParticleView::Count::get()
+{
+	return _count;
+}
\ No newline at end of file
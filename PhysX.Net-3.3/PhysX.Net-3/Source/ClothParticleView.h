@@ -0,0 +1,87 @@
+#pragma once
+
+#include "LockedData.h"
+#include "ClothParticle.h"
+#include "BoundedData.h"
+
+namespace PhysX
+{
+	/// <summary>
+	/// A view of locked cloth particle data which reads the native particle memory directly, instead of copying every
+	/// current and previous particle into managed arrays like ClothParticleData.
+	/// The view is only valid while the lock is held, disposing the view unlocks the data.
+	/// </summary>
+	public ref class ClothParticleView : LockedData
+	{
+	private:
+		PxClothParticle* _particles;
+		PxClothParticle* _previousParticles;
+		int _count;
+
+	internal:
+		ClothParticleView(PxClothParticleData* data, int particleCount);
+	public:
+		~ClothParticleView();
+
+		/// <summary>
+		/// Unlocks the particle data, after which the view can no longer be read.
+		/// </summary>
+		virtual void Unlock() override;
+
+		/// <summary>
+		/// Gets a current particle.
+		/// </summary>
+		ClothParticle GetParticle(int index);
+		/// <summary>
+		/// Gets a previous particle.
+		/// </summary>
+		ClothParticle GetPreviousParticle(int index);
+		/// <summary>
+		/// Gets the position of a current particle.
+		/// </summary>
+		Vector3 GetPosition(int index);
+
+		/// <summary>
+		/// Copies the positions of the current particles into an array.
+		/// </summary>
+		/// <param name="positions">The array to copy to.</param>
+		/// <param name="offset">The index in the array to start copying to.</param>
+		void CopyPositions(array<Vector3>^ positions, int offset);
+		/// <summary>
+		/// Copies the positions of the first destination.Count current particles into a strided buffer, such as the
+		/// position element of an interleaved vertex buffer. The stride must be at least 12 bytes.
+		/// </summary>
+		void CopyPositions(BoundedData destination);
+
+		/// <summary>
+		/// Gets the locked current particles, as an array of ClothParticle. Only valid until the data is unlocked.
+		/// </summary>
+		property IntPtr Particles
+		{
+			IntPtr get();
+		}
+
+		/// <summary>
+		/// Gets the locked previous particles, as an array of ClothParticle. Only valid until the data is unlocked.
+		/// </summary>
+		property IntPtr PreviousParticles
+		{
+			IntPtr get();
+		}
+
+		/// <summary>
+		/// Gets the number of particles.
+		/// </summary>
+		property int Count
+		{
+			int get();
+		}
+
+	internal:
+		static void CopyPositions(const PxClothParticle* particles, int count, Byte* destination, int stride);
+
+	private:
+		void ThrowIfUnlocked();
+		int CheckIndex(int index);
+	};
+};
\ No newline at end of file
@@ -55,11 +55,10 @@ bool Controller::Disposed::get()
 
 ControllerCollisionFlag Controller::Move(Vector3 displacement, TimeSpan elapsedTime)
 {
-	auto filter = gcnew ControllerFilters();
-		filter->ActiveGroups = 0xFFFFFFFF;
-		filter->FilterFlags = QueryFlag::Static | QueryFlag::Dynamic;
+	// The native defaults filter against static and dynamic shapes, there's no need to allocate managed filters
+	PxU32 returnFlags = _controller->move(UV(displacement), 0.001f, (float)elapsedTime.TotalSeconds, PxControllerFilters(), NULL);
 
-	return Move(displacement, elapsedTime, 0.001f, filter, nullptr);
+	return (ControllerCollisionFlag)returnFlags;
 }
 ControllerCollisionFlag Controller::Move(Vector3 displacement, TimeSpan elapsedTime, float minimumDistance, ControllerFilters^ filters, [Optional] ObstacleContext^ obstacles)
 {
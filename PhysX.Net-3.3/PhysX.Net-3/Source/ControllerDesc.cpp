@@ -3,6 +3,7 @@
 #include "Material.h"
 #include "FilterData.h"
 #include "UserControllerHitReport.h"
+#include "ControllerHitBuffer.h"
 
 ControllerDesc::ControllerDesc(ControllerShapeType type)
 {
@@ -43,6 +44,14 @@ void ControllerDesc::AssignToUnmanaged(ControllerDesc^ desc, PxControllerDesc& d
 	d.nonWalkableMode = ToUnmanagedEnum(PxControllerNonWalkableMode, desc->NonWalkableMode);
 	d.material = (desc->Material == nullptr ? NULL : desc->Material->UnmanagedPointer);
 	d.reportCallback = (desc->ReportCallback == nullptr ? NULL : desc->ReportCallback->UnmanagedPointer);
+
+	if (desc->HitBuffer != nullptr)
+	{
+		ThrowIfNullOrDisposed(desc->HitBuffer, "desc.HitBuffer");
+
+		d.reportCallback = desc->HitBuffer->UnmanagedPointer;
+		d.behaviorCallback = desc->HitBuffer->UnmanagedPointer;
+	}
 }
 void ControllerDesc::AssignToManaged(PxControllerDesc& d, ControllerDesc^ desc)
 {
@@ -57,5 +66,9 @@ void ControllerDesc::AssignToManaged(PxControllerDesc& d, ControllerDesc^ desc)
 	desc->ScaleCoefficient = d.scaleCoeff;
 	desc->NonWalkableMode = ToManagedEnum(ControllerNonWalkableMode, d.nonWalkableMode);
 	desc->Material = ObjectTable::GetObject<PhysX::Material^>((intptr_t)d.material);
-	desc->ReportCallback = ObjectTable::GetObject<PhysX::UserControllerHitReport^>((intptr_t)d.reportCallback);
+	// The report callback is either a hit buffer or a user callback
+	desc->HitBuffer = dynamic_cast<ControllerHitBuffer^>(ObjectTable::TryGetObject((intptr_t)d.reportCallback));
+
+	if (desc->HitBuffer == nullptr)
+		desc->ReportCallback = ObjectTable::GetObject<PhysX::UserControllerHitReport^>((intptr_t)d.reportCallback);
 }
\ No newline at end of file
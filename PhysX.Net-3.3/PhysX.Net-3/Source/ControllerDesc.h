@@ -8,6 +8,7 @@ namespace PhysX
 	ref class Scene;
 	value class FilterData;
 	ref class UserControllerHitReport;
+	ref class ControllerHitBuffer;
 
 	/// <summary>
 	/// Descriptor class for a character controller.
@@ -100,5 +101,11 @@ namespace PhysX
 		/// Gets or sets the user callback class for character controller events.
 		/// </summary>
 		property UserControllerHitReport^ ReportCallback;
+
+		/// <summary>
+		/// Gets or sets a buffer to record the controller's hits in, and to resolve its behavior flags from.
+		/// When set, it takes the place of ReportCallback.
+		/// </summary>
+		property ControllerHitBuffer^ HitBuffer;
 	};
 };
\ No newline at end of file
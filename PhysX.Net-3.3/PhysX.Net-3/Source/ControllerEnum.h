@@ -9,4 +9,23 @@ namespace PhysX
 		CctSlide = PxControllerBehaviorFlag::eCCT_SLIDE,
 		CctUserDefinedRide = PxControllerBehaviorFlag::eCCT_USER_DEFINED_RIDE
 	};
+
+	/// <summary>
+	/// The kind of object a controller hit, as recorded in a ControllerHitBuffer.
+	/// </summary>
+	public enum class ControllerHitType
+	{
+		/// <summary>
+		/// The controller hit a shape.
+		/// </summary>
+		Shape = 0,
+		/// <summary>
+		/// The controller hit another controller.
+		/// </summary>
+		Controller = 1,
+		/// <summary>
+		/// The controller hit a user-defined obstacle.
+		/// </summary>
+		Obstacle = 2
+	};
 };
\ No newline at end of file
@@ -18,5 +18,21 @@ PxControllerFilters ControllerFilters::ToUnmanaged(ControllerFilters^ filters)
 		f.mFilterData = fd;
 		f.mFilterFlags = ToUnmanagedEnum(PxQueryFlag, filters->FilterFlags);
 
+	return f;
+}
+PxControllerFilters ControllerFilters::ToUnmanaged(ControllerFilters^ filters, PxFilterData* filterData)
+{
+	if (filters == nullptr)
+		throw gcnew ArgumentNullException("filters");
+
+	PxControllerFilters f;
+		f.mFilterFlags = ToUnmanagedEnum(PxQueryFlag, filters->FilterFlags);
+
+	if (filters->FilterData.HasValue)
+	{
+		*filterData = PhysX::FilterData::ToUnmanaged(filters->FilterData.Value);
+		f.mFilterData = filterData;
+	}
+
 	return f;
 }
\ No newline at end of file
@@ -9,6 +9,10 @@ namespace PhysX
 	{
 	internal:
 		static PxControllerFilters ToUnmanaged(ControllerFilters^ filters);
+		/// <summary>
+		/// Converts the filters without allocating, any filter data is written to the given storage which must outlive the result.
+		/// </summary>
+		static PxControllerFilters ToUnmanaged(ControllerFilters^ filters, PxFilterData* filterData);
 
 	public:
 		/// <summary>
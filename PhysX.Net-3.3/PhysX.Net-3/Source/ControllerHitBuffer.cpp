@@ -0,0 +1,318 @@
+#include "StdAfx.h"
+#include "ControllerHitBuffer.h"
+#include "ControllerHitRecord.h"
+#include "ControllerManager.h"
+#include "Controller.h"
+#include "Shape.h"
+
+// The callbacks are called by PhysX from within Controller::move, so keep them free of managed transitions
+#pragma managed(push, off)
+InternalControllerHitBuffer::InternalControllerHitBuffer(PxU32 capacity)
+{
+	this->records = new ControllerHitRecordUnmanaged[capacity];
+	this->objects = new ControllerHitObjects[capacity];
+	this->capacity = capacity;
+	this->count = 0;
+	this->dropped = 0;
+
+	this->defaultShapeBehaviorFlags = 0;
+	this->controllerBehaviorFlags = 0;
+	this->obstacleBehaviorFlags = 0;
+}
+InternalControllerHitBuffer::~InternalControllerHitBuffer()
+{
+	delete[] this->records;
+	delete[] this->objects;
+}
+
+ControllerHitRecordUnmanaged* InternalControllerHitBuffer::reserve(const PxControllerHit& hit, PxU32 type, const void* other)
+{
+	PxU32 index = (PxU32)InterlockedIncrement(&this->count) - 1;
+
+	if (index >= this->capacity)
+	{
+		InterlockedIncrement(&this->dropped);
+		return NULL;
+	}
+
+	ControllerHitRecordUnmanaged* r = &this->records[index];
+		r->type = type;
+		r->triangleIndex = 0xFFFFFFFF;
+		r->worldPosition = PxVec3((PxReal)hit.worldPos.x, (PxReal)hit.worldPos.y, (PxReal)hit.worldPos.z);
+		r->worldNormal = hit.worldNormal;
+		r->direction = hit.dir;
+		r->length = hit.length;
+
+	this->objects[index].controller = hit.controller;
+	this->objects[index].other = other;
+
+	return r;
+}
+
+void InternalControllerHitBuffer::onShapeHit(const PxControllerShapeHit& hit)
+{
+	ControllerHitRecordUnmanaged* r = reserve(hit, 0, hit.shape);
+
+	if (r != NULL)
+		r->triangleIndex = hit.triangleIndex;
+}
+void InternalControllerHitBuffer::onControllerHit(const PxControllersHit& hit)
+{
+	reserve(hit, 1, hit.other);
+}
+void InternalControllerHitBuffer::onObstacleHit(const PxControllerObstacleHit& hit)
+{
+	reserve(hit, 2, NULL);
+}
+
+PxControllerBehaviorFlags InternalControllerHitBuffer::getBehaviorFlags(const PxShape& shape, const PxActor& actor)
+{
+	if (!this->shapeBehaviorFlags.empty())
+	{
+		PxFilterData fd = shape.getQueryFilterData();
+
+		for (size_t i = 0; i < this->shapeBehaviorFlags.size(); i++)
+		{
+			const PxFilterData& key = this->shapeBehaviorFlags[i].first;
+
+			if (key.word0 == fd.word0 && key.word1 == fd.word1 && key.word2 == fd.word2 && key.word3 == fd.word3)
+				return PxControllerBehaviorFlags((PxU8)this->shapeBehaviorFlags[i].second);
+		}
+	}
+
+	return PxControllerBehaviorFlags((PxU8)this->defaultShapeBehaviorFlags);
+}
+PxControllerBehaviorFlags InternalControllerHitBuffer::getBehaviorFlags(const PxController& controller)
+{
+	return PxControllerBehaviorFlags((PxU8)this->controllerBehaviorFlags);
+}
+PxControllerBehaviorFlags InternalControllerHitBuffer::getBehaviorFlags(const PxObstacle& obstacle)
+{
+	return PxControllerBehaviorFlags((PxU8)this->obstacleBehaviorFlags);
+}
+#pragma managed(pop)
+
+//
+
+ControllerHitBuffer::ControllerHitBuffer(PhysX::ControllerManager^ controllerManager, int capacity)
+{
+	ThrowIfNullOrDisposed(controllerManager, "controllerManager");
+	if (capacity <= 0)
+		throw gcnew ArgumentOutOfRangeException("capacity", "Capacity must be greater than zero");
+
+	_buffer = new InternalControllerHitBuffer(capacity);
+	_controllerManager = controllerManager;
+	_controllers = gcnew List<Controller^>();
+
+	// Keyed by the hit report pointer, which is what PxControllerDesc stores
+	ObjectTable::Add((intptr_t)static_cast<PxUserControllerHitReport*>(_buffer), this, controllerManager);
+}
+ControllerHitBuffer::~ControllerHitBuffer()
+{
+	this->!ControllerHitBuffer();
+}
+ControllerHitBuffer::!ControllerHitBuffer()
+{
+	OnDisposing(this, nullptr);
+
+	if (this->Disposed)
+		return;
+
+	_controllerManager = nullptr;
+
+	// Live controllers still point at the native callbacks, the last one to be disposed deletes them
+	if (_controllers->Count == 0)
+		SAFE_DELETE(_buffer);
+
+	OnDisposed(this, nullptr);
+}
+bool ControllerHitBuffer::Disposed::get()
+{
+	return (_controllerManager == nullptr || _buffer == NULL);
+}
+
+void ControllerHitBuffer::AddController(Controller^ controller)
+{
+	_controllers->Add(controller);
+
+	controller->OnDisposed += gcnew EventHandler(this, &ControllerHitBuffer::OnControllerDisposed);
+}
+void ControllerHitBuffer::OnControllerDisposed(Object^ sender, EventArgs^ e)
+{
+	_controllers->Remove((Controller^)sender);
+
+	if (this->Disposed && _controllers->Count == 0)
+		SAFE_DELETE(_buffer);
+}
+
+void ControllerHitBuffer::Clear()
+{
+	ThrowIfThisDisposed();
+
+	_buffer->count = 0;
+	_buffer->dropped = 0;
+}
+
+int ControllerHitBuffer::CheckIndex(int index)
+{
+	ThrowIfThisDisposed();
+
+	if (index < 0 || index >= this->Count)
+		throw gcnew ArgumentOutOfRangeException("index");
+
+	return index;
+}
+
+ControllerHitRecord ControllerHitBuffer::GetHit(int index)
+{
+	ControllerHitRecord hit;
+	pin_ptr<ControllerHitRecord> h = &hit;
+
+	*(ControllerHitRecordUnmanaged*)h = _buffer->records[CheckIndex(index)];
+
+	return hit;
+}
+int ControllerHitBuffer::CopyTo(array<ControllerHitRecord>^ hits, int offset)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(hits, "hits");
+
+	int n = this->Count;
+
+	if (offset < 0 || offset + n > hits->Length)
+		throw gcnew ArgumentOutOfRangeException("offset", "The hits array is too small to hold the recorded hits at the given offset");
+
+	if (n == 0)
+		return 0;
+
+	pin_ptr<ControllerHitRecord> h = &hits[offset];
+
+	memcpy(h, _buffer->records, sizeof(ControllerHitRecordUnmanaged) * n);
+
+	return n;
+}
+
+Controller^ ControllerHitBuffer::GetController(int index)
+{
+	const PxController* controller = _buffer->objects[CheckIndex(index)].controller;
+
+	return ObjectTable::TryGetObject<Controller^>((intptr_t)controller);
+}
+Shape^ ControllerHitBuffer::GetShape(int index)
+{
+	index = CheckIndex(index);
+
+	if (_buffer->records[index].type != (PxU32)ControllerHitType::Shape)
+		return nullptr;
+
+	return ObjectTable::TryGetObject<Shape^>((intptr_t)_buffer->objects[index].other);
+}
+Controller^ ControllerHitBuffer::GetOtherController(int index)
+{
+	index = CheckIndex(index);
+
+	if (_buffer->records[index].type != (PxU32)ControllerHitType::Controller)
+		return nullptr;
+
+	return ObjectTable::TryGetObject<Controller^>((intptr_t)_buffer->objects[index].other);
+}
+
+void ControllerHitBuffer::SetShapeBehaviorFlags(FilterData filterData, ControllerBehaviorFlag flags)
+{
+	ThrowIfThisDisposed();
+
+	PxFilterData fd = FilterData::ToUnmanaged(filterData);
+
+	auto& table = _buffer->shapeBehaviorFlags;
+
+	for (size_t i = 0; i < table.size(); i++)
+	{
+		const PxFilterData& key = table[i].first;
+
+		if (key.word0 == fd.word0 && key.word1 == fd.word1 && key.word2 == fd.word2 && key.word3 == fd.word3)
+		{
+			table[i].second = (PxU32)flags;
+			return;
+		}
+	}
+
+	table.push_back(std::make_pair(fd, (PxU32)flags));
+}
+void ControllerHitBuffer::ClearShapeBehaviorFlags()
+{
+	ThrowIfThisDisposed();
+
+	_buffer->shapeBehaviorFlags.clear();
+}
+
+//
+
+PhysX::ControllerManager^ ControllerHitBuffer::ControllerManager::get()
+{
+	return _controllerManager;
+}
+
+int ControllerHitBuffer::Capacity::get()
+{
+	ThrowIfThisDisposed();
+
+	return _buffer->capacity;
+}
+
+int ControllerHitBuffer::Count::get()
+{
+	ThrowIfThisDisposed();
+
+	return Math::Min((int)_buffer->count, (int)_buffer->capacity);
+}
+
+int ControllerHitBuffer::DroppedCount::get()
+{
+	ThrowIfThisDisposed();
+
+	return _buffer->dropped;
+}
+
+ControllerBehaviorFlag ControllerHitBuffer::DefaultShapeBehaviorFlags::get()
+{
+	ThrowIfThisDisposed();
+
+	return (ControllerBehaviorFlag)_buffer->defaultShapeBehaviorFlags;
+}
+void ControllerHitBuffer::DefaultShapeBehaviorFlags::set(ControllerBehaviorFlag value)
+{
+	ThrowIfThisDisposed();
+
+	_buffer->defaultShapeBehaviorFlags = (PxU32)value;
+}
+
+ControllerBehaviorFlag ControllerHitBuffer::ControllerBehaviorFlags::get()
+{
+	ThrowIfThisDisposed();
+
+	return (ControllerBehaviorFlag)_buffer->controllerBehaviorFlags;
+}
+void ControllerHitBuffer::ControllerBehaviorFlags::set(ControllerBehaviorFlag value)
+{
+	ThrowIfThisDisposed();
+
+	_buffer->controllerBehaviorFlags = (PxU32)value;
+}
+
+ControllerBehaviorFlag ControllerHitBuffer::ObstacleBehaviorFlags::get()
+{
+	ThrowIfThisDisposed();
+
+	return (ControllerBehaviorFlag)_buffer->obstacleBehaviorFlags;
+}
+void ControllerHitBuffer::ObstacleBehaviorFlags::set(ControllerBehaviorFlag value)
+{
+	ThrowIfThisDisposed();
+
+	_buffer->obstacleBehaviorFlags = (PxU32)value;
+}
+
+InternalControllerHitBuffer* ControllerHitBuffer::UnmanagedPointer::get()
+{
+	return _buffer;
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "ControllerEnum.h"
+#include "FilterData.h"
+
+namespace PhysX
+{
+	ref class ControllerManager;
+	ref class Controller;
+	ref class Shape;
+	value class ControllerHitRecord;
+
+	// Native layout of ControllerHitRecord
+	struct ControllerHitRecordUnmanaged
+	{
+		PxU32 type;
+		PxU32 triangleIndex;
+		PxVec3 worldPosition;
+		PxVec3 worldNormal;
+		PxVec3 direction;
+		PxF32 length;
+	};
+
+	// The objects of a hit, kept out of the blittable record
+	struct ControllerHitObjects
+	{
+		const PxController* controller;
+		const void* other;
+	};
+
+	class InternalControllerHitBuffer : public PxUserControllerHitReport, public PxControllerBehaviorCallback
+	{
+		public:
+			ControllerHitRecordUnmanaged* records;
+			ControllerHitObjects* objects;
+			PxU32 capacity;
+			volatile LONG count;
+			volatile LONG dropped;
+
+			std::vector<std::pair<PxFilterData, PxU32>> shapeBehaviorFlags;
+			PxU32 defaultShapeBehaviorFlags;
+			PxU32 controllerBehaviorFlags;
+			PxU32 obstacleBehaviorFlags;
+
+		public:
+			InternalControllerHitBuffer(PxU32 capacity);
+			virtual ~InternalControllerHitBuffer();
+
+			virtual void onShapeHit(const PxControllerShapeHit& hit);
+			virtual void onControllerHit(const PxControllersHit& hit);
+			virtual void onObstacleHit(const PxControllerObstacleHit& hit);
+
+			virtual PxControllerBehaviorFlags getBehaviorFlags(const PxShape& shape, const PxActor& actor);
+			virtual PxControllerBehaviorFlags getBehaviorFlags(const PxController& controller);
+			virtual PxControllerBehaviorFlags getBehaviorFlags(const PxObstacle& obstacle);
+
+		private:
+			ControllerHitRecordUnmanaged* reserve(const PxControllerHit& hit, PxU32 type, const void* other);
+	};
+
+	/// <summary>
+	/// Records character controller hits into a fixed size native buffer of blittable records, instead of calling into
+	/// managed code for each hit like UserControllerHitReport. Read the hits once the moves are done, then call Clear.
+	/// The buffer also resolves behavior flags from a native table keyed by the query filter data of the touched shape,
+	/// without a callback.
+	/// </summary>
+	/// <remarks>
+	/// Assign the buffer to ControllerDesc.HitBuffer when creating the controllers. Hits are reserved atomically, so
+	/// controllers of different managers can share a buffer while being moved on different threads. Hits beyond the
+	/// capacity are counted in DroppedCount and discarded.
+	/// Controllers keep calling into the native buffer, so disposing it while they are alive only releases the native
+	/// memory once the last controller created with it is disposed.
+	/// </remarks>
+	public ref class ControllerHitBuffer : IDisposable
+	{
+	public:
+		/// <summary>Raised before any disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposing;
+		/// <summary>Raised once all disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposed;
+
+	private:
+		InternalControllerHitBuffer* _buffer;
+		PhysX::ControllerManager^ _controllerManager;
+		List<Controller^>^ _controllers;
+
+	public:
+		/// <summary>
+		/// Creates a hit buffer owned by a controller manager.
+		/// </summary>
+		/// <param name="controllerManager">The controller manager of the controllers which will use the buffer.</param>
+		/// <param name="capacity">The maximum number of hits recorded between calls to Clear.</param>
+		ControllerHitBuffer(PhysX::ControllerManager^ controllerManager, int capacity);
+		~ControllerHitBuffer();
+	protected:
+		!ControllerHitBuffer();
+	public:
+		property bool Disposed
+		{
+			virtual bool get();
+		}
+
+		/// <summary>
+		/// Discards the recorded hits and resets DroppedCount.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Gets a recorded hit.
+		/// </summary>
+		ControllerHitRecord GetHit(int index);
+		/// <summary>
+		/// Copies the recorded hits into an array. Returns the number of hits copied.
+		/// </summary>
+		/// <param name="hits">The array to copy to.</param>
+		/// <param name="offset">The index in the array to start copying to.</param>
+		int CopyTo(array<ControllerHitRecord>^ hits, int offset);
+
+		/// <summary>
+		/// Gets the controller that moved in a recorded hit.
+		/// </summary>
+		Controller^ GetController(int index);
+		/// <summary>
+		/// Gets the touched shape of a recorded shape hit, or null for other hits.
+		/// </summary>
+		Shape^ GetShape(int index);
+		/// <summary>
+		/// Gets the touched controller of a recorded controller hit, or null for other hits.
+		/// </summary>
+		Controller^ GetOtherController(int index);
+
+		/// <summary>
+		/// Sets the behavior flags returned for shapes whose query filter data is exactly equal to the given filter data.
+		/// </summary>
+		void SetShapeBehaviorFlags(FilterData filterData, ControllerBehaviorFlag flags);
+		/// <summary>
+		/// Removes all the entries set with SetShapeBehaviorFlags.
+		/// </summary>
+		void ClearShapeBehaviorFlags();
+
+		/// <summary>
+		/// Gets the controller manager the buffer belongs to.
+		/// </summary>
+		property PhysX::ControllerManager^ ControllerManager
+		{
+			PhysX::ControllerManager^ get();
+		}
+
+		/// <summary>
+		/// Gets the maximum number of hits recorded between calls to Clear.
+		/// </summary>
+		property int Capacity
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of recorded hits.
+		/// </summary>
+		property int Count
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of hits discarded because the buffer was full.
+		/// </summary>
+		property int DroppedCount
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets or sets the behavior flags returned for shapes with no entry in the shape behavior table.
+		/// </summary>
+		property ControllerBehaviorFlag DefaultShapeBehaviorFlags
+		{
+			ControllerBehaviorFlag get();
+			void set(ControllerBehaviorFlag value);
+		}
+
+		/// <summary>
+		/// Gets or sets the behavior flags returned for controllers.
+		/// </summary>
+		property ControllerBehaviorFlag ControllerBehaviorFlags
+		{
+			ControllerBehaviorFlag get();
+			void set(ControllerBehaviorFlag value);
+		}
+
+		/// <summary>
+		/// Gets or sets the behavior flags returned for obstacles.
+		/// </summary>
+		property ControllerBehaviorFlag ObstacleBehaviorFlags
+		{
+			ControllerBehaviorFlag get();
+			void set(ControllerBehaviorFlag value);
+		}
+
+	internal:
+		property InternalControllerHitBuffer* UnmanagedPointer
+		{
+			InternalControllerHitBuffer* get();
+		}
+
+		void AddController(Controller^ controller);
+
+	private:
+		int CheckIndex(int index);
+		void OnControllerDisposed(Object^ sender, EventArgs^ e);
+	};
+};
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "ControllerEnum.h"
+
+using namespace System::Runtime::InteropServices;
+
+namespace PhysX
+{
+	/// <summary>
+	/// A controller hit recorded by a ControllerHitBuffer.
+	/// The objects involved are resolved through the buffer, as they can't be stored in a blittable record.
+	/// </summary>
+	[StructLayout(LayoutKind::Sequential)]
+	public value class ControllerHitRecord
+	{
+	public:
+		/// <summary>
+		/// Gets or sets the kind of object that was hit.
+		/// </summary>
+		property ControllerHitType Type;
+
+		/// <summary>
+		/// Gets or sets the touched triangle index, only for shape hits against meshes and heightfields.
+		/// </summary>
+		property int TriangleIndex;
+
+		/// <summary>
+		/// Gets or sets the contact position in world space.
+		/// </summary>
+		property Vector3 WorldPosition;
+
+		/// <summary>
+		/// Gets or sets the contact normal in world space.
+		/// </summary>
+		property Vector3 WorldNormal;
+
+		/// <summary>
+		/// Gets or sets the motion direction.
+		/// </summary>
+		property Vector3 Direction;
+
+		/// <summary>
+		/// Gets or sets the motion length.
+		/// </summary>
+		property float Length;
+	};
+};
\ No newline at end of file
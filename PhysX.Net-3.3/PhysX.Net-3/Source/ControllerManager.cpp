@@ -10,6 +10,52 @@
 #include "Physics.h"
 #include "FailedToCreateObjectException.h"
 #include "ObstacleContext.h"
+#include "ControllerFilters.h"
+#include "ControllerMoveResult.h"
+#include "ControllerHitBuffer.h"
+
+using namespace System::Threading;
+
+namespace PhysX
+{
+	// Native layout of ControllerMoveResult
+	struct ControllerMoveResultUnmanaged
+	{
+		PxU32 collisionFlags;
+		PxVec3 footPosition;
+	};
+
+	// The inputs and outputs of a MoveAll call
+	struct ControllerMoveBatch
+	{
+		PxController** controllers;
+		const PxVec3* displacements;
+		ControllerMoveResultUnmanaged* results;
+		PxU32 count;
+		PxF32 minimumDistance;
+		PxF32 elapsedTime;
+		PxFilterData filterData;
+		PxControllerFilters filters;
+		const PxObstacleContext* obstacles;
+	};
+};
+
+#pragma managed(push, off)
+static void MoveControllers(const PhysX::ControllerMoveBatch& batch, PxU32 start, PxU32 count)
+{
+	for (PxU32 i = start; i < start + count; i++)
+	{
+		PxController* controller = batch.controllers[i];
+
+		PxControllerCollisionFlags flags = controller->move(batch.displacements[i], batch.minimumDistance, batch.elapsedTime, batch.filters, batch.obstacles);
+
+		PxExtendedVec3 foot = controller->getFootPosition();
+
+		batch.results[i].collisionFlags = (PxU32)flags;
+		batch.results[i].footPosition = PxVec3((PxReal)foot.x, (PxReal)foot.y, (PxReal)foot.z);
+	}
+}
+#pragma managed(pop)
 
 PhysX::ControllerManager::ControllerManager(PxControllerManager* manager, PhysX::Scene^ owner)
 {
@@ -23,6 +69,9 @@ PhysX::ControllerManager::ControllerManager(PxControllerManager* manager, PhysX:
 	_scene = owner;
 
 	_controllers = gcnew List<Controller^>();
+
+	_moveControllers = new std::vector<PxController*>();
+	_moveLock = gcnew Object();
 }
 PhysX::ControllerManager::~ControllerManager()
 {
@@ -41,6 +90,8 @@ PhysX::ControllerManager::!ControllerManager()
 	_scene = nullptr;
 	_controllers = nullptr;
 
+	SAFE_DELETE(_moveControllers);
+
 	OnDisposed(this, nullptr);
 }
 bool PhysX::ControllerManager::Disposed::get()
@@ -99,6 +150,9 @@ Controller^ ControllerManager::CreateController(ControllerDesc^ controllerDesc)
 
 	_controllers->Add(controller);
 
+	if (controllerDesc->HitBuffer != nullptr)
+		controllerDesc->HitBuffer->AddController(controller);
+
 	return controller;
 }
 
@@ -107,6 +161,72 @@ void PhysX::ControllerManager::ComputeInteractions(TimeSpan elapsedTime)
 	_manager->computeInteractions((float)elapsedTime.TotalSeconds);
 }
 
+void ControllerManager::MoveAll(array<Controller^>^ controllers, array<Vector3>^ displacements, array<ControllerMoveResult>^ results, TimeSpan elapsedTime, float minimumDistance, [Optional] ControllerFilters^ filters, [Optional] ObstacleContext^ obstacles)
+{
+	// PxController::move isn't safe to call concurrently on one manager, and the controller buffer is shared
+	Monitor::Enter(_moveLock);
+	try
+	{
+		ControllerMoveBatch batch;
+
+		PrepareMove(controllers, displacements, results, elapsedTime, minimumDistance, filters, obstacles, batch);
+
+		if (batch.count == 0)
+			return;
+
+		pin_ptr<Vector3> d = &displacements[0];
+		pin_ptr<ControllerMoveResult> r = &results[0];
+
+		batch.displacements = (const PxVec3*)d;
+		batch.results = (ControllerMoveResultUnmanaged*)r;
+
+		MoveControllers(batch, 0, batch.count);
+	}
+	finally
+	{
+		Monitor::Exit(_moveLock);
+	}
+}
+
+void ControllerManager::PrepareMove(array<Controller^>^ controllers, array<Vector3>^ displacements, array<ControllerMoveResult>^ results, TimeSpan elapsedTime, float minimumDistance, ControllerFilters^ filters, ObstacleContext^ obstacles, ControllerMoveBatch& batch)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(controllers, "controllers");
+	ThrowIfNull(displacements, "displacements");
+	ThrowIfNull(results, "results");
+
+	int n = controllers->Length;
+
+	if (displacements->Length < n)
+		throw gcnew ArgumentException("There must be a displacement for each controller", "displacements");
+	if (results->Length < n)
+		throw gcnew ArgumentException("There must be a result for each controller", "results");
+	if (obstacles != nullptr && obstacles->Disposed)
+		throw gcnew ObjectDisposedException("obstacles");
+
+	if ((int)_moveControllers->size() < n)
+		_moveControllers->resize(n);
+
+	for (int i = 0; i < n; i++)
+	{
+		ThrowIfNullOrDisposed(controllers[i], "controllers");
+
+		if (controllers[i]->ControllerManager != this)
+			throw gcnew ArgumentException("The controllers must belong to this controller manager", "controllers");
+
+		(*_moveControllers)[i] = controllers[i]->UnmanagedPointer;
+	}
+
+	batch.controllers = n > 0 ? &(*_moveControllers)[0] : NULL;
+	batch.displacements = NULL;
+	batch.results = NULL;
+	batch.count = n;
+	batch.minimumDistance = minimumDistance;
+	batch.elapsedTime = (float)elapsedTime.TotalSeconds;
+	batch.filters = (filters == nullptr ? PxControllerFilters() : ControllerFilters::ToUnmanaged(filters, &batch.filterData));
+	batch.obstacles = (obstacles == nullptr ? NULL : obstacles->UnmanagedPointer);
+}
+
 ObstacleContext^ PhysX::ControllerManager::CreateObstacleContext()
 {
 	PxObstacleContext* oc = _manager->createObstacleContext();
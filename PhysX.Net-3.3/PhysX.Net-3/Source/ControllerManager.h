@@ -7,6 +7,9 @@ namespace PhysX
 	ref class Controller;
 	ref class ControllerDesc;
 	ref class ObstacleContext;
+	ref class ControllerFilters;
+	value class ControllerMoveResult;
+	struct ControllerMoveBatch;
 
 	/// <summary>
 	/// Manages an array of character controllers.
@@ -23,6 +26,10 @@ namespace PhysX
 
 			List<Controller^>^ _controllers;
 
+			// Reused by MoveAll so steady state batches don't allocate, guarded by _moveLock
+			std::vector<PxController*>* _moveControllers;
+			Object^ _moveLock;
+
 		internal:
 			ControllerManager(PxControllerManager* manager, PhysX::Scene^ owner);
 		public:
@@ -64,6 +71,23 @@ namespace PhysX
 			/// <param name="elapsedTime">Elapsed time since last call.</param>
 			void ComputeInteractions(TimeSpan elapsedTime);
 
+			/// <summary>
+			/// Moves a set of controllers in a single native call, writing the collision flags and new foot position
+			/// of each controller to the results.
+			/// </summary>
+			/// <remarks>
+			/// PhysX doesn't support moving controllers of the same manager concurrently, so concurrent calls on one
+			/// manager are serialized. Controllers of different managers can be moved from different threads.
+			/// </remarks>
+			/// <param name="controllers">The controllers to move. They must belong to this manager.</param>
+			/// <param name="displacements">The displacement of each controller.</param>
+			/// <param name="results">Receives the result of each move. Must be at least as long as controllers.</param>
+			/// <param name="elapsedTime">Elapsed time since the last move.</param>
+			/// <param name="minimumDistance">The minimum travelled distance to consider.</param>
+			/// <param name="filters">The filters used for every move. If null, static and dynamic shapes are collided with.</param>
+			/// <param name="obstacles">Optional obstacles to collide with.</param>
+			void MoveAll(array<Controller^>^ controllers, array<Vector3>^ displacements, array<ControllerMoveResult>^ results, TimeSpan elapsedTime, float minimumDistance, [Optional] ControllerFilters^ filters, [Optional] ObstacleContext^ obstacles);
+
 			//RenderBuffer^ GetRenderBuffer();
 
 			/// <summary>
@@ -135,6 +159,9 @@ namespace PhysX
 			/// <summary></summary>
 			property Object^ UserData;
 
+		private:
+			void PrepareMove(array<Controller^>^ controllers, array<Vector3>^ displacements, array<ControllerMoveResult>^ results, TimeSpan elapsedTime, float minimumDistance, ControllerFilters^ filters, ObstacleContext^ obstacles, ControllerMoveBatch& batch);
+
 		internal:
 			property PxControllerManager* UnmanagedPointer
 			{
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CharacterEnum.h"
+
+using namespace System::Runtime::InteropServices;
+
+namespace PhysX
+{
+	/// <summary>
+	/// The outcome of moving a controller with ControllerManager.MoveAll.
+	/// </summary>
+	[StructLayout(LayoutKind::Sequential)]
+	public value class ControllerMoveResult
+	{
+	public:
+		/// <summary>
+		/// Gets or sets the sides the controller collided with during the move.
+		/// </summary>
+		property ControllerCollisionFlag CollisionFlags;
+
+		/// <summary>
+		/// Gets or sets the foot position of the controller after the move.
+		/// </summary>
+		property Vector3 FootPosition;
+	};
+};
\ No newline at end of file
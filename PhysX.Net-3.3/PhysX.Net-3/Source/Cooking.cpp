@@ -2,8 +2,10 @@
 #include "Cooking.h"
 #include "Foundation.h"
 #include "TriangleMeshDesc.h"
+#include "StridedTriangleMeshDesc.h"
 #include "ConvexMeshDesc.h"
 #include "ClothMeshDesc.h"
+#include "StreamOutputStream.h"
 
 Cooking::Cooking(PxCooking* cooking, PhysX::Foundation^ owner)
 {
@@ -42,48 +44,53 @@ bool Cooking::CookTriangleMesh(TriangleMeshDesc^ desc, System::IO::Stream^ strea
 	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
 	ThrowIfNull(stream, "stream");
 
-	PxTriangleMeshDesc d = TriangleMeshDesc::ToUnmanaged(desc);
+	// Cooked data is written straight through to the managed stream
+	StreamOutputStream cookedStream(stream);
 
-	if(!d.isValid())
-		throw gcnew ArgumentException("The triangle mesh description is invalid");
+	bool result = CookTriangleMesh(_cooking, desc, cookedStream);
 
-	PxDefaultMemoryOutputStream cookedStream;
-	bool result = _cooking->cookTriangleMesh(d, cookedStream);
+	// Don't leave a partial mesh in the caller's stream
+	if (!result)
+		cookedStream.discard();
 
-	// Copy the cooked data into the managed stream (only if the cooked stream actually has data)
-	if (result)
-		Util::CopyIntoStream(&cookedStream, stream);
-
-	delete[] d.points.data;
-	delete[] d.triangles.data;
-	delete[] d.materialIndices.data;
+	cookedStream.flush();
 
 	return result;
 }
 
-ConvexMeshCookingResult Cooking::CookConvexMesh(ConvexMeshDesc^ desc, System::IO::Stream^ stream)
+bool Cooking::CookTriangleMesh(StridedTriangleMeshDesc^ desc, System::IO::Stream^ stream)
 {
 	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
 	ThrowIfNull(stream, "stream");
 
-	PxConvexMeshDesc d = ConvexMeshDesc::ToUnmanaged(desc);
+	StreamOutputStream cookedStream(stream);
 
-	if(!d.isValid())
-		throw gcnew ArgumentException("The convex mesh description is invalid");
+	bool result = CookTriangleMesh(_cooking, desc, cookedStream);
 
-	PxConvexMeshCookingResult::Enum result;
+	// Don't leave a partial mesh in the caller's stream
+	if (!result)
+		cookedStream.discard();
 
-	PxDefaultMemoryOutputStream cookedStream;
-	_cooking->cookConvexMesh(d, cookedStream, &result);
+	cookedStream.flush();
 
-	// Copy the cooked data into the managed stream (only if the cooked stream actually has data)
-	if (result == PxConvexMeshCookingResult::eSUCCESS)
-		Util::CopyIntoStream(&cookedStream, stream);
+	return result;
+}
 
-	delete[] d.points.data;
-	delete[] d.triangles.data;
+ConvexMeshCookingResult Cooking::CookConvexMesh(ConvexMeshDesc^ desc, System::IO::Stream^ stream)
+{
+	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
+	ThrowIfNull(stream, "stream");
+
+	StreamOutputStream cookedStream(stream);
+
+	ConvexMeshCookingResult result = CookConvexMesh(_cooking, desc, cookedStream);
+
+	if (result != ConvexMeshCookingResult::Success)
+		cookedStream.discard();
 
-	return ToManagedEnum(ConvexMeshCookingResult, result);
+	cookedStream.flush();
+
+	return result;
 }
 
 void Cooking::CookClothFabric(ClothMeshDesc^ desc, Vector3 gravityDirection, System::IO::Stream^ stream)
@@ -91,23 +98,95 @@ void Cooking::CookClothFabric(ClothMeshDesc^ desc, Vector3 gravityDirection, Sys
 	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
 	ThrowIfNull(stream, "stream");
 
-	PxClothMeshDesc d = ClothMeshDesc::ToUnmanaged(desc);
-	PxVec3 g = UV(gravityDirection);
+	StreamOutputStream cookedStream(stream);
+
+	CookClothFabric(desc, gravityDirection, cookedStream);
+
+	cookedStream.flush();
+}
 
-	if (!d.isValid())
-		throw gcnew ArgumentException("The cloth mesh description is invalid");
+bool Cooking::CookTriangleMesh(PxCooking* cooking, TriangleMeshDesc^ desc, PxOutputStream& stream)
+{
+	// Cook straight from the descriptor's arrays rather than copying them
+	return CookTriangleMesh(cooking, StridedTriangleMeshDesc::FromDesc(desc), stream);
+}
+bool Cooking::CookTriangleMesh(PxCooking* cooking, StridedTriangleMeshDesc^ desc, PxOutputStream& stream)
+{
+	GCHandle points, triangles, materialIndices;
+
+	try
+	{
+		PxTriangleMeshDesc d;
+		d.flags = ToUnmanagedEnum(PxMeshFlag, desc->Flags);
+		d.convexEdgeThreshold = desc->ConvexEdgeThreshold;
+
+		int indexSize = d.flags.isSet(PxMeshFlag::e16_BIT_INDICES) ? sizeof(PxU16) : sizeof(PxU32);
+
+		d.points = desc->Points.ToUnmanaged(points, sizeof(PxVec3));
+		d.triangles = desc->Triangles.ToUnmanaged(triangles, indexSize * 3);
+
+		PxBoundedData m = desc->MaterialIndices.ToUnmanaged(materialIndices, sizeof(PxMaterialTableIndex));
+		d.materialIndices.data = (const PxMaterialTableIndex*)m.data;
+		d.materialIndices.stride = m.stride;
+
+		if(!d.isValid())
+			throw gcnew ArgumentException("The triangle mesh description is invalid");
+
+		return cooking->cookTriangleMesh(d, stream);
+	}
+	finally
+	{
+		if (points.IsAllocated)
+			points.Free();
+		if (triangles.IsAllocated)
+			triangles.Free();
+		if (materialIndices.IsAllocated)
+			materialIndices.Free();
+	}
+}
 
-	PxClothFabricCooker* clothCooker = new PxClothFabricCooker(d, g);
+ConvexMeshCookingResult Cooking::CookConvexMesh(PxCooking* cooking, ConvexMeshDesc^ desc, PxOutputStream& stream)
+{
+	PxConvexMeshDesc d = ConvexMeshDesc::ToUnmanaged(desc);
 
-	PxDefaultMemoryOutputStream cookedStream;
-	clothCooker->save(cookedStream, false);
+	try
+	{
+		if(!d.isValid())
+			throw gcnew ArgumentException("The convex mesh description is invalid");
+
+		PxConvexMeshCookingResult::Enum result;
+		cooking->cookConvexMesh(d, stream, &result);
+
+		return ToManagedEnum(ConvexMeshCookingResult, result);
+	}
+	finally
+	{
+		delete[] d.points.data;
+		delete[] d.triangles.data;
+	}
+}
 
-	Util::CopyIntoStream(&cookedStream, stream);
+void Cooking::CookClothFabric(ClothMeshDesc^ desc, Vector3 gravityDirection, PxOutputStream& stream)
+{
+	PxClothMeshDesc d = ClothMeshDesc::ToUnmanaged(desc);
+	PxVec3 g = UV(gravityDirection);
 
-	delete[] d.points.data;
-	delete[] d.triangles.data;
-	delete[] d.quads.data;
-	delete[] d.invMasses.data;
+	try
+	{
+		if (!d.isValid())
+			throw gcnew ArgumentException("The cloth mesh description is invalid");
+
+		PxClothFabricCooker clothCooker(d, g);
+
+		clothCooker.save(stream, false);
+	}
+	finally
+	{
+		delete[] d.points.data;
+		delete[] d.triangles.data;
+		delete[] d.quads.data;
+		delete[] d.invMasses.data;
+	}
 }
 
 //
@@ -7,6 +7,7 @@ namespace PhysX
 {
 	ref class Foundation;
 	ref class TriangleMeshDesc;
+	ref class StridedTriangleMeshDesc;
 	ref class ConvexMeshDesc;
 	ref class ClothMeshDesc;
 
@@ -40,9 +41,23 @@ namespace PhysX
 			/// performing collision detection at runtime.
 			/// </summary>
 			/// <param name="desc">The triangle mesh descriptor to read the mesh from.</param>
-			/// <param name="stream">User stream to output the cooked data.</param>
+			/// <param name="stream">
+			/// User stream to output the cooked data. The data is written as it is cooked; if cooking fails a seekable stream is
+			/// truncated back to its starting position, but a non-seekable stream may be left holding partial output.
+			/// </param>
 			bool CookTriangleMesh(TriangleMeshDesc^ desc, System::IO::Stream^ stream);
 
+			/// <summary>
+			/// Cooks a triangle mesh read in place from native memory or pinned managed arrays. The results are written to the stream.
+			/// Use this to cook large or interleaved vertex buffers without first copying them into a TriangleMeshDesc.
+			/// </summary>
+			/// <param name="desc">The strided triangle mesh descriptor to read the mesh from.</param>
+			/// <param name="stream">
+			/// User stream to output the cooked data. The data is written as it is cooked; if cooking fails a seekable stream is
+			/// truncated back to its starting position, but a non-seekable stream may be left holding partial output.
+			/// </param>
+			bool CookTriangleMesh(StridedTriangleMeshDesc^ desc, System::IO::Stream^ stream);
+
 			/// <summary>
 			/// Cooks a convex mesh. The results are written to the stream.
 			/// To create a triangle mesh object it is necessary to first 'cook' the mesh data into a form which allows the
@@ -51,7 +66,10 @@ namespace PhysX
 			/// performing collision detection at runtime.
 			/// </summary>
 			/// <param name="desc">The convex mesh descriptor to read the mesh from.</param>
-			/// <param name="stream">User stream to output the cooked data.</param>
+			/// <param name="stream">
+			/// User stream to output the cooked data. The data is written as it is cooked; if cooking fails a seekable stream is
+			/// truncated back to its starting position, but a non-seekable stream may be left holding partial output.
+			/// </param>
 			ConvexMeshCookingResult CookConvexMesh(ConvexMeshDesc^ desc, System::IO::Stream^ stream);
 
 			/// <summary>
@@ -79,6 +97,13 @@ namespace PhysX
 			}
 
 		internal:
+			// Cook with any PxCooking instance (e.g. one per worker thread) to any PhysX output stream.
+			// The descriptor is converted, validated and its unmanaged copy freed (triangle meshes are read in place).
+			static bool CookTriangleMesh(PxCooking* cooking, TriangleMeshDesc^ desc, PxOutputStream& stream);
+			static bool CookTriangleMesh(PxCooking* cooking, StridedTriangleMeshDesc^ desc, PxOutputStream& stream);
+			static ConvexMeshCookingResult CookConvexMesh(PxCooking* cooking, ConvexMeshDesc^ desc, PxOutputStream& stream);
+			static void CookClothFabric(ClothMeshDesc^ desc, Vector3 gravityDirection, PxOutputStream& stream);
+
 			property PxCooking* UnmanagedPointer
 			{
 				PxCooking* get();
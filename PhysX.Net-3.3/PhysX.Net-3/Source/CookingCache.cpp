@@ -0,0 +1,382 @@
+#include "StdAfx.h"
+#include "CookingCache.h"
+#include "Physics.h"
+#include "Cooking.h"
+#include "CookingParams.h"
+#include "TriangleMesh.h"
+#include "TriangleMeshDesc.h"
+#include "ConvexMesh.h"
+#include "ConvexMeshDesc.h"
+#include "ClothFabric.h"
+#include "ClothMeshDesc.h"
+#include "FailedToCreateObjectException.h"
+
+using namespace System::IO;
+using namespace System::Security::Cryptography;
+
+// Hashes descriptor data in place (from pinned memory), through a small staging buffer
+private ref class CookingCacheKeyBuilder
+{
+private:
+	SHA256^ _sha;
+	array<Byte>^ _buffer;
+	MemoryStream^ _header;
+	BinaryWriter^ _writer;
+
+public:
+	CookingCacheKeyBuilder(String^ kind)
+	{
+		_sha = SHA256::Create();
+		_buffer = gcnew array<Byte>(64 * 1024);
+		_header = gcnew MemoryStream();
+		_writer = gcnew BinaryWriter(_header);
+
+		_writer->Write(kind);
+		_writer->Write((int)PX_PHYSICS_VERSION);
+	}
+
+	property BinaryWriter^ Writer
+	{
+		BinaryWriter^ get() { return _writer; }
+	}
+
+	void AppendParams(CookingParams^ p)
+	{
+		_writer->Write((int)p->TargetPlatform);
+		_writer->Write(p->SkinWidth);
+		_writer->Write(p->SuppressTriangleMeshRemapTable);
+		_writer->Write(p->Scale.Length);
+		_writer->Write(p->Scale.Mass);
+		_writer->Write(p->Scale.Speed);
+		_writer->Write(p->BuildTriangleAdjacencies);
+		_writer->Write((int)p->MeshPreprocessParams);
+		_writer->Write((int)p->MeshCookingHint);
+		_writer->Write(p->MeshWeldTolerance);
+		_writer->Write(p->MeshSizePerformanceTradeOff);
+		_writer->Write(p->AreaTestEpsilon);
+	}
+
+	void AppendArray(Array^ data, int elementSize)
+	{
+		// The length is part of the key so that adjacent arrays can't alias each other
+		_writer->Write(data == nullptr ? -1 : data->Length);
+
+		if (data == nullptr || data->Length == 0)
+			return;
+
+		GCHandle handle = GCHandle::Alloc(data, GCHandleType::Pinned);
+		try
+		{
+			Byte* p = (Byte*)handle.AddrOfPinnedObject().ToPointer();
+			__int64 remaining = (__int64)data->Length * elementSize;
+
+			while (remaining > 0)
+			{
+				int n = (int)Math::Min(remaining, (__int64)_buffer->Length);
+
+				Marshal::Copy(IntPtr(p), _buffer, 0, n);
+				_sha->TransformBlock(_buffer, 0, n, nullptr, 0);
+
+				p += n;
+				remaining -= n;
+			}
+		}
+		finally
+		{
+			handle.Free();
+		}
+	}
+
+	String^ Finish()
+	{
+		_writer->Flush();
+
+		_sha->TransformFinalBlock(_header->GetBuffer(), 0, (int)_header->Length);
+
+		return BitConverter::ToString(_sha->Hash)->Replace("-", "")->ToLowerInvariant();
+	}
+};
+
+CookingCache::CookingCache(PhysX::Physics^ physics, PhysX::Cooking^ cooking, String^ directory)
+{
+	ThrowIfNullOrDisposed(physics, "physics");
+	ThrowIfNullOrDisposed(cooking, "cooking");
+	ThrowIfNull(directory, "directory");
+
+	_physics = physics;
+	_cooking = cooking;
+	_directory = Path::GetFullPath(directory);
+	_index = gcnew Dictionary<String^, String^>();
+
+	System::IO::Directory::CreateDirectory(_directory);
+
+	LoadIndex();
+}
+
+TriangleMesh^ CookingCache::CreateTriangleMesh(TriangleMeshDesc^ desc)
+{
+	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
+
+	String^ key = ComputeKey(desc);
+	String^ filename = GetCachedFilename(key);
+
+	if (filename != nullptr)
+	{
+		_hits++;
+	}
+	else
+	{
+		_misses++;
+
+		String^ temp = CreateTempFilename();
+		bool result;
+		{
+			FileStream^ stream = gcnew FileStream(temp, FileMode::Create, FileAccess::Write);
+			try
+			{
+				result = _cooking->CookTriangleMesh(desc, stream);
+			}
+			finally
+			{
+				delete stream;
+			}
+		}
+
+		if (!result)
+		{
+			File::Delete(temp);
+			throw gcnew FailedToCreateObjectException("Failed to cook the triangle mesh");
+		}
+
+		filename = Add(key, "TriangleMesh", temp);
+	}
+
+	return _physics->CreateTriangleMesh(filename);
+}
+
+ConvexMesh^ CookingCache::CreateConvexMesh(ConvexMeshDesc^ desc)
+{
+	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
+
+	String^ key = ComputeKey(desc);
+	String^ filename = GetCachedFilename(key);
+
+	if (filename != nullptr)
+	{
+		_hits++;
+	}
+	else
+	{
+		_misses++;
+
+		String^ temp = CreateTempFilename();
+		ConvexMeshCookingResult result;
+		{
+			FileStream^ stream = gcnew FileStream(temp, FileMode::Create, FileAccess::Write);
+			try
+			{
+				result = _cooking->CookConvexMesh(desc, stream);
+			}
+			finally
+			{
+				delete stream;
+			}
+		}
+
+		if (result != ConvexMeshCookingResult::Success)
+		{
+			File::Delete(temp);
+			throw gcnew FailedToCreateObjectException("Failed to cook the convex mesh ({0})", result);
+		}
+
+		filename = Add(key, "ConvexMesh", temp);
+	}
+
+	return _physics->CreateConvexMesh(filename);
+}
+
+ClothFabric^ CookingCache::CreateClothFabric(ClothMeshDesc^ desc, Vector3 gravityDirection)
+{
+	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
+
+	String^ key = ComputeKey(desc, gravityDirection);
+	String^ filename = GetCachedFilename(key);
+
+	if (filename != nullptr)
+	{
+		_hits++;
+	}
+	else
+	{
+		_misses++;
+
+		String^ temp = CreateTempFilename();
+		{
+			FileStream^ stream = gcnew FileStream(temp, FileMode::Create, FileAccess::Write);
+			try
+			{
+				_cooking->CookClothFabric(desc, gravityDirection, stream);
+			}
+			finally
+			{
+				delete stream;
+			}
+		}
+
+		filename = Add(key, "ClothFabric", temp);
+	}
+
+	return _physics->CreateClothFabric(filename);
+}
+
+void CookingCache::Clear()
+{
+	for each(String^ key in _index->Keys)
+	{
+		File::Delete(Path::Combine(_directory, key + ".bin"));
+	}
+
+	_index->Clear();
+	File::Delete(Path::Combine(_directory, IndexFilename));
+
+	_hits = 0;
+	_misses = 0;
+}
+
+String^ CookingCache::GetCachedFilename(String^ key)
+{
+	ThrowIfNull(key, "key");
+
+	if (!_index->ContainsKey(key))
+		return nullptr;
+
+	String^ filename = Path::Combine(_directory, key + ".bin");
+
+	// The entry may have been removed from disk behind our back
+	if (!File::Exists(filename))
+	{
+		_index->Remove(key);
+		return nullptr;
+	}
+
+	return filename;
+}
+
+String^ CookingCache::ComputeKey(TriangleMeshDesc^ desc)
+{
+	ThrowIfNull(desc, "desc");
+
+	auto key = gcnew CookingCacheKeyBuilder("TriangleMesh");
+
+	key->AppendParams(_cooking->Parameters);
+	key->Writer->Write((int)desc->Flags);
+	key->Writer->Write(desc->ConvexEdgeThreshold);
+
+	key->AppendArray(desc->Points, sizeof(Vector3));
+	key->AppendArray(desc->Triangles, desc->Is16BitTriangleIndices().GetValueOrDefault(false) ? sizeof(short) : sizeof(int));
+	key->AppendArray(desc->MaterialIndices, sizeof(short));
+
+	return key->Finish();
+}
+String^ CookingCache::ComputeKey(ConvexMeshDesc^ desc)
+{
+	ThrowIfNull(desc, "desc");
+
+	auto key = gcnew CookingCacheKeyBuilder("ConvexMesh");
+
+	key->AppendParams(_cooking->Parameters);
+	key->Writer->Write((int)desc->Flags);
+
+	key->AppendArray(desc->GetPositions(), sizeof(Vector3));
+	if (desc->Is16BitTriangles)
+		key->AppendArray(desc->GetTriangles<short>(), sizeof(short));
+	else
+		key->AppendArray(desc->GetTriangles<int>(), sizeof(int));
+
+	return key->Finish();
+}
+String^ CookingCache::ComputeKey(ClothMeshDesc^ desc, Vector3 gravityDirection)
+{
+	ThrowIfNull(desc, "desc");
+
+	// Fabric cooking does not use the cooking parameters
+	auto key = gcnew CookingCacheKeyBuilder("ClothFabric");
+
+	key->Writer->Write((int)desc->Flags);
+	key->Writer->Write(gravityDirection.X);
+	key->Writer->Write(gravityDirection.Y);
+	key->Writer->Write(gravityDirection.Z);
+
+	key->AppendArray(desc->Points, sizeof(Vector3));
+	key->AppendArray(desc->InverseMasses, sizeof(float));
+	key->AppendArray(desc->Quads, sizeof(Byte));
+	key->AppendArray(desc->Triangles, sizeof(Byte));
+
+	return key->Finish();
+}
+
+String^ CookingCache::Add(String^ key, String^ kind, String^ tempFilename)
+{
+	String^ filename = Path::Combine(_directory, key + ".bin");
+
+	// Content addressed, so an existing file with the same name already holds the same data
+	if (File::Exists(filename))
+		File::Delete(tempFilename);
+	else
+		File::Move(tempFilename, filename);
+
+	_index[key] = kind;
+
+	File::AppendAllText(Path::Combine(_directory, IndexFilename), String::Format("{0} {1}{2}", key, kind, Environment::NewLine));
+
+	return filename;
+}
+
+String^ CookingCache::CreateTempFilename()
+{
+	return Path::Combine(_directory, Guid::NewGuid().ToString("N") + ".tmp");
+}
+
+void CookingCache::LoadIndex()
+{
+	String^ indexFilename = Path::Combine(_directory, IndexFilename);
+
+	if (!File::Exists(indexFilename))
+		return;
+
+	for each(String^ line in File::ReadAllLines(indexFilename))
+	{
+		array<String^>^ parts = line->Split(' ');
+		if (parts->Length != 2)
+			continue;
+
+		if (File::Exists(Path::Combine(_directory, parts[0] + ".bin")))
+			_index[parts[0]] = parts[1];
+	}
+}
+
+PhysX::Physics^ CookingCache::Physics::get()
+{
+	return _physics;
+}
+PhysX::Cooking^ CookingCache::Cooking::get()
+{
+	return _cooking;
+}
+String^ CookingCache::Directory::get()
+{
+	return _directory;
+}
+
+int CookingCache::Hits::get()
+{
+	return _hits;
+}
+int CookingCache::Misses::get()
+{
+	return _misses;
+}
+int CookingCache::Count::get()
+{
+	return _index->Count;
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CookingEnum.h"
+
+namespace PhysX
+{
+	ref class Physics;
+	ref class Cooking;
+	ref class TriangleMesh;
+	ref class TriangleMeshDesc;
+	ref class ConvexMesh;
+	ref class ConvexMeshDesc;
+	ref class ClothFabric;
+	ref class ClothMeshDesc;
+
+	/// <summary>
+	/// A content addressed, on disk cache of cooked meshes and cloth fabrics.
+	/// The descriptor data, the cooking parameters and the PhysX version are hashed together to name each cooked blob.
+	/// On a hit the object is created straight from the (memory mapped) cached file without cooking.
+	/// </summary>
+	/// <remarks>
+	/// Height fields are not cooked in PhysX 3.3 (they are created directly from a HeightFieldDesc), so are not cached.
+	/// This class is not thread safe.
+	/// </remarks>
+	public ref class CookingCache
+	{
+	private:
+		literal String^ IndexFilename = "index.txt";
+
+		Physics^ _physics;
+		Cooking^ _cooking;
+		String^ _directory;
+
+		// Hash -> kind of the cooked blob
+		Dictionary<String^, String^>^ _index;
+
+		int _hits;
+		int _misses;
+
+	public:
+		/// <summary>
+		/// Creates a cooking cache which stores cooked data in the specified directory.
+		/// The directory is created if it does not exist, and an existing index is loaded from it.
+		/// </summary>
+		/// <param name="physics">The physics instance used to create the objects.</param>
+		/// <param name="cooking">The cooking instance used on a cache miss. Its parameters are part of the cache key.</param>
+		/// <param name="directory">The directory to store the cooked data in.</param>
+		CookingCache(PhysX::Physics^ physics, PhysX::Cooking^ cooking, String^ directory);
+
+		/// <summary>
+		/// Gets a triangle mesh for the descriptor, either from the cache or by cooking (and caching) it.
+		/// </summary>
+		TriangleMesh^ CreateTriangleMesh(TriangleMeshDesc^ desc);
+
+		/// <summary>
+		/// Gets a convex mesh for the descriptor, either from the cache or by cooking (and caching) it.
+		/// </summary>
+		ConvexMesh^ CreateConvexMesh(ConvexMeshDesc^ desc);
+
+		/// <summary>
+		/// Gets a cloth fabric for the descriptor, either from the cache or by cooking (and caching) it.
+		/// </summary>
+		ClothFabric^ CreateClothFabric(ClothMeshDesc^ desc, Vector3 gravityDirection);
+
+		/// <summary>
+		/// Deletes all cached data and resets the hit and miss counters.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Gets the path of the cached file for a key, or null if the key is not in the cache.
+		/// Does not affect the hit and miss counters.
+		/// </summary>
+		String^ GetCachedFilename(String^ key);
+
+		/// <summary>
+		/// Computes the cache key of a triangle mesh descriptor with the current cooking parameters.
+		/// </summary>
+		String^ ComputeKey(TriangleMeshDesc^ desc);
+		/// <summary>
+		/// Computes the cache key of a convex mesh descriptor with the current cooking parameters.
+		/// </summary>
+		String^ ComputeKey(ConvexMeshDesc^ desc);
+		/// <summary>
+		/// Computes the cache key of a cloth mesh descriptor and gravity direction.
+		/// </summary>
+		String^ ComputeKey(ClothMeshDesc^ desc, Vector3 gravityDirection);
+
+		property PhysX::Physics^ Physics
+		{
+			PhysX::Physics^ get();
+		}
+		property PhysX::Cooking^ Cooking
+		{
+			PhysX::Cooking^ get();
+		}
+		property String^ Directory
+		{
+			String^ get();
+		}
+
+		/// <summary>
+		/// Gets the number of objects created from the cache without cooking.
+		/// </summary>
+		property int Hits
+		{
+			int get();
+		}
+		/// <summary>
+		/// Gets the number of objects which had to be cooked.
+		/// </summary>
+		property int Misses
+		{
+			int get();
+		}
+		/// <summary>
+		/// Gets the number of cooked blobs in the cache.
+		/// </summary>
+		property int Count
+		{
+			int get();
+		}
+
+	private:
+		String^ Add(String^ key, String^ kind, String^ tempFilename);
+		String^ CreateTempFilename();
+		void LoadIndex();
+	};
+};
\ No newline at end of file
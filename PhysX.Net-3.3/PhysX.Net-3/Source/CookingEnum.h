@@ -86,4 +86,17 @@
 		ZeroAreaTestFailed = PxConvexMeshCookingResult::eZERO_AREA_TEST_FAILED,
 		Failure = PxConvexMeshCookingResult::eFAILURE
 	};
+
+	/// <summary>
+	/// The order in which a CookingService picks up queued jobs. Higher priority jobs are always started first.
+	/// </summary>
+	public enum class CookingPriority
+	{
+		Low = 0,
+		Normal = 1,
+		/// <summary>
+		/// For assets needed immediately, e.g. streaming in around the player.
+		/// </summary>
+		High = 2
+	};
  };
\ No newline at end of file
@@ -0,0 +1,407 @@
+#include "StdAfx.h"
+#include "CookingService.h"
+#include "Physics.h"
+#include "Cooking.h"
+#include "TriangleMesh.h"
+#include "TriangleMeshDesc.h"
+#include "ConvexMesh.h"
+#include "ConvexMeshDesc.h"
+#include "HeightField.h"
+#include "HeightFieldDesc.h"
+#include "ClothFabric.h"
+#include "ClothMeshDesc.h"
+
+namespace PhysX
+{
+	ref class CookingJob abstract
+	{
+	public:
+		CookingPriority Priority;
+
+		// Cook with the worker's PxCooking instance, then create the object in the physics instance
+		virtual void Run(PxCooking* cooking, PhysX::Physics^ physics) abstract;
+		virtual void Cancel() abstract;
+	};
+
+	generic<typename T>
+	ref class CookingJobOf abstract : CookingJob
+	{
+	private:
+		TaskCompletionSource<T>^ _completion;
+
+	protected:
+		CookingJobOf()
+		{
+			// Don't run the caller's continuations on the worker thread
+			_completion = gcnew TaskCompletionSource<T>(TaskCreationOptions::RunContinuationsAsynchronously);
+		}
+
+		virtual T Execute(PxCooking* cooking, PhysX::Physics^ physics) abstract;
+
+	public:
+		property Task<T>^ Result
+		{
+			Task<T>^ get() { return _completion->Task; }
+		}
+
+		virtual void Run(PxCooking* cooking, PhysX::Physics^ physics) override
+		{
+			try
+			{
+				_completion->SetResult(Execute(cooking, physics));
+			}
+			catch (Exception^ ex)
+			{
+				_completion->SetException(ex);
+			}
+		}
+		virtual void Cancel() override
+		{
+			_completion->TrySetCanceled();
+		}
+	};
+
+	ref class TriangleMeshCookingJob : CookingJobOf<TriangleMesh^>
+	{
+	private:
+		TriangleMeshDesc^ _desc;
+
+	public:
+		TriangleMeshCookingJob(TriangleMeshDesc^ desc) : _desc(desc) { }
+
+	protected:
+		virtual TriangleMesh^ Execute(PxCooking* cooking, PhysX::Physics^ physics) override
+		{
+			PxDefaultMemoryOutputStream cooked;
+
+			if (!Cooking::CookTriangleMesh(cooking, _desc, cooked))
+				throw gcnew OperationFailedException("Failed to cook the triangle mesh");
+
+			PxDefaultMemoryInputData in(cooked.getData(), cooked.getSize());
+
+			Monitor::Enter(physics);
+			try
+			{
+				return physics->CreateTriangleMesh(in);
+			}
+			finally
+			{
+				Monitor::Exit(physics);
+			}
+		}
+	};
+
+	ref class ConvexMeshCookingJob : CookingJobOf<ConvexMesh^>
+	{
+	private:
+		ConvexMeshDesc^ _desc;
+
+	public:
+		ConvexMeshCookingJob(ConvexMeshDesc^ desc) : _desc(desc) { }
+
+	protected:
+		virtual ConvexMesh^ Execute(PxCooking* cooking, PhysX::Physics^ physics) override
+		{
+			PxDefaultMemoryOutputStream cooked;
+
+			ConvexMeshCookingResult result = Cooking::CookConvexMesh(cooking, _desc, cooked);
+			if (result != ConvexMeshCookingResult::Success)
+				throw gcnew OperationFailedException("Failed to cook the convex mesh ({0})", result);
+
+			PxDefaultMemoryInputData in(cooked.getData(), cooked.getSize());
+
+			Monitor::Enter(physics);
+			try
+			{
+				return physics->CreateConvexMesh(in);
+			}
+			finally
+			{
+				Monitor::Exit(physics);
+			}
+		}
+	};
+
+	ref class HeightFieldCookingJob : CookingJobOf<HeightField^>
+	{
+	private:
+		HeightFieldDesc^ _desc;
+
+	public:
+		HeightFieldCookingJob(HeightFieldDesc^ desc) : _desc(desc) { }
+
+	protected:
+		virtual HeightField^ Execute(PxCooking* cooking, PhysX::Physics^ physics) override
+		{
+			GCHandle pin;
+			try
+			{
+				PxHeightFieldDesc d = HeightFieldDesc::ToUnmanaged(_desc, pin);
+
+				if (!d.isValid())
+					throw gcnew ArgumentException("The height field description is invalid");
+
+				Monitor::Enter(physics);
+				try
+				{
+					return physics->CreateHeightField(d);
+				}
+				finally
+				{
+					Monitor::Exit(physics);
+				}
+			}
+			finally
+			{
+				if (pin.IsAllocated)
+					pin.Free();
+			}
+		}
+	};
+
+	ref class ClothFabricCookingJob : CookingJobOf<ClothFabric^>
+	{
+	private:
+		ClothMeshDesc^ _desc;
+		Vector3 _gravityDirection;
+
+	public:
+		ClothFabricCookingJob(ClothMeshDesc^ desc, Vector3 gravityDirection) : _desc(desc), _gravityDirection(gravityDirection) { }
+
+	protected:
+		virtual ClothFabric^ Execute(PxCooking* cooking, PhysX::Physics^ physics) override
+		{
+			PxDefaultMemoryOutputStream cooked;
+
+			Cooking::CookClothFabric(_desc, _gravityDirection, cooked);
+
+			PxDefaultMemoryInputData in(cooked.getData(), cooked.getSize());
+
+			Monitor::Enter(physics);
+			try
+			{
+				return physics->CreateClothFabric(in);
+			}
+			finally
+			{
+				Monitor::Exit(physics);
+			}
+		}
+	};
+};
+
+CookingService::CookingService(PhysX::Physics^ physics, [Optional] CookingParams^ parameters, [Optional] int workerCount)
+{
+	ThrowIfNullOrDisposed(physics, "physics");
+
+	_physics = physics;
+
+	PxPhysics* p = physics->UnmanagedPointer;
+	_params = new PxCookingParams(parameters == nullptr ? PxCookingParams(p->getTolerancesScale()) : CookingParams::ToUnmanaged(parameters));
+
+	_queues = gcnew array<Queue<CookingJob^>^>(3);
+	for (int i = 0; i < _queues->Length; i++)
+		_queues[i] = gcnew Queue<CookingJob^>();
+
+	_queueLock = gcnew Object();
+	_pendingJobs = 0;
+	_stopping = false;
+
+	if (workerCount <= 0)
+		workerCount = Environment::ProcessorCount;
+
+	_workers = gcnew array<Thread^>(workerCount);
+	for (int i = 0; i < workerCount; i++)
+	{
+		Thread^ worker = gcnew Thread(gcnew ThreadStart(this, &CookingService::WorkerMain));
+		worker->Name = String::Format("PhysX Cooking Worker {0}", i);
+		worker->IsBackground = true;
+		worker->Start();
+
+		_workers[i] = worker;
+	}
+
+	ObjectTable::AddObjectOwner(this, physics);
+}
+CookingService::~CookingService()
+{
+	this->!CookingService();
+}
+CookingService::!CookingService()
+{
+	OnDisposing(this, nullptr);
+
+	if (Disposed)
+		return;
+
+	// Cancel everything not yet started, and let the workers finish their current job
+	Monitor::Enter(_queueLock);
+	try
+	{
+		_stopping = true;
+
+		for each(Queue<CookingJob^>^ queue in _queues)
+		{
+			for each(CookingJob^ job in queue)
+				job->Cancel();
+
+			Interlocked::Add(_pendingJobs, -queue->Count);
+			queue->Clear();
+		}
+
+		Monitor::PulseAll(_queueLock);
+	}
+	finally
+	{
+		Monitor::Exit(_queueLock);
+	}
+
+	for each(Thread^ worker in _workers)
+		worker->Join();
+
+	SAFE_DELETE(_params);
+	_physics = nullptr;
+
+	OnDisposed(this, nullptr);
+}
+bool CookingService::Disposed::get()
+{
+	return (_physics == nullptr);
+}
+
+Task<TriangleMesh^>^ CookingService::CookTriangleMesh(TriangleMeshDesc^ desc, [Optional] CookingPriority priority)
+{
+	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
+
+	auto job = gcnew TriangleMeshCookingJob(desc);
+	job->Priority = priority;
+
+	Enqueue(job);
+
+	return job->Result;
+}
+
+Task<ConvexMesh^>^ CookingService::CookConvexMesh(ConvexMeshDesc^ desc, [Optional] CookingPriority priority)
+{
+	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
+
+	auto job = gcnew ConvexMeshCookingJob(desc);
+	job->Priority = priority;
+
+	Enqueue(job);
+
+	return job->Result;
+}
+
+Task<HeightField^>^ CookingService::CreateHeightField(HeightFieldDesc^ desc, [Optional] CookingPriority priority)
+{
+	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
+
+	auto job = gcnew HeightFieldCookingJob(desc);
+	job->Priority = priority;
+
+	Enqueue(job);
+
+	return job->Result;
+}
+
+Task<ClothFabric^>^ CookingService::CookClothFabric(ClothMeshDesc^ desc, Vector3 gravityDirection, [Optional] CookingPriority priority)
+{
+	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
+
+	auto job = gcnew ClothFabricCookingJob(desc, gravityDirection);
+	job->Priority = priority;
+
+	Enqueue(job);
+
+	return job->Result;
+}
+
+void CookingService::Enqueue(CookingJob^ job)
+{
+	ThrowIfThisDisposed();
+
+	int priority = (int)job->Priority;
+	if (priority < 0 || priority >= _queues->Length)
+		throw gcnew ArgumentOutOfRangeException("priority");
+
+	Monitor::Enter(_queueLock);
+	try
+	{
+		_queues[priority]->Enqueue(job);
+		Interlocked::Increment(_pendingJobs);
+
+		Monitor::Pulse(_queueLock);
+	}
+	finally
+	{
+		Monitor::Exit(_queueLock);
+	}
+}
+
+CookingJob^ CookingService::Dequeue()
+{
+	Monitor::Enter(_queueLock);
+	try
+	{
+		while (true)
+		{
+			if (_stopping)
+				return nullptr;
+
+			// Highest priority first
+			for (int i = _queues->Length - 1; i >= 0; i--)
+			{
+				if (_queues[i]->Count > 0)
+					return _queues[i]->Dequeue();
+			}
+
+			Monitor::Wait(_queueLock);
+		}
+	}
+	finally
+	{
+		Monitor::Exit(_queueLock);
+	}
+}
+
+void CookingService::WorkerMain()
+{
+	// Each worker has its own cooking instance, PxCooking is not thread safe
+	PxPhysics* physics = _physics->UnmanagedPointer;
+	PxCooking* cooking = PxCreateCooking(PX_PHYSICS_VERSION, physics->getFoundation(), *_params);
+
+	try
+	{
+		CookingJob^ job;
+		while ((job = Dequeue()) != nullptr)
+		{
+			if (cooking == NULL)
+				job->Cancel();
+			else
+				job->Run(cooking, _physics);
+
+			Interlocked::Decrement(_pendingJobs);
+		}
+	}
+	finally
+	{
+		if (cooking != NULL)
+			cooking->release();
+	}
+}
+
+PhysX::Physics^ CookingService::Physics::get()
+{
+	return _physics;
+}
+
+int CookingService::WorkerCount::get()
+{
+	return _workers->Length;
+}
+
+int CookingService::PendingJobs::get()
+{
+	return _pendingJobs;
+}
\ No newline at end of file
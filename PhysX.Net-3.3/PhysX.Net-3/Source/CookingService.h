@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CookingEnum.h"
+#include "CookingParams.h"
+
+using namespace System::Threading;
+using namespace System::Threading::Tasks;
+
+namespace PhysX
+{
+	ref class Physics;
+	ref class TriangleMesh;
+	ref class TriangleMeshDesc;
+	ref class ConvexMesh;
+	ref class ConvexMeshDesc;
+	ref class HeightField;
+	ref class HeightFieldDesc;
+	ref class ClothFabric;
+	ref class ClothMeshDesc;
+	ref class CookingJob;
+
+	/// <summary>
+	/// Cooks meshes and fabrics on a pool of worker threads, each with its own PxCooking instance.
+	/// Jobs are queued by priority and their results are returned as tasks.
+	/// </summary>
+	/// <remarks>
+	/// Cooking runs fully in parallel. Creating the resulting PhysX objects (and adding them to the ObjectTable) is
+	/// serialized by locking the Physics instance, so take the same lock when creating or disposing objects on other
+	/// threads while jobs are running.
+	/// </remarks>
+	public ref class CookingService : IDisposable
+	{
+	public:
+		/// <summary>Raised before any disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposing;
+		/// <summary>Raised once all disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposed;
+
+	private:
+		PhysX::Physics^ _physics;
+		PxCookingParams* _params;
+
+		array<Thread^>^ _workers;
+
+		// One queue per CookingPriority, guarded by _queueLock
+		array<Queue<CookingJob^>^>^ _queues;
+		Object^ _queueLock;
+		int _pendingJobs;
+		bool _stopping;
+
+	public:
+		/// <summary>
+		/// Creates a cooking service and starts its worker threads.
+		/// </summary>
+		/// <param name="physics">The physics instance the cooked objects are created in.</param>
+		/// <param name="parameters">The cooking parameters used by every worker. If null, the defaults for the tolerances scale of the physics instance are used.</param>
+		/// <param name="workerCount">The number of worker threads. If zero or less, one per processor is used.</param>
+		CookingService(PhysX::Physics^ physics, [Optional] CookingParams^ parameters, [Optional] int workerCount);
+		~CookingService();
+	protected:
+		!CookingService();
+	public:
+		property bool Disposed
+		{
+			virtual bool get();
+		}
+
+		/// <summary>
+		/// Queues a triangle mesh to be cooked and created.
+		/// </summary>
+		Task<TriangleMesh^>^ CookTriangleMesh(TriangleMeshDesc^ desc, [Optional] CookingPriority priority);
+
+		/// <summary>
+		/// Queues a convex mesh to be cooked and created.
+		/// </summary>
+		Task<ConvexMesh^>^ CookConvexMesh(ConvexMeshDesc^ desc, [Optional] CookingPriority priority);
+
+		/// <summary>
+		/// Queues a height field to be created. Height fields are not cooked, but converting the samples of a large
+		/// height field is worth moving off the calling thread.
+		/// </summary>
+		Task<HeightField^>^ CreateHeightField(HeightFieldDesc^ desc, [Optional] CookingPriority priority);
+
+		/// <summary>
+		/// Queues a cloth fabric to be cooked and created.
+		/// </summary>
+		Task<ClothFabric^>^ CookClothFabric(ClothMeshDesc^ desc, Vector3 gravityDirection, [Optional] CookingPriority priority);
+
+		/// <summary>
+		/// Gets the physics instance the cooked objects are created in.
+		/// </summary>
+		property PhysX::Physics^ Physics
+		{
+			PhysX::Physics^ get();
+		}
+
+		/// <summary>
+		/// Gets the number of worker threads.
+		/// </summary>
+		property int WorkerCount
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of jobs queued or running.
+		/// </summary>
+		property int PendingJobs
+		{
+			int get();
+		}
+
+	private:
+		void Enqueue(CookingJob^ job);
+		CookingJob^ Dequeue();
+		void WorkerMain();
+	};
+};
\ No newline at end of file
@@ -0,0 +1,238 @@
+#include "StdAfx.h"
+#include "FluidSurfaceExtractor.h"
+#include "FluidSurfaceMesher.h"
+#include "ParticleReadData.h"
+#include "ParticleFluidReadData.h"
+
+using namespace System::Threading::Tasks;
+
+FluidSurfaceExtractor::FluidSurfaceExtractor()
+{
+	_mesher = new FluidSurfaceMesher();
+
+	_cellSize = 0.1f;
+	_particleRadius = 0.3f;
+	_isoLevel = 0.5f;
+	_maximumCellsPerAxis = 256;
+	_maximumBlocks = Environment::ProcessorCount * 2;
+	_densityWeighted = true;
+}
+FluidSurfaceExtractor::~FluidSurfaceExtractor()
+{
+	this->!FluidSurfaceExtractor();
+}
+FluidSurfaceExtractor::!FluidSurfaceExtractor()
+{
+	OnDisposing(this, nullptr);
+
+	if (this->Disposed)
+		return;
+
+	SAFE_DELETE(_mesher);
+
+	OnDisposed(this, nullptr);
+}
+bool FluidSurfaceExtractor::Disposed::get()
+{
+	return (_mesher == NULL);
+}
+
+int FluidSurfaceExtractor::Extract(ParticleReadData^ data)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNullOrDisposed(data, "data");
+
+	PxParticleReadData* d = data->UnmanagedPointer;
+
+	if (d->positionBuffer.ptr() == NULL)
+		throw gcnew InvalidOperationException("The particle positions are not available, enable ParticleReadDataFlag.PositionBuffer");
+
+	FluidSurfaceParticlesUnmanaged particles;
+	particles.validParticleBitmap = d->validParticleBitmap;
+	particles.validParticleRange = (d->validParticleBitmap != NULL ? d->validParticleRange : 0);
+	particles.positions = (const PxU8*)d->positionBuffer.ptr();
+	particles.positionStride = d->positionBuffer.stride();
+	particles.densities = NULL;
+	particles.densityStride = 0;
+
+	ParticleFluidReadData^ fluid = dynamic_cast<ParticleFluidReadData^>(data);
+	if (_densityWeighted && fluid != nullptr && fluid->UnmanagedPointer->densityBuffer.ptr() != NULL)
+	{
+		particles.densities = (const PxU8*)fluid->UnmanagedPointer->densityBuffer.ptr();
+		particles.densityStride = fluid->UnmanagedPointer->densityBuffer.stride();
+	}
+
+	const int blocks = _mesher->prepare(particles, _cellSize, _particleRadius, _maximumCellsPerAxis, _maximumBlocks);
+
+	_extractIsoLevel = _isoLevel;
+
+	if (blocks > 1)
+	{
+		// Every node must be splatted before any block is polygonized, as blocks read the nodes of their neighbours
+		Parallel::For(0, blocks, gcnew Action<int>(this, &FluidSurfaceExtractor::SplatBlock));
+		Parallel::For(0, blocks, gcnew Action<int>(this, &FluidSurfaceExtractor::PolygonizeBlock));
+	}
+	else if (blocks == 1)
+	{
+		SplatBlock(0);
+		PolygonizeBlock(0);
+	}
+
+	return _mesher->getIndexCount() / 3;
+}
+
+void FluidSurfaceExtractor::SplatBlock(int block)
+{
+	_mesher->splatBlock(block);
+}
+void FluidSurfaceExtractor::PolygonizeBlock(int block)
+{
+	_mesher->polygonizeBlock(block, _extractIsoLevel);
+}
+
+void FluidSurfaceExtractor::WriteMesh(BoundedData positions, BoundedData normals, BoundedData indices)
+{
+	ThrowIfThisDisposed();
+
+	const int vertexCount = this->VertexCount;
+	const int indexCount = this->IndexCount;
+
+	if (positions.Count < vertexCount)
+		throw gcnew ArgumentOutOfRangeException("positions", String::Format("positions must hold at least {0} vertices", vertexCount));
+	if (normals.Count != 0 && normals.Count < vertexCount)
+		throw gcnew ArgumentOutOfRangeException("normals", String::Format("normals must hold at least {0} vertices", vertexCount));
+	if (indices.Count < indexCount)
+		throw gcnew ArgumentOutOfRangeException("indices", String::Format("indices must hold at least {0} indices", indexCount));
+
+	if (vertexCount == 0)
+		return;
+
+	GCHandle positionPin, normalPin, indexPin;
+
+	try
+	{
+		PxBoundedData p = positions.ToUnmanaged(positionPin, sizeof(PxVec3));
+		PxBoundedData n = normals.ToUnmanaged(normalPin, sizeof(PxVec3));
+		PxBoundedData i = indices.ToUnmanaged(indexPin, sizeof(PxU32));
+
+		_mesher->write((PxU8*)p.data, p.stride, (PxU8*)n.data, n.stride, (PxU8*)i.data, i.stride);
+	}
+	finally
+	{
+		if (positionPin.IsAllocated)
+			positionPin.Free();
+		if (normalPin.IsAllocated)
+			normalPin.Free();
+		if (indexPin.IsAllocated)
+			indexPin.Free();
+	}
+}
+void FluidSurfaceExtractor::WriteMesh(array<Vector3>^ positions, array<Vector3>^ normals, array<int>^ indices)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(positions, "positions");
+	ThrowIfNull(indices, "indices");
+
+	const int vertexCount = this->VertexCount;
+	const int indexCount = this->IndexCount;
+
+	if (positions->Length < vertexCount)
+		throw gcnew ArgumentOutOfRangeException("positions", String::Format("positions must hold at least {0} vertices", vertexCount));
+	if (normals != nullptr && normals->Length < vertexCount)
+		throw gcnew ArgumentOutOfRangeException("normals", String::Format("normals must hold at least {0} vertices", vertexCount));
+	if (indices->Length < indexCount)
+		throw gcnew ArgumentOutOfRangeException("indices", String::Format("indices must hold at least {0} indices", indexCount));
+
+	if (vertexCount == 0)
+		return;
+
+	pin_ptr<Vector3> p = &positions[0];
+	pin_ptr<Vector3> n = nullptr;
+	if (normals != nullptr)
+		n = &normals[0];
+	pin_ptr<int> i = &indices[0];
+
+	_mesher->write((PxU8*)p, sizeof(PxVec3), (PxU8*)n, sizeof(PxVec3), (PxU8*)i, sizeof(PxU32));
+}
+
+//
+
+int FluidSurfaceExtractor::VertexCount::get()
+{
+	ThrowIfThisDisposed();
+
+	return _mesher->getVertexCount();
+}
+
+int FluidSurfaceExtractor::IndexCount::get()
+{
+	ThrowIfThisDisposed();
+
+	return _mesher->getIndexCount();
+}
+
+float FluidSurfaceExtractor::CellSize::get()
+{
+	return _cellSize;
+}
+void FluidSurfaceExtractor::CellSize::set(float value)
+{
+	if (value <= 0)
+		throw gcnew ArgumentOutOfRangeException("value", "CellSize must be greater than zero");
+
+	_cellSize = value;
+}
+
+float FluidSurfaceExtractor::ParticleRadius::get()
+{
+	return _particleRadius;
+}
+void FluidSurfaceExtractor::ParticleRadius::set(float value)
+{
+	if (value <= 0)
+		throw gcnew ArgumentOutOfRangeException("value", "ParticleRadius must be greater than zero");
+
+	_particleRadius = value;
+}
+
+float FluidSurfaceExtractor::IsoLevel::get()
+{
+	return _isoLevel;
+}
+void FluidSurfaceExtractor::IsoLevel::set(float value)
+{
+	_isoLevel = value;
+}
+
+int FluidSurfaceExtractor::MaximumCellsPerAxis::get()
+{
+	return _maximumCellsPerAxis;
+}
+void FluidSurfaceExtractor::MaximumCellsPerAxis::set(int value)
+{
+	if (value < 1 || value > MaximumCellsPerAxisLimit)
+		throw gcnew ArgumentOutOfRangeException("value", String::Format("MaximumCellsPerAxis must be between 1 and {0}", MaximumCellsPerAxisLimit));
+
+	_maximumCellsPerAxis = value;
+}
+
+int FluidSurfaceExtractor::MaximumBlocks::get()
+{
+	return _maximumBlocks;
+}
+void FluidSurfaceExtractor::MaximumBlocks::set(int value)
+{
+	if (value < 1)
+		throw gcnew ArgumentOutOfRangeException("value", "MaximumBlocks must be at least one");
+
+	_maximumBlocks = value;
+}
+
+bool FluidSurfaceExtractor::DensityWeighted::get()
+{
+	return _densityWeighted;
+}
+void FluidSurfaceExtractor::DensityWeighted::set(bool value)
+{
+	_densityWeighted = value;
+}
\ No newline at end of file
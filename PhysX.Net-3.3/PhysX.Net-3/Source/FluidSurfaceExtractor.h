@@ -0,0 +1,161 @@
+#pragma once
+
+#include "BoundedData.h"
+
+class FluidSurfaceMesher;
+
+namespace PhysX
+{
+	ref class ParticleReadData;
+
+	/// <summary>
+	/// Builds an indexed triangle mesh of the surface of a particle fluid (or particle system) from its locked particle
+	/// data. The particles are splatted into a scalar field on a grid, which is polygonized with marching tetrahedra.
+	/// Both passes run natively in parallel over slabs of the grid.
+	/// </summary>
+	/// <remarks>
+	/// Call Extract with the read data, Unlock the data, then copy the mesh into vertex and index buffers with WriteMesh.
+	/// The extractor keeps its grid and mesh buffers between calls. Vertices shared between triangles are still looked
+	/// up in a hash map per slab, which allocates an entry per vertex on every extraction.
+	/// </remarks>
+	public ref class FluidSurfaceExtractor : IDisposable
+	{
+	public:
+		/// <summary>Raised before any disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposing;
+		/// <summary>Raised once all disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposed;
+
+		/// <summary>
+		/// The largest value of MaximumCellsPerAxis, which keeps the number of grid nodes within 32 bits.
+		/// </summary>
+		literal int MaximumCellsPerAxisLimit = 1600;
+
+	private:
+		FluidSurfaceMesher* _mesher;
+		float _cellSize;
+		float _particleRadius;
+		float _isoLevel;
+		int _maximumCellsPerAxis;
+		int _maximumBlocks;
+		bool _densityWeighted;
+
+		// Iso level of the extraction in progress, read by PolygonizeBlock
+		float _extractIsoLevel;
+
+	public:
+		FluidSurfaceExtractor();
+		~FluidSurfaceExtractor();
+	protected:
+		!FluidSurfaceExtractor();
+	public:
+		property bool Disposed
+		{
+			virtual bool get();
+		}
+
+		/// <summary>
+		/// Builds the surface of the valid particles in data. The data must stay locked until Extract returns.
+		/// </summary>
+		/// <param name="data">
+		/// The locked particle data, which needs the position buffer. Densities are read from ParticleFluidReadData
+		/// when DensityWeighted is set and the density buffer is enabled.
+		/// </param>
+		/// <returns>The number of triangles in the surface.</returns>
+		int Extract(ParticleReadData^ data);
+
+		/// <summary>
+		/// Copies the surface built by the last Extract into caller owned buffers. The positions and normals may share
+		/// an interleaved vertex buffer.
+		/// </summary>
+		/// <param name="positions">Receives VertexCount positions as Vector3.</param>
+		/// <param name="normals">Receives VertexCount unit normals as Vector3, or empty to skip them.</param>
+		/// <param name="indices">Receives IndexCount vertex indices as int, three per triangle, counter clockwise seen from outside.</param>
+		void WriteMesh(BoundedData positions, BoundedData normals, BoundedData indices);
+		/// <summary>
+		/// Copies the surface built by the last Extract into caller owned arrays.
+		/// </summary>
+		/// <param name="positions">Receives VertexCount positions.</param>
+		/// <param name="normals">Receives VertexCount unit normals, or null to skip them.</param>
+		/// <param name="indices">Receives IndexCount vertex indices, three per triangle.</param>
+		void WriteMesh(array<Vector3>^ positions, array<Vector3>^ normals, array<int>^ indices);
+
+		/// <summary>
+		/// Gets the number of vertices of the last extracted surface.
+		/// </summary>
+		property int VertexCount
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of indices of the last extracted surface.
+		/// </summary>
+		property int IndexCount
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets or sets the distance between grid nodes. Smaller cells give a smoother surface at a cubic cost.
+		/// </summary>
+		property float CellSize
+		{
+			float get();
+			void set(float value);
+		}
+
+		/// <summary>
+		/// Gets or sets the radius of influence of each particle, usually two to four times the particle spacing.
+		/// </summary>
+		property float ParticleRadius
+		{
+			float get();
+			void set(float value);
+		}
+
+		/// <summary>
+		/// Gets or sets the field value at the surface. A lone particle of weight one contributes one at its center,
+		/// falling off smoothly to zero at ParticleRadius.
+		/// </summary>
+		property float IsoLevel
+		{
+			float get();
+			void set(float value);
+		}
+
+		/// <summary>
+		/// Gets or sets the largest number of grid cells along any axis. When the particles spread further the cells
+		/// are enlarged to fit, bounding the cost of an extraction. At most MaximumCellsPerAxisLimit.
+		/// </summary>
+		property int MaximumCellsPerAxis
+		{
+			int get();
+			void set(int value);
+		}
+
+		/// <summary>
+		/// Gets or sets the largest number of slabs the grid is split into for parallel processing. One runs the
+		/// extraction on the calling thread.
+		/// </summary>
+		property int MaximumBlocks
+		{
+			int get();
+			void set(int value);
+		}
+
+		/// <summary>
+		/// Gets or sets whether fluid particles contribute in proportion to their density, so isolated spray particles
+		/// don't form blobs. Has no effect without a density buffer.
+		/// </summary>
+		property bool DensityWeighted
+		{
+			bool get();
+			void set(bool value);
+		}
+
+	private:
+		void SplatBlock(int block);
+		void PolygonizeBlock(int block);
+	};
+};
\ No newline at end of file
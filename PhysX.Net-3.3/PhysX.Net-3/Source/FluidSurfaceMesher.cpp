@@ -0,0 +1,414 @@
+// Compiled without /clr, as the splat rows use SSE intrinsics
+
+#include <intrin.h>
+#include <xmmintrin.h>
+#include <foundation\PxMath.h>
+#include <foundation\PxBounds3.h>
+#include "FluidSurfaceMesher.h"
+
+using namespace physx;
+
+namespace
+{
+	// The six tetrahedra of a cube, all sharing the diagonal from corner 0 to corner 7. Corner i is at
+	// (i & 1, (i >> 1) & 1, (i >> 2) & 1), which splits each face the same way as the face of the neighbouring cube.
+	const PxU32 Tetrahedra[6][4] =
+	{
+		{ 0, 7, 1, 3 },
+		{ 0, 7, 3, 2 },
+		{ 0, 7, 2, 6 },
+		{ 0, 7, 6, 4 },
+		{ 0, 7, 4, 5 },
+		{ 0, 7, 5, 1 }
+	};
+
+	// Adds one particle to the nodes of a row within its radius, four nodes at a time
+	PX_FORCE_INLINE void splatRow(PxF32* row, PxU32 x0, PxU32 x1, PxF32 dx0, PxF32 cellSize, PxF32 dyz2, PxF32 invRadius2, PxF32 weight)
+	{
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 yz = _mm_set1_ps(dyz2);
+		const __m128 inv = _mm_set1_ps(invRadius2);
+		const __m128 w = _mm_set1_ps(weight);
+		const __m128 step = _mm_set1_ps(4 * cellSize);
+
+		__m128 dx = _mm_add_ps(_mm_set1_ps(dx0), _mm_mul_ps(_mm_set_ps(3, 2, 1, 0), _mm_set1_ps(cellSize)));
+
+		PxU32 x = x0;
+
+		for (; x + 3 <= x1; x += 4)
+		{
+			// (1 - d^2 / r^2)^3, zero outside the radius
+			__m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), yz);
+			__m128 t = _mm_max_ps(_mm_sub_ps(one, _mm_mul_ps(d2, inv)), zero);
+			__m128 k = _mm_mul_ps(_mm_mul_ps(t, t), _mm_mul_ps(t, w));
+
+			_mm_storeu_ps(row + x, _mm_add_ps(_mm_loadu_ps(row + x), k));
+
+			dx = _mm_add_ps(dx, step);
+		}
+
+		for (; x <= x1; x++)
+		{
+			const PxF32 d = dx0 + (x - x0) * cellSize;
+			const PxF32 t = PxMax(0.0f, 1.0f - (d * d + dyz2) * invRadius2);
+
+			row[x] += t * t * t * weight;
+		}
+	}
+}
+
+FluidSurfaceMesher::FluidSurfaceMesher()
+{
+	this->origin = PxVec3(0);
+	this->cellSize = 1;
+	this->radius = 1;
+	this->nx = 0;
+	this->ny = 0;
+	this->nz = 0;
+}
+
+PxU32 FluidSurfaceMesher::prepare(const FluidSurfaceParticlesUnmanaged& input, PxF32 cellSize, PxF32 radius, PxU32 maxCellsPerAxis, PxU32 maxBlocks)
+{
+	this->particles.clear();
+	this->nx = this->ny = this->nz = 0;
+
+	// Gather the valid particles, walking the bitmap a word at a time
+	PxBounds3 bounds = PxBounds3::empty();
+
+	const PxU32 words = (input.validParticleRange + 31) >> 5;
+
+	for (PxU32 w = 0; w < words; w++)
+	{
+		PxU32 bits = input.validParticleBitmap[w];
+
+		while (bits != 0)
+		{
+			unsigned long bit;
+			_BitScanForward(&bit, bits);
+			bits &= bits - 1;
+
+			const PxU32 index = (w << 5) | bit;
+
+			const PxVec3& p = *reinterpret_cast<const PxVec3*>(input.positions + index * input.positionStride);
+			const PxF32 weight = (input.densities != NULL ? *reinterpret_cast<const PxF32*>(input.densities + index * input.densityStride) : 1.0f);
+
+			if (weight <= 0)
+				continue;
+
+			this->particles.push_back(PxVec4(p, weight));
+			bounds.include(p);
+		}
+	}
+
+	if (this->particles.empty())
+	{
+		for (PxU32 i = 0; i < this->blocks.size(); i++)
+		{
+			this->blocks[i].positions.clear();
+			this->blocks[i].normals.clear();
+			this->blocks[i].indices.clear();
+		}
+
+		return 0;
+	}
+
+	// Pad by the radius and a cell so the surface closes inside the grid
+	bounds.fattenFast(radius + cellSize);
+
+	const PxVec3 extents = bounds.getDimensions();
+	const PxF32 largest = extents.maxElement();
+
+	// Coarsen the grid rather than exceed the node budget
+	if (largest / cellSize > maxCellsPerAxis)
+		cellSize = largest / maxCellsPerAxis;
+
+	this->origin = bounds.minimum;
+	this->cellSize = cellSize;
+	this->radius = radius;
+	this->nx = (PxU32)PxCeil(extents.x / cellSize) + 1;
+	this->ny = (PxU32)PxCeil(extents.y / cellSize) + 1;
+	this->nz = (PxU32)PxCeil(extents.z / cellSize) + 1;
+
+	// assign keeps the capacity of the previous extraction. FluidSurfaceExtractor limits maxCellsPerAxis, so the
+	// node count fits in 32 bits
+	this->grid.assign(this->nx * this->ny * this->nz, 0.0f);
+
+	const PxU32 layers = this->nz - 1;
+	const PxU32 count = PxClamp(maxBlocks, 1u, layers);
+
+	this->blocks.resize(count);
+
+	for (PxU32 i = 0; i < count; i++)
+	{
+		this->blocks[i].z0 = layers * i / count;
+		this->blocks[i].z1 = layers * (i + 1) / count;
+	}
+
+	return count;
+}
+
+void FluidSurfaceMesher::splatBlock(PxU32 block)
+{
+	const Block& b = this->blocks[block];
+
+	// Each block owns its node layers, so blocks never write the same node
+	const PxU32 zBegin = b.z0;
+	const PxU32 zEnd = (block == this->blocks.size() - 1 ? b.z1 + 1 : b.z1);
+
+	const PxF32 r = this->radius;
+	const PxF32 r2 = r * r;
+	const PxF32 invR2 = 1.0f / r2;
+	const PxF32 invCell = 1.0f / this->cellSize;
+
+	for (PxU32 i = 0; i < this->particles.size(); i++)
+	{
+		const PxVec4& p = this->particles[i];
+
+		const PxVec3 lo = (PxVec3(p.x, p.y, p.z) - PxVec3(r) - this->origin) * invCell;
+		const PxVec3 hi = (PxVec3(p.x, p.y, p.z) + PxVec3(r) - this->origin) * invCell;
+
+		const PxU32 z0 = PxMax(zBegin, (PxU32)PxMax(0.0f, PxCeil(lo.z)));
+		const PxU32 z1 = PxMin(zEnd - 1, (PxU32)PxMax(0.0f, PxFloor(hi.z)));
+
+		if (hi.z < 0 || z0 > z1)
+			continue;
+
+		const PxU32 x0 = (PxU32)PxMax(0.0f, PxCeil(lo.x));
+		const PxU32 x1 = PxMin(this->nx - 1, (PxU32)PxFloor(hi.x));
+		const PxU32 y0 = (PxU32)PxMax(0.0f, PxCeil(lo.y));
+		const PxU32 y1 = PxMin(this->ny - 1, (PxU32)PxFloor(hi.y));
+
+		const PxF32 dx0 = this->origin.x + x0 * this->cellSize - p.x;
+
+		for (PxU32 z = z0; z <= z1; z++)
+		{
+			const PxF32 dz = this->origin.z + z * this->cellSize - p.z;
+
+			for (PxU32 y = y0; y <= y1; y++)
+			{
+				const PxF32 dy = this->origin.y + y * this->cellSize - p.y;
+				const PxF32 dyz2 = dy * dy + dz * dz;
+
+				if (dyz2 >= r2)
+					continue;
+
+				splatRow(&this->grid[nodeIndex(0, y, z)], x0, x1, dx0, this->cellSize, dyz2, invR2, p.w);
+			}
+		}
+	}
+}
+
+void FluidSurfaceMesher::polygonizeBlock(PxU32 block, PxF32 isoLevel)
+{
+	Block& b = this->blocks[block];
+
+	b.positions.clear();
+	b.normals.clear();
+	b.indices.clear();
+	b.edgeVertices.clear();
+
+	PxU32 nodes[8];
+	PxF32 values[8];
+
+	for (PxU32 z = b.z0; z < b.z1; z++)
+	{
+		for (PxU32 y = 0; y + 1 < this->ny; y++)
+		{
+			for (PxU32 x = 0; x + 1 < this->nx; x++)
+			{
+				PxU32 inside = 0;
+
+				for (PxU32 i = 0; i < 8; i++)
+				{
+					nodes[i] = nodeIndex(x + (i & 1), y + ((i >> 1) & 1), z + ((i >> 2) & 1));
+					values[i] = this->grid[nodes[i]];
+
+					inside |= (values[i] > isoLevel ? 1u : 0u) << i;
+				}
+
+				// Most cubes are entirely inside or outside
+				if (inside == 0 || inside == 0xFF)
+					continue;
+
+				for (PxU32 t = 0; t < 6; t++)
+				{
+					const PxU32 tetNodes[4] = { nodes[Tetrahedra[t][0]], nodes[Tetrahedra[t][1]], nodes[Tetrahedra[t][2]], nodes[Tetrahedra[t][3]] };
+					const PxF32 tetValues[4] = { values[Tetrahedra[t][0]], values[Tetrahedra[t][1]], values[Tetrahedra[t][2]], values[Tetrahedra[t][3]] };
+
+					polygonizeTetrahedron(b, tetNodes, tetValues, isoLevel);
+				}
+			}
+		}
+	}
+}
+
+void FluidSurfaceMesher::polygonizeTetrahedron(Block& b, const PxU32* nodes, const PxF32* values, PxF32 isoLevel)
+{
+	PxU32 in[4], out[4];
+	PxU32 inCount = 0, outCount = 0;
+
+	for (PxU32 i = 0; i < 4; i++)
+	{
+		if (values[i] > isoLevel)
+			in[inCount++] = i;
+		else
+			out[outCount++] = i;
+	}
+
+	if (inCount == 0 || outCount == 0)
+		return;
+
+	PxU32 v[4];
+	PxU32 n;
+
+	if (inCount == 1)
+	{
+		v[0] = edgeVertex(b, nodes[in[0]], nodes[out[0]], isoLevel);
+		v[1] = edgeVertex(b, nodes[in[0]], nodes[out[1]], isoLevel);
+		v[2] = edgeVertex(b, nodes[in[0]], nodes[out[2]], isoLevel);
+		n = 3;
+	}
+	else if (outCount == 1)
+	{
+		v[0] = edgeVertex(b, nodes[in[0]], nodes[out[0]], isoLevel);
+		v[1] = edgeVertex(b, nodes[in[1]], nodes[out[0]], isoLevel);
+		v[2] = edgeVertex(b, nodes[in[2]], nodes[out[0]], isoLevel);
+		n = 3;
+	}
+	else
+	{
+		// Two inside, two outside, the crossing edges form a quad in this cyclic order
+		v[0] = edgeVertex(b, nodes[in[0]], nodes[out[0]], isoLevel);
+		v[1] = edgeVertex(b, nodes[in[0]], nodes[out[1]], isoLevel);
+		v[2] = edgeVertex(b, nodes[in[1]], nodes[out[1]], isoLevel);
+		v[3] = edgeVertex(b, nodes[in[1]], nodes[out[0]], isoLevel);
+		n = 4;
+	}
+
+	// Wind the triangles so their normals point from the inside corners to the outside corners
+	PxVec3 outward(0);
+	for (PxU32 i = 0; i < outCount; i++)
+		outward += nodePosition(nodes[out[i]]) * (1.0f / outCount);
+	for (PxU32 i = 0; i < inCount; i++)
+		outward -= nodePosition(nodes[in[i]]) * (1.0f / inCount);
+
+	const PxVec3& p0 = b.positions[v[0]];
+	const PxVec3 normal = (b.positions[v[1]] - p0).cross(b.positions[v[2]] - p0);
+
+	const bool flip = (normal.dot(outward) < 0);
+
+	// A fan of one triangle, or two for a quad
+	for (PxU32 t = 0; t + 2 < n; t++)
+	{
+		b.indices.push_back(v[0]);
+		b.indices.push_back(flip ? v[t + 2] : v[t + 1]);
+		b.indices.push_back(flip ? v[t + 1] : v[t + 2]);
+	}
+}
+
+PxU32 FluidSurfaceMesher::edgeVertex(Block& b, PxU32 inside, PxU32 outside, PxF32 isoLevel)
+{
+	const PxU64 key = (inside < outside ? ((PxU64)inside << 32) | outside : ((PxU64)outside << 32) | inside);
+
+	std::unordered_map<PxU64, PxU32>::const_iterator found = b.edgeVertices.find(key);
+	if (found != b.edgeVertices.end())
+		return found->second;
+
+	const PxF32 vi = this->grid[inside];
+	const PxF32 vo = this->grid[outside];
+
+	// vi > isoLevel >= vo, so the denominator is never zero
+	const PxF32 t = (vi - isoLevel) / (vi - vo);
+
+	const PxVec3 position = nodePosition(inside) + (nodePosition(outside) - nodePosition(inside)) * t;
+	const PxVec3 normal = (nodeNormal(inside) * (1 - t) + nodeNormal(outside) * t).getNormalized();
+
+	const PxU32 index = (PxU32)b.positions.size();
+
+	b.positions.push_back(position);
+	b.normals.push_back(normal);
+	b.edgeVertices[key] = index;
+
+	return index;
+}
+
+PxU32 FluidSurfaceMesher::nodeIndex(PxU32 x, PxU32 y, PxU32 z) const
+{
+	return x + this->nx * (y + this->ny * z);
+}
+PxVec3 FluidSurfaceMesher::nodePosition(PxU32 index) const
+{
+	const PxU32 x = index % this->nx;
+	const PxU32 y = (index / this->nx) % this->ny;
+	const PxU32 z = index / (this->nx * this->ny);
+
+	return this->origin + PxVec3((PxF32)x, (PxF32)y, (PxF32)z) * this->cellSize;
+}
+PxVec3 FluidSurfaceMesher::nodeNormal(PxU32 index) const
+{
+	const PxU32 x = index % this->nx;
+	const PxU32 y = (index / this->nx) % this->ny;
+	const PxU32 z = index / (this->nx * this->ny);
+
+	// The field falls off outwards, so the normal is the negated central difference gradient
+	const PxF32 gx = this->grid[nodeIndex(PxMin(x + 1, this->nx - 1), y, z)] - this->grid[nodeIndex(x > 0 ? x - 1 : 0, y, z)];
+	const PxF32 gy = this->grid[nodeIndex(x, PxMin(y + 1, this->ny - 1), z)] - this->grid[nodeIndex(x, y > 0 ? y - 1 : 0, z)];
+	const PxF32 gz = this->grid[nodeIndex(x, y, PxMin(z + 1, this->nz - 1))] - this->grid[nodeIndex(x, y, z > 0 ? z - 1 : 0)];
+
+	return -PxVec3(gx, gy, gz);
+}
+
+PxU32 FluidSurfaceMesher::getVertexCount() const
+{
+	PxU32 n = 0;
+
+	for (PxU32 i = 0; i < this->blocks.size(); i++)
+		n += (PxU32)this->blocks[i].positions.size();
+
+	return n;
+}
+PxU32 FluidSurfaceMesher::getIndexCount() const
+{
+	PxU32 n = 0;
+
+	for (PxU32 i = 0; i < this->blocks.size(); i++)
+		n += (PxU32)this->blocks[i].indices.size();
+
+	return n;
+}
+PxF32 FluidSurfaceMesher::getCellSize() const
+{
+	return this->cellSize;
+}
+
+void FluidSurfaceMesher::write(PxU8* positions, PxU32 positionStride, PxU8* normals, PxU32 normalStride, PxU8* indices, PxU32 indexStride) const
+{
+	PxU32 vertexBase = 0;
+
+	for (PxU32 i = 0; i < this->blocks.size(); i++)
+	{
+		const Block& b = this->blocks[i];
+		const PxU32 vertexCount = (PxU32)b.positions.size();
+
+		for (PxU32 v = 0; v < vertexCount; v++)
+		{
+			*reinterpret_cast<PxVec3*>(positions) = b.positions[v];
+			positions += positionStride;
+
+			if (normals != NULL)
+			{
+				*reinterpret_cast<PxVec3*>(normals) = b.normals[v];
+				normals += normalStride;
+			}
+		}
+
+		for (PxU32 j = 0; j < b.indices.size(); j++)
+		{
+			*reinterpret_cast<PxU32*>(indices) = vertexBase + b.indices[j];
+			indices += indexStride;
+		}
+
+		vertexBase += vertexCount;
+	}
+}
\ No newline at end of file
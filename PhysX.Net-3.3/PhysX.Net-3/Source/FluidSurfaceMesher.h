@@ -0,0 +1,83 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <foundation\PxSimpleTypes.h>
+#include <foundation\PxVec3.h>
+#include <foundation\PxVec4.h>
+
+/// <summary>
+/// The particles to build a surface from, as laid out in PxParticleReadData.
+/// </summary>
+struct FluidSurfaceParticlesUnmanaged
+{
+	const physx::PxU32* validParticleBitmap;
+	physx::PxU32 validParticleRange;
+	const physx::PxU8* positions;
+	physx::PxU32 positionStride;
+	// Optional, scales the contribution of each particle to the field
+	const physx::PxU8* densities;
+	physx::PxU32 densityStride;
+};
+
+/// <summary>
+/// Builds a triangle mesh of the surface of a set of particles. The particles are splatted into a scalar field on a
+/// grid, which is then polygonized with marching tetrahedra. Both passes work on independent slabs of the grid along
+/// Z (blocks), so each can run one block per task.
+/// </summary>
+/// <remarks>
+/// Call prepare, then splatBlock for every block, then polygonizeBlock for every block, then write.
+/// Vertices are shared between the triangles of a block; blocks duplicate the vertices on the plane between them.
+/// </remarks>
+class FluidSurfaceMesher
+{
+public:
+	FluidSurfaceMesher();
+
+	// Gathers the valid particles and sizes and clears the grid around them, returning the number of blocks
+	physx::PxU32 prepare(const FluidSurfaceParticlesUnmanaged& particles, physx::PxF32 cellSize, physx::PxF32 radius, physx::PxU32 maxCellsPerAxis, physx::PxU32 maxBlocks);
+	// Adds the particles to the grid nodes of a block
+	void splatBlock(physx::PxU32 block);
+	// Builds the triangles of a block, all blocks must have been splatted
+	void polygonizeBlock(physx::PxU32 block, physx::PxF32 isoLevel);
+
+	physx::PxU32 getVertexCount() const;
+	physx::PxU32 getIndexCount() const;
+	physx::PxF32 getCellSize() const;
+
+	// Concatenates the blocks into caller memory, normals may be NULL
+	void write(physx::PxU8* positions, physx::PxU32 positionStride, physx::PxU8* normals, physx::PxU32 normalStride, physx::PxU8* indices, physx::PxU32 indexStride) const;
+
+private:
+	struct Block
+	{
+		// Cube layers [z0, z1) are polygonized, node layers [z0, z1) are splatted (the last block also splats z1)
+		physx::PxU32 z0;
+		physx::PxU32 z1;
+
+		std::vector<physx::PxVec3> positions;
+		std::vector<physx::PxVec3> normals;
+		std::vector<physx::PxU32> indices;
+
+		// Vertex of each grid edge crossing the surface, keyed by the indices of its two nodes
+		std::unordered_map<physx::PxU64, physx::PxU32> edgeVertices;
+	};
+
+	physx::PxU32 nodeIndex(physx::PxU32 x, physx::PxU32 y, physx::PxU32 z) const;
+	physx::PxVec3 nodePosition(physx::PxU32 index) const;
+	physx::PxVec3 nodeNormal(physx::PxU32 index) const;
+	physx::PxU32 edgeVertex(Block& block, physx::PxU32 a, physx::PxU32 b, physx::PxF32 isoLevel);
+	void polygonizeTetrahedron(Block& block, const physx::PxU32* nodes, const physx::PxF32* values, physx::PxF32 isoLevel);
+
+	// xyz position, w weight
+	std::vector<physx::PxVec4> particles;
+	std::vector<physx::PxF32> grid;
+	std::vector<Block> blocks;
+
+	physx::PxVec3 origin;
+	physx::PxF32 cellSize;
+	physx::PxF32 radius;
+	physx::PxU32 nx;
+	physx::PxU32 ny;
+	physx::PxU32 nz;
+};
\ No newline at end of file
@@ -1,6 +1,136 @@
 #include "StdAfx.h"
 #include "GeometryQuery.h"
 #include "SweepHit.h"
+#include "RaycastHit.h"
+
+#pragma managed(push, off)
+// The batch loops stay native, so a whole batch costs one managed to native transition.
+// Poses are System.Numerics matrices, which have the same memory layout as PxMat44.
+static PxU32 OverlapPoses(const PxGeometry& geometry, const PxU8* poses, PxU32 poseStride, PxU32 count, const PxGeometry& other, const PxTransform& otherPose, PxU8* results, PxU32 resultStride)
+{
+	PxU32 overlaps = 0;
+
+	for (PxU32 i = 0; i < count; i++)
+	{
+		PxTransform pose(*(const PxMat44*)(poses + i * poseStride));
+
+		bool overlap = PxGeometryQuery::overlap(geometry, pose, other, otherPose);
+
+		*(bool*)(results + i * resultStride) = overlap;
+
+		if (overlap)
+			overlaps++;
+	}
+
+	return overlaps;
+}
+
+static PxU32 RaycastRays(const PxU8* origins, PxU32 originStride, const PxU8* directions, PxU32 directionStride, PxU32 count, const PxGeometry& geometry, const PxTransform& pose, PxReal maxDistance, PxU8* distances, PxU32 distanceStride, PxU8* positions, PxU32 positionStride, PxU8* normals, PxU32 normalStride)
+{
+	PxHitFlags flags = PxHitFlag::eDISTANCE;
+	if (positions != NULL)
+		flags |= PxHitFlag::ePOSITION;
+	if (normals != NULL)
+		flags |= PxHitFlag::eNORMAL;
+
+	PxU32 hits = 0;
+
+	for (PxU32 i = 0; i < count; i++)
+	{
+		const PxVec3& origin = *(const PxVec3*)(origins + i * originStride);
+		const PxVec3& direction = *(const PxVec3*)(directions + i * directionStride);
+
+		PxRaycastHit hit;
+		bool isHit = PxGeometryQuery::raycast(origin, direction, geometry, pose, maxDistance, flags, 1, &hit) != 0;
+
+		*(PxF32*)(distances + i * distanceStride) = isHit ? hit.distance : PX_MAX_F32;
+
+		if (positions != NULL)
+			*(PxVec3*)(positions + i * positionStride) = isHit ? hit.position : PxVec3(0);
+		if (normals != NULL)
+			*(PxVec3*)(normals + i * normalStride) = isHit ? hit.normal : PxVec3(0);
+
+		if (isHit)
+			hits++;
+	}
+
+	return hits;
+}
+
+static PxU32 PenetratePoses(const PxGeometry& geometry, const PxU8* poses, PxU32 poseStride, PxU32 count, const PxGeometry& other, const PxTransform& otherPose, PxU8* directions, PxU32 directionStride, PxU8* depths, PxU32 depthStride)
+{
+	PxU32 overlaps = 0;
+
+	for (PxU32 i = 0; i < count; i++)
+	{
+		PxTransform pose(*(const PxMat44*)(poses + i * poseStride));
+
+		PxVec3 direction(0);
+		PxF32 depth = 0;
+
+		if (PxGeometryQuery::computePenetration(direction, depth, geometry, pose, other, otherPose))
+		{
+			overlaps++;
+		}
+		else
+		{
+			direction = PxVec3(0);
+			depth = 0;
+		}
+
+		*(PxVec3*)(directions + i * directionStride) = direction;
+		*(PxF32*)(depths + i * depthStride) = depth;
+	}
+
+	return overlaps;
+}
+
+static void DistanceToPoints(const PxU8* points, PxU32 pointStride, PxU32 count, const PxGeometry& geometry, const PxTransform& pose, PxU8* distances, PxU32 distanceStride, PxU8* closestPoints, PxU32 closestPointStride)
+{
+	for (PxU32 i = 0; i < count; i++)
+	{
+		const PxVec3& point = *(const PxVec3*)(points + i * pointStride);
+
+		PxVec3* closestPoint = closestPoints == NULL ? NULL : (PxVec3*)(closestPoints + i * closestPointStride);
+
+		// pointDistance returns the squared distance
+		*(PxF32*)(distances + i * distanceStride) = PxSqrt(PxGeometryQuery::pointDistance(point, geometry, pose, closestPoint));
+	}
+}
+#pragma managed(pop)
+
+static void CheckCount(BoundedData data, int count, String^ name)
+{
+	if (data.Count < count)
+		throw gcnew ArgumentOutOfRangeException(name, String::Format("{0} must hold at least {1} elements", name, count));
+}
+static void CheckOptionalCount(BoundedData data, int count, String^ name)
+{
+	if (data.Count != 0)
+		CheckCount(data, count, name);
+}
+// pointDistance returns -1 for any other geometry, which would otherwise come out of PxSqrt as NaN
+static void CheckPointDistanceGeometry(Geometry^ geometry)
+{
+	ThrowIfNull(geometry, "geometry");
+
+	switch (geometry->Type)
+	{
+		case GeometryType::Sphere:
+		case GeometryType::Capsule:
+		case GeometryType::Box:
+		case GeometryType::ConvexMesh:
+			return;
+
+		default:
+			throw gcnew ArgumentException(String::Format("Point distance isn't supported for {0} geometry, only sphere, capsule, box and convex mesh geometry", geometry->Type), "geometry");
+	}
+}
+static void FreePin(GCHandle% pin)
+{
+	if (pin.IsAllocated)
+		pin.Free();
+}
 
 SweepHit^ GeometryQuery::Sweep(Vector3 unitDirection, float distance, Geometry^ geom0, Matrix pose0, Geometry^ geom1, Matrix pose1, [Optional] Nullable<HitFlag> hitFlags, [Optional] Nullable<float> inflation)
 {
@@ -27,7 +157,8 @@ SweepHit^ GeometryQuery::Sweep(Vector3 unitDirection, float distance, Geometry^
 		inflation.GetValueOrDefault(0)
 	);
 
-	delete g0, g1;
+	delete g0;
+	delete g1;
 
 	if (!result)
 		return nullptr;
@@ -35,6 +166,307 @@ SweepHit^ GeometryQuery::Sweep(Vector3 unitDirection, float distance, Geometry^
 	return SweepHit::ToManaged(sh);
 }
 
+bool GeometryQuery::Overlap(Geometry^ geom0, Matrix pose0, Geometry^ geom1, Matrix pose1)
+{
+	ThrowIfNull(geom0, "geom0");
+	ThrowIfNull(geom1, "geom1");
+
+	PxGeometry* g0 = geom0->ToUnmanaged();
+	PxGeometry* g1 = geom1->ToUnmanaged();
+
+	bool overlap = PxGeometryQuery::overlap(*g0, UM(pose0), *g1, UM(pose1));
+
+	delete g0;
+	delete g1;
+
+	return overlap;
+}
+int GeometryQuery::Overlap(Geometry^ geometry, BoundedData poses, Geometry^ other, Matrix otherPose, BoundedData results)
+{
+	ThrowIfNull(geometry, "geometry");
+	ThrowIfNull(other, "other");
+	CheckCount(results, poses.Count, "results");
+
+	if (poses.Count == 0)
+		return 0;
+
+	PxGeometry* g = geometry->ToUnmanaged();
+	PxGeometry* o = other->ToUnmanaged();
+
+	GCHandle posePin, resultPin;
+	try
+	{
+		PxBoundedData p = poses.ToUnmanaged(posePin, sizeof(PxMat44));
+		PxBoundedData r = results.ToUnmanaged(resultPin, sizeof(bool));
+
+		return OverlapPoses(*g, (const PxU8*)p.data, p.stride, p.count, *o, UM(otherPose), (PxU8*)r.data, r.stride);
+	}
+	finally
+	{
+		FreePin(posePin);
+		FreePin(resultPin);
+
+		delete g;
+		delete o;
+	}
+}
+int GeometryQuery::Overlap(Geometry^ geometry, array<Matrix>^ poses, Geometry^ other, Matrix otherPose, array<bool>^ results)
+{
+	ThrowIfNull(poses, "poses");
+	ThrowIfNull(results, "results");
+
+	return Overlap(geometry, BoundedData(poses, 0, poses->Length, sizeof(PxMat44)), other, otherPose, BoundedData(results, 0, results->Length, sizeof(bool)));
+}
+
+array<RaycastHit^>^ GeometryQuery::Raycast(Vector3 origin, Vector3 unitDirection, Geometry^ geometry, Matrix pose, float maxDistance, [Optional] Nullable<HitFlag> hitFlags, [Optional] Nullable<int> maximumHits)
+{
+	ThrowIfNull(geometry, "geometry");
+
+	int maxHits = maximumHits.GetValueOrDefault(1);
+	if (maxHits <= 0)
+		throw gcnew ArgumentOutOfRangeException("maximumHits", "The maximum number of hits must be greater than zero");
+
+	PxGeometry* g = geometry->ToUnmanaged();
+	PxRaycastHit* hits = new PxRaycastHit[maxHits];
+
+	try
+	{
+		PxU32 n = PxGeometryQuery::raycast
+		(
+			UV(origin),
+			UV(unitDirection),
+			*g,
+			UM(pose),
+			maxDistance,
+			ToUnmanagedEnum(PxHitFlag, hitFlags.GetValueOrDefault(HitFlag::Default)),
+			maxHits,
+			hits
+		);
+
+		auto result = gcnew array<RaycastHit^>(n);
+		for (PxU32 i = 0; i < n; i++)
+			result[i] = RaycastHit::ToManaged(hits[i]);
+
+		return result;
+	}
+	finally
+	{
+		delete[] hits;
+		delete g;
+	}
+}
+int GeometryQuery::Raycast(BoundedData origins, BoundedData unitDirections, Geometry^ geometry, Matrix pose, float maxDistance, BoundedData distances, [Optional] BoundedData positions, [Optional] BoundedData normals)
+{
+	ThrowIfNull(geometry, "geometry");
+
+	const int n = origins.Count;
+	CheckCount(unitDirections, n, "unitDirections");
+	CheckCount(distances, n, "distances");
+	CheckOptionalCount(positions, n, "positions");
+	CheckOptionalCount(normals, n, "normals");
+
+	if (n == 0)
+		return 0;
+
+	PxGeometry* g = geometry->ToUnmanaged();
+
+	GCHandle originPin, directionPin, distancePin, positionPin, normalPin;
+	try
+	{
+		PxBoundedData o = origins.ToUnmanaged(originPin, sizeof(PxVec3));
+		PxBoundedData d = unitDirections.ToUnmanaged(directionPin, sizeof(PxVec3));
+		PxBoundedData t = distances.ToUnmanaged(distancePin, sizeof(PxF32));
+		PxBoundedData p = positions.ToUnmanaged(positionPin, sizeof(PxVec3));
+		PxBoundedData m = normals.ToUnmanaged(normalPin, sizeof(PxVec3));
+
+		return RaycastRays
+		(
+			(const PxU8*)o.data, o.stride,
+			(const PxU8*)d.data, d.stride,
+			n,
+			*g,
+			UM(pose),
+			maxDistance,
+			(PxU8*)t.data, t.stride,
+			(PxU8*)p.data, p.stride,
+			(PxU8*)m.data, m.stride
+		);
+	}
+	finally
+	{
+		FreePin(originPin);
+		FreePin(directionPin);
+		FreePin(distancePin);
+		FreePin(positionPin);
+		FreePin(normalPin);
+
+		delete g;
+	}
+}
+int GeometryQuery::Raycast(array<Vector3>^ origins, array<Vector3>^ unitDirections, Geometry^ geometry, Matrix pose, float maxDistance, array<float>^ distances, [Optional] array<Vector3>^ positions, [Optional] array<Vector3>^ normals)
+{
+	ThrowIfNull(origins, "origins");
+	ThrowIfNull(unitDirections, "unitDirections");
+	ThrowIfNull(distances, "distances");
+
+	BoundedData p, m;
+	if (positions != nullptr)
+		p = BoundedData(positions, 0, positions->Length, sizeof(PxVec3));
+	if (normals != nullptr)
+		m = BoundedData(normals, 0, normals->Length, sizeof(PxVec3));
+
+	return Raycast
+	(
+		BoundedData(origins, 0, origins->Length, sizeof(PxVec3)),
+		BoundedData(unitDirections, 0, unitDirections->Length, sizeof(PxVec3)),
+		geometry,
+		pose,
+		maxDistance,
+		BoundedData(distances, 0, distances->Length, sizeof(PxF32)),
+		p,
+		m
+	);
+}
+
+bool GeometryQuery::ComputePenetration(Geometry^ geom0, Matrix pose0, Geometry^ geom1, Matrix pose1, [Out] Vector3% direction, [Out] float% depth)
+{
+	ThrowIfNull(geom0, "geom0");
+	ThrowIfNull(geom1, "geom1");
+
+	PxGeometry* g0 = geom0->ToUnmanaged();
+	PxGeometry* g1 = geom1->ToUnmanaged();
+
+	PxVec3 d(0);
+	PxF32 t = 0;
+
+	bool overlap = PxGeometryQuery::computePenetration(d, t, *g0, UM(pose0), *g1, UM(pose1));
+
+	delete g0;
+	delete g1;
+
+	direction = overlap ? MathUtil::PxVec3ToVector3(d) : Vector3::Zero;
+	depth = overlap ? t : 0;
+
+	return overlap;
+}
+int GeometryQuery::ComputePenetration(Geometry^ geometry, BoundedData poses, Geometry^ other, Matrix otherPose, BoundedData directions, BoundedData depths)
+{
+	ThrowIfNull(geometry, "geometry");
+	ThrowIfNull(other, "other");
+	CheckCount(directions, poses.Count, "directions");
+	CheckCount(depths, poses.Count, "depths");
+
+	if (poses.Count == 0)
+		return 0;
+
+	PxGeometry* g = geometry->ToUnmanaged();
+	PxGeometry* o = other->ToUnmanaged();
+
+	GCHandle posePin, directionPin, depthPin;
+	try
+	{
+		PxBoundedData p = poses.ToUnmanaged(posePin, sizeof(PxMat44));
+		PxBoundedData d = directions.ToUnmanaged(directionPin, sizeof(PxVec3));
+		PxBoundedData t = depths.ToUnmanaged(depthPin, sizeof(PxF32));
+
+		return PenetratePoses(*g, (const PxU8*)p.data, p.stride, p.count, *o, UM(otherPose), (PxU8*)d.data, d.stride, (PxU8*)t.data, t.stride);
+	}
+	finally
+	{
+		FreePin(posePin);
+		FreePin(directionPin);
+		FreePin(depthPin);
+
+		delete g;
+		delete o;
+	}
+}
+int GeometryQuery::ComputePenetration(Geometry^ geometry, array<Matrix>^ poses, Geometry^ other, Matrix otherPose, array<Vector3>^ directions, array<float>^ depths)
+{
+	ThrowIfNull(poses, "poses");
+	ThrowIfNull(directions, "directions");
+	ThrowIfNull(depths, "depths");
+
+	return ComputePenetration
+	(
+		geometry,
+		BoundedData(poses, 0, poses->Length, sizeof(PxMat44)),
+		other,
+		otherPose,
+		BoundedData(directions, 0, directions->Length, sizeof(PxVec3)),
+		BoundedData(depths, 0, depths->Length, sizeof(PxF32))
+	);
+}
+
+float GeometryQuery::PointDistance(Vector3 point, Geometry^ geometry, Matrix pose)
+{
+	CheckPointDistanceGeometry(geometry);
+
+	PxGeometry* g = geometry->ToUnmanaged();
+
+	// pointDistance returns the squared distance
+	PxReal distance = PxSqrt(PxGeometryQuery::pointDistance(UV(point), *g, UM(pose)));
+
+	delete g;
+
+	return distance;
+}
+float GeometryQuery::PointDistance(Vector3 point, Geometry^ geometry, Matrix pose, [Out] Vector3% closestPoint)
+{
+	CheckPointDistanceGeometry(geometry);
+
+	PxGeometry* g = geometry->ToUnmanaged();
+
+	PxVec3 closest(0);
+	PxReal distance = PxSqrt(PxGeometryQuery::pointDistance(UV(point), *g, UM(pose), &closest));
+
+	delete g;
+
+	closestPoint = MathUtil::PxVec3ToVector3(closest);
+
+	return distance;
+}
+void GeometryQuery::PointDistance(BoundedData points, Geometry^ geometry, Matrix pose, BoundedData distances, [Optional] BoundedData closestPoints)
+{
+	CheckPointDistanceGeometry(geometry);
+	CheckCount(distances, points.Count, "distances");
+	CheckOptionalCount(closestPoints, points.Count, "closestPoints");
+
+	if (points.Count == 0)
+		return;
+
+	PxGeometry* g = geometry->ToUnmanaged();
+
+	GCHandle pointPin, distancePin, closestPointPin;
+	try
+	{
+		PxBoundedData p = points.ToUnmanaged(pointPin, sizeof(PxVec3));
+		PxBoundedData d = distances.ToUnmanaged(distancePin, sizeof(PxF32));
+		PxBoundedData c = closestPoints.ToUnmanaged(closestPointPin, sizeof(PxVec3));
+
+		DistanceToPoints((const PxU8*)p.data, p.stride, p.count, *g, UM(pose), (PxU8*)d.data, d.stride, (PxU8*)c.data, c.stride);
+	}
+	finally
+	{
+		FreePin(pointPin);
+		FreePin(distancePin);
+		FreePin(closestPointPin);
+
+		delete g;
+	}
+}
+void GeometryQuery::PointDistance(array<Vector3>^ points, Geometry^ geometry, Matrix pose, array<float>^ distances, [Optional] array<Vector3>^ closestPoints)
+{
+	ThrowIfNull(points, "points");
+	ThrowIfNull(distances, "distances");
+
+	BoundedData c;
+	if (closestPoints != nullptr)
+		c = BoundedData(closestPoints, 0, closestPoints->Length, sizeof(PxVec3));
+
+	PointDistance(BoundedData(points, 0, points->Length, sizeof(PxVec3)), geometry, pose, BoundedData(distances, 0, distances->Length, sizeof(PxF32)), c);
+}
+
 Bounds3 GeometryQuery::GetWorldBounds(Geometry^ geometry, Matrix pose, [Optional] Nullable<float> inflation)
 {
 	if (geometry == nullptr)
@@ -3,20 +3,148 @@
 #include "Geometry.h"
 #include "SceneEnum.h"
 #include "Bounds3.h"
+#include "BoundedData.h"
 
 namespace PhysX
 {
 	ref class SweepHit;
+	ref class RaycastHit;
 
+	/// <summary>
+	/// Tests geometry objects against each other directly, without a scene.
+	/// </summary>
+	/// <remarks>
+	/// The batched overloads test many poses, rays or points in a single native call and write the results into the
+	/// caller's buffers. Poses in a batch are Matrix elements and, like every pose here, must be rigid transforms.
+	/// </remarks>
 	public ref class GeometryQuery
 	{
 	public:
 		static SweepHit^ Sweep(Vector3 unitDirection, float distance, Geometry^ geom0, Matrix pose0, Geometry^ geom1, Matrix pose1, [Optional] Nullable<HitFlag> hitFlags, [Optional] Nullable<float> inflation);
 
-		// TODO: Overlap
-		// TODO: Raycast
-		// TODO: ComputePenetration
-		// TODO: PointDistance
+		/// <summary>
+		/// Tests whether two geometry objects overlap.
+		/// </summary>
+		static bool Overlap(Geometry^ geom0, Matrix pose0, Geometry^ geom1, Matrix pose1);
+		/// <summary>
+		/// Tests a geometry object at many poses against another geometry object, e.g. the targets of an area of effect.
+		/// </summary>
+		/// <param name="geometry">The geometry placed at each of the poses.</param>
+		/// <param name="poses">The poses, as Matrix elements.</param>
+		/// <param name="other">The geometry tested against.</param>
+		/// <param name="otherPose">The pose of the geometry tested against.</param>
+		/// <param name="results">Receives a bool per pose, true if it overlaps.</param>
+		/// <returns>The number of overlapping poses.</returns>
+		static int Overlap(Geometry^ geometry, BoundedData poses, Geometry^ other, Matrix otherPose, BoundedData results);
+		/// <summary>
+		/// Tests a geometry object at many poses against another geometry object, e.g. the targets of an area of effect.
+		/// </summary>
+		/// <param name="geometry">The geometry placed at each of the poses.</param>
+		/// <param name="poses">The poses.</param>
+		/// <param name="other">The geometry tested against.</param>
+		/// <param name="otherPose">The pose of the geometry tested against.</param>
+		/// <param name="results">Receives true for each pose which overlaps.</param>
+		/// <returns>The number of overlapping poses.</returns>
+		static int Overlap(Geometry^ geometry, array<Matrix>^ poses, Geometry^ other, Matrix otherPose, array<bool>^ results);
+
+		/// <summary>
+		/// Raycasts against a geometry object.
+		/// </summary>
+		/// <param name="origin">The origin of the ray.</param>
+		/// <param name="unitDirection">The normalized direction of the ray.</param>
+		/// <param name="geometry">The geometry to test against.</param>
+		/// <param name="pose">The pose of the geometry.</param>
+		/// <param name="maxDistance">The length of the ray.</param>
+		/// <param name="hitFlags">The properties to compute for each hit. Defaults to HitFlag.Default.</param>
+		/// <param name="maximumHits">The number of hits to report, more than one only applies to meshes and height fields with HitFlag.MeshMultiple. Defaults to 1.</param>
+		/// <returns>The hits, which is empty if the ray misses.</returns>
+		static array<RaycastHit^>^ Raycast(Vector3 origin, Vector3 unitDirection, Geometry^ geometry, Matrix pose, float maxDistance, [Optional] Nullable<HitFlag> hitFlags, [Optional] Nullable<int> maximumHits);
+		/// <summary>
+		/// Raycasts many rays against a geometry object, reporting the closest hit of each.
+		/// </summary>
+		/// <param name="origins">The origins of the rays, as Vector3 elements.</param>
+		/// <param name="unitDirections">The normalized directions of the rays, as Vector3 elements.</param>
+		/// <param name="geometry">The geometry to test against.</param>
+		/// <param name="pose">The pose of the geometry.</param>
+		/// <param name="maxDistance">The length of the rays.</param>
+		/// <param name="distances">Receives a float distance per ray, or float.MaxValue if it misses.</param>
+		/// <param name="positions">Optionally receives a Vector3 hit position per ray.</param>
+		/// <param name="normals">Optionally receives a Vector3 hit normal per ray.</param>
+		/// <returns>The number of rays which hit.</returns>
+		static int Raycast(BoundedData origins, BoundedData unitDirections, Geometry^ geometry, Matrix pose, float maxDistance, BoundedData distances, [Optional] BoundedData positions, [Optional] BoundedData normals);
+		/// <summary>
+		/// Raycasts many rays against a geometry object, reporting the closest hit of each.
+		/// </summary>
+		/// <param name="origins">The origins of the rays.</param>
+		/// <param name="unitDirections">The normalized directions of the rays.</param>
+		/// <param name="geometry">The geometry to test against.</param>
+		/// <param name="pose">The pose of the geometry.</param>
+		/// <param name="maxDistance">The length of the rays.</param>
+		/// <param name="distances">Receives a distance per ray, or float.MaxValue if it misses.</param>
+		/// <param name="positions">Optionally receives a hit position per ray.</param>
+		/// <param name="normals">Optionally receives a hit normal per ray.</param>
+		/// <returns>The number of rays which hit.</returns>
+		static int Raycast(array<Vector3>^ origins, array<Vector3>^ unitDirections, Geometry^ geometry, Matrix pose, float maxDistance, array<float>^ distances, [Optional] array<Vector3>^ positions, [Optional] array<Vector3>^ normals);
+
+		/// <summary>
+		/// Computes the minimum translational distance to separate two overlapping geometry objects.
+		/// geom0 must be moved by direction * depth to no longer overlap geom1.
+		/// </summary>
+		/// <returns>True if the geometry objects overlap.</returns>
+		static bool ComputePenetration(Geometry^ geom0, Matrix pose0, Geometry^ geom1, Matrix pose1, [Out] Vector3% direction, [Out] float% depth);
+		/// <summary>
+		/// Computes the penetration of a geometry object at many poses into another geometry object.
+		/// </summary>
+		/// <param name="geometry">The geometry placed at each of the poses.</param>
+		/// <param name="poses">The poses, as Matrix elements.</param>
+		/// <param name="other">The geometry tested against.</param>
+		/// <param name="otherPose">The pose of the geometry tested against.</param>
+		/// <param name="directions">Receives a Vector3 direction per pose, zero if it doesn't overlap.</param>
+		/// <param name="depths">Receives a float depth per pose, zero if it doesn't overlap.</param>
+		/// <returns>The number of overlapping poses.</returns>
+		static int ComputePenetration(Geometry^ geometry, BoundedData poses, Geometry^ other, Matrix otherPose, BoundedData directions, BoundedData depths);
+		/// <summary>
+		/// Computes the penetration of a geometry object at many poses into another geometry object.
+		/// </summary>
+		/// <param name="geometry">The geometry placed at each of the poses.</param>
+		/// <param name="poses">The poses.</param>
+		/// <param name="other">The geometry tested against.</param>
+		/// <param name="otherPose">The pose of the geometry tested against.</param>
+		/// <param name="directions">Receives a direction per pose, zero if it doesn't overlap.</param>
+		/// <param name="depths">Receives a depth per pose, zero if it doesn't overlap.</param>
+		/// <returns>The number of overlapping poses.</returns>
+		static int ComputePenetration(Geometry^ geometry, array<Matrix>^ poses, Geometry^ other, Matrix otherPose, array<Vector3>^ directions, array<float>^ depths);
+
+		/// <summary>
+		/// Computes the distance from a point to a geometry object, which is zero if the point is inside it.
+		/// Only sphere, capsule, box and convex mesh geometry are supported.
+		/// </summary>
+		static float PointDistance(Vector3 point, Geometry^ geometry, Matrix pose);
+		/// <summary>
+		/// Computes the distance from a point to a geometry object, which is zero if the point is inside it, and the closest point on the geometry.
+		/// Only sphere, capsule, box and convex mesh geometry are supported.
+		/// </summary>
+		static float PointDistance(Vector3 point, Geometry^ geometry, Matrix pose, [Out] Vector3% closestPoint);
+		/// <summary>
+		/// Computes the distances from many points to a geometry object.
+		/// Only sphere, capsule, box and convex mesh geometry are supported.
+		/// </summary>
+		/// <param name="points">The points, as Vector3 elements.</param>
+		/// <param name="geometry">The geometry to measure the distance to.</param>
+		/// <param name="pose">The pose of the geometry.</param>
+		/// <param name="distances">Receives a float distance per point.</param>
+		/// <param name="closestPoints">Optionally receives the Vector3 closest point on the geometry per point.</param>
+		static void PointDistance(BoundedData points, Geometry^ geometry, Matrix pose, BoundedData distances, [Optional] BoundedData closestPoints);
+		/// <summary>
+		/// Computes the distances from many points to a geometry object.
+		/// Only sphere, capsule, box and convex mesh geometry are supported.
+		/// </summary>
+		/// <param name="points">The points.</param>
+		/// <param name="geometry">The geometry to measure the distance to.</param>
+		/// <param name="pose">The pose of the geometry.</param>
+		/// <param name="distances">Receives a distance per point.</param>
+		/// <param name="closestPoints">Optionally receives the closest point on the geometry per point.</param>
+		static void PointDistance(array<Vector3>^ points, Geometry^ geometry, Matrix pose, array<float>^ distances, [Optional] array<Vector3>^ closestPoints);
 
 		static Bounds3 GetWorldBounds(Geometry^ geometry, Matrix pose, [Optional] Nullable<float> inflation);
 	};
@@ -2,6 +2,36 @@
 #include "HeightField.h"
 #include "Physics.h"
 #include "Serializable.h"
+#include "HeightFieldSampler.h"
+
+using namespace System::Threading;
+using namespace System::Threading::Tasks;
+
+namespace PhysX
+{
+	// Samples a batch in chunks, one chunk per Parallel::For iteration
+	private ref class HeightFieldSampleJob
+	{
+	private:
+		const HeightFieldSampler* _sampler;
+		const HeightFieldSampleBatchUnmanaged* _batch;
+		int _count;
+
+	public:
+		static const int ChunkSize = 4096;
+
+		HeightFieldSampleJob(const HeightFieldSampler* sampler, const HeightFieldSampleBatchUnmanaged* batch, int count)
+			: _sampler(sampler), _batch(batch), _count(count) { }
+
+		void Run(int chunk)
+		{
+			int begin = chunk * ChunkSize;
+			int end = Math::Min(begin + ChunkSize, _count);
+
+			_sampler->sample(*_batch, begin, end);
+		}
+	};
+};
 
 HeightField::HeightField(PxHeightField* heightField, PhysX::Physics^ owner)
 {
@@ -11,6 +41,8 @@ HeightField::HeightField(PxHeightField* heightField, PhysX::Physics^ owner)
 
 	_heightField = heightField;
 	_physics = owner;
+	_sampler = NULL;
+	_samplerLock = gcnew ReaderWriterLockSlim();
 
 	ObjectTable::Add((intptr_t)heightField, this, owner);
 }
@@ -25,8 +57,19 @@ HeightField::!HeightField()
 	if (Disposed)
 		return;
 
-	_heightField->release();
-	_heightField = NULL;
+	// Waits for any batch still being sampled
+	_samplerLock->EnterWriteLock();
+	try
+	{
+		SAFE_DELETE(_sampler);
+
+		_heightField->release();
+		_heightField = NULL;
+	}
+	finally
+	{
+		_samplerLock->ExitWriteLock();
+	}
 
 	OnDisposed(this, nullptr);
 }
@@ -58,6 +101,232 @@ short HeightField::GetTriangleMaterialIndex(int triangleIndex)
 	return _heightField->getTriangleMaterialIndex(triangleIndex);
 }
 
+bool HeightField::ModifySamples(int startColumn, int startRow, int numberOfColumns, int numberOfRows, BoundedData samples, [Optional] bool shrinkBounds)
+{
+	ThrowIfThisDisposed();
+
+	if (numberOfColumns < 0)
+		throw gcnew ArgumentOutOfRangeException("numberOfColumns");
+	if (numberOfRows < 0)
+		throw gcnew ArgumentOutOfRangeException("numberOfRows");
+	if (samples.Count < numberOfColumns * numberOfRows)
+		throw gcnew ArgumentException(String::Format("{0} samples are needed for {1} rows and {2} columns, but only {3} were given", numberOfColumns * numberOfRows, numberOfRows, numberOfColumns, samples.Count), "samples");
+
+	if (numberOfColumns == 0 || numberOfRows == 0)
+		return true;
+
+	GCHandle pin;
+	try
+	{
+		PxBoundedData data = samples.ToUnmanaged(pin, sizeof(PxHeightFieldSample));
+
+		PxHeightFieldDesc subfield;
+			subfield.format = _heightField->getFormat();
+			subfield.nbColumns = numberOfColumns;
+			subfield.nbRows = numberOfRows;
+			subfield.samples.data = data.data;
+			subfield.samples.stride = data.stride;
+
+		_samplerLock->EnterWriteLock();
+		try
+		{
+			bool modified = _heightField->modifySamples(startColumn, startRow, subfield, shrinkBounds);
+
+			// The sampler is rebuilt from the new samples on the next batch
+			if (modified)
+				SAFE_DELETE(_sampler);
+
+			return modified;
+		}
+		finally
+		{
+			_samplerLock->ExitWriteLock();
+		}
+	}
+	finally
+	{
+		if (pin.IsAllocated)
+			pin.Free();
+	}
+}
+bool HeightField::ModifySamples(int startColumn, int startRow, int numberOfColumns, int numberOfRows, array<HeightFieldSampleData>^ samples, [Optional] bool shrinkBounds)
+{
+	ThrowIfNull(samples, "samples");
+
+	return ModifySamples(startColumn, startRow, numberOfColumns, numberOfRows, BoundedData(samples, 0, samples->Length, sizeof(PxHeightFieldSample)), shrinkBounds);
+}
+
+array<HeightFieldSampleData>^ HeightField::GetSamples()
+{
+	ThrowIfThisDisposed();
+
+	auto samples = gcnew array<HeightFieldSampleData>(_heightField->getNbRows() * _heightField->getNbColumns());
+
+	if (samples->Length == 0)
+		return samples;
+
+	pin_ptr<HeightFieldSampleData> s = &samples[0];
+
+	_heightField->saveCells(s, samples->Length * sizeof(PxHeightFieldSample));
+
+	return samples;
+}
+
+void HeightField::SampleHeights(BoundedData xz, BoundedData heights, [Optional] bool parallel)
+{
+	ThrowIfThisDisposed();
+
+	if (heights.Count < xz.Count)
+		throw gcnew ArgumentException("There must be a height for every point", "heights");
+
+	if (xz.Count == 0)
+		return;
+
+	GCHandle xzPin, heightPin;
+	try
+	{
+		PxBoundedData p = xz.ToUnmanaged(xzPin, sizeof(PxVec2));
+		PxBoundedData h = heights.ToUnmanaged(heightPin, sizeof(PxF32));
+
+		HeightFieldSampleBatchUnmanaged batch = { };
+			batch.xz = (const PxU8*)p.data;
+			batch.xzStride = p.stride;
+			batch.heights = (PxU8*)h.data;
+			batch.heightStride = h.stride;
+
+		Sample(batch, xz.Count, parallel);
+	}
+	finally
+	{
+		if (xzPin.IsAllocated)
+			xzPin.Free();
+		if (heightPin.IsAllocated)
+			heightPin.Free();
+	}
+}
+void HeightField::SampleHeights(array<Vector2>^ xz, array<float>^ heights, [Optional] bool parallel)
+{
+	ThrowIfNull(xz, "xz");
+	ThrowIfNull(heights, "heights");
+
+	SampleHeights(BoundedData(xz, 0, xz->Length, sizeof(PxVec2)), BoundedData(heights, 0, heights->Length, sizeof(float)), parallel);
+}
+
+void HeightField::SampleSurface(BoundedData xz, BoundedData heights, BoundedData normals, [Optional] BoundedData materials, [Optional] bool parallel)
+{
+	ThrowIfThisDisposed();
+
+	if (heights.Count < xz.Count)
+		throw gcnew ArgumentException("There must be a height for every point", "heights");
+	if (normals.Count < xz.Count)
+		throw gcnew ArgumentException("There must be a normal for every point", "normals");
+	if (materials.Count != 0 && materials.Count < xz.Count)
+		throw gcnew ArgumentException("If given, there must be a material for every point", "materials");
+
+	if (xz.Count == 0)
+		return;
+
+	GCHandle xzPin, heightPin, normalPin, materialPin;
+	try
+	{
+		PxBoundedData p = xz.ToUnmanaged(xzPin, sizeof(PxVec2));
+		PxBoundedData h = heights.ToUnmanaged(heightPin, sizeof(PxF32));
+		PxBoundedData n = normals.ToUnmanaged(normalPin, sizeof(PxVec3));
+		PxBoundedData m = materials.ToUnmanaged(materialPin, sizeof(PxU16));
+
+		HeightFieldSampleBatchUnmanaged batch;
+			batch.xz = (const PxU8*)p.data;
+			batch.xzStride = p.stride;
+			batch.heights = (PxU8*)h.data;
+			batch.heightStride = h.stride;
+			batch.normals = (PxU8*)n.data;
+			batch.normalStride = n.stride;
+			batch.materials = (PxU8*)m.data;
+			batch.materialStride = m.stride;
+
+		Sample(batch, xz.Count, parallel);
+	}
+	finally
+	{
+		if (xzPin.IsAllocated)
+			xzPin.Free();
+		if (heightPin.IsAllocated)
+			heightPin.Free();
+		if (normalPin.IsAllocated)
+			normalPin.Free();
+		if (materialPin.IsAllocated)
+			materialPin.Free();
+	}
+}
+void HeightField::SampleSurface(array<Vector2>^ xz, array<float>^ heights, array<Vector3>^ normals, [Optional] array<short>^ materials, [Optional] bool parallel)
+{
+	ThrowIfNull(xz, "xz");
+	ThrowIfNull(heights, "heights");
+	ThrowIfNull(normals, "normals");
+
+	BoundedData m;
+	if (materials != nullptr)
+		m = BoundedData(materials, 0, materials->Length, sizeof(short));
+
+	SampleSurface(
+		BoundedData(xz, 0, xz->Length, sizeof(PxVec2)),
+		BoundedData(heights, 0, heights->Length, sizeof(float)),
+		BoundedData(normals, 0, normals->Length, sizeof(PxVec3)),
+		m,
+		parallel);
+}
+
+void HeightField::Sample(const HeightFieldSampleBatchUnmanaged& batch, int count, bool parallel)
+{
+	// Batches may be sampled from several threads at once, while ModifySamples and Dispose wait for them to finish
+	while (true)
+	{
+		_samplerLock->EnterReadLock();
+		try
+		{
+			ThrowIfThisDisposed();
+
+			if (_sampler != NULL)
+			{
+				if (parallel && count > HeightFieldSampleJob::ChunkSize)
+				{
+					auto job = gcnew HeightFieldSampleJob(_sampler, &batch, count);
+					int chunks = (count + HeightFieldSampleJob::ChunkSize - 1) / HeightFieldSampleJob::ChunkSize;
+
+					Parallel::For(0, chunks, gcnew Action<int>(job, &HeightFieldSampleJob::Run));
+				}
+				else
+				{
+					_sampler->sample(batch, 0, count);
+				}
+
+				return;
+			}
+		}
+		finally
+		{
+			_samplerLock->ExitReadLock();
+		}
+
+		// The read lock can't be upgraded, so build the sampler under the write lock and try again
+		CreateSampler();
+	}
+}
+
+void HeightField::CreateSampler()
+{
+	_samplerLock->EnterWriteLock();
+	try
+	{
+		if (_sampler == NULL && !this->Disposed)
+			_sampler = new HeightFieldSampler(*_heightField);
+	}
+	finally
+	{
+		_samplerLock->ExitWriteLock();
+	}
+}
+
 //
 
 int HeightField::NumberOfRows::get()
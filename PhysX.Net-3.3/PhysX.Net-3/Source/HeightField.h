@@ -1,6 +1,11 @@
 #pragma once
 
 #include "HeightFieldEnum.h"
+#include "HeightFieldSampleData.h"
+#include "BoundedData.h"
+
+class HeightFieldSampler;
+struct HeightFieldSampleBatchUnmanaged;
 
 namespace PhysX
 {
@@ -19,6 +24,9 @@ namespace PhysX
 		private:
 			PxHeightField* _heightField;
 			PhysX::Physics^ _physics;
+			HeightFieldSampler* _sampler;
+			// Held for reading while a batch is sampled, and for writing to replace or release the sampler
+			System::Threading::ReaderWriterLockSlim^ _samplerLock;
 
 		internal:
 			HeightField(PxHeightField* heightField, PhysX::Physics^ owner);
@@ -43,6 +51,86 @@ namespace PhysX
 			/// </summary>
 			short GetTriangleMaterialIndex(int triangleIndex);
 
+			/// <summary>
+			/// Replaces a rectangle of samples, e.g. to dig a crater, without recreating the height field.
+			/// Shapes already using the height field must have their geometry set again to pick up the new bounds.
+			/// </summary>
+			/// <param name="startColumn">The first column to replace. Columns outside the height field are clipped.</param>
+			/// <param name="startRow">The first row to replace. Rows outside the height field are clipped.</param>
+			/// <param name="numberOfColumns">The number of columns in the rectangle.</param>
+			/// <param name="numberOfRows">The number of rows in the rectangle.</param>
+			/// <param name="samples">The new samples, row major, numberOfRows * numberOfColumns of them.</param>
+			/// <param name="shrinkBounds">If true the height bounds are recomputed and may shrink, otherwise they only grow.</param>
+			/// <returns>True if the samples were modified.</returns>
+			bool ModifySamples(int startColumn, int startRow, int numberOfColumns, int numberOfRows, BoundedData samples, [Optional] bool shrinkBounds);
+			/// <summary>
+			/// Replaces a rectangle of samples, e.g. to dig a crater, without recreating the height field.
+			/// Shapes already using the height field must have their geometry set again to pick up the new bounds.
+			/// </summary>
+			/// <param name="startColumn">The first column to replace. Columns outside the height field are clipped.</param>
+			/// <param name="startRow">The first row to replace. Rows outside the height field are clipped.</param>
+			/// <param name="numberOfColumns">The number of columns in the rectangle.</param>
+			/// <param name="numberOfRows">The number of rows in the rectangle.</param>
+			/// <param name="samples">The new samples, row major, numberOfRows * numberOfColumns of them.</param>
+			/// <param name="shrinkBounds">If true the height bounds are recomputed and may shrink, otherwise they only grow.</param>
+			/// <returns>True if the samples were modified.</returns>
+			bool ModifySamples(int startColumn, int startRow, int numberOfColumns, int numberOfRows, array<HeightFieldSampleData>^ samples, [Optional] bool shrinkBounds);
+
+			/// <summary>
+			/// Copies all samples out of the height field, row major.
+			/// </summary>
+			array<HeightFieldSampleData>^ GetSamples();
+
+			/// <summary>
+			/// Retrieves the heights at many points in one native call.
+			/// Points are in grid space like GetHeight: x runs along the rows and z along the columns, one unit per sample,
+			/// and points outside the height field are clamped to its edges.
+			/// </summary>
+			/// <remarks>
+			/// The first batch keeps a copy of the samples (4 bytes per sample) to read them directly, which is dropped by ModifySamples.
+			/// Batches can be sampled from several threads at once, ModifySamples and Dispose wait for them to finish.
+			/// </remarks>
+			/// <param name="xz">The points, as Vector2 elements holding x and z.</param>
+			/// <param name="heights">Receives a float height per point.</param>
+			/// <param name="parallel">If true the batch is split across threads, worth it for very large batches.</param>
+			void SampleHeights(BoundedData xz, BoundedData heights, [Optional] bool parallel);
+			/// <summary>
+			/// Retrieves the heights at many points in one native call.
+			/// Points are in grid space like GetHeight: x runs along the rows and z along the columns, one unit per sample,
+			/// and points outside the height field are clamped to its edges.
+			/// </summary>
+			/// <param name="xz">The points, holding x and z.</param>
+			/// <param name="heights">Receives a height per point.</param>
+			/// <param name="parallel">If true the batch is split across threads, worth it for very large batches.</param>
+			void SampleHeights(array<Vector2>^ xz, array<float>^ heights, [Optional] bool parallel);
+
+			/// <summary>
+			/// Retrieves the heights, surface normals and triangle material indices at many points in one native call.
+			/// Points are in grid space like GetHeight: x runs along the rows and z along the columns, one unit per sample,
+			/// and points outside the height field are clamped to its edges.
+			/// Normals are in the same unscaled grid space; for a geometry with scales (h, r, c) the shape space normal is
+			/// the normalized (X / r, Y / h, Z / c).
+			/// </summary>
+			/// <param name="xz">The points, as Vector2 elements holding x and z.</param>
+			/// <param name="heights">Receives a float height per point.</param>
+			/// <param name="normals">Receives a Vector3 normal per point.</param>
+			/// <param name="materials">Optionally receives a short material index per point.</param>
+			/// <param name="parallel">If true the batch is split across threads, worth it for very large batches.</param>
+			void SampleSurface(BoundedData xz, BoundedData heights, BoundedData normals, [Optional] BoundedData materials, [Optional] bool parallel);
+			/// <summary>
+			/// Retrieves the heights, surface normals and triangle material indices at many points in one native call.
+			/// Points are in grid space like GetHeight: x runs along the rows and z along the columns, one unit per sample,
+			/// and points outside the height field are clamped to its edges.
+			/// Normals are in the same unscaled grid space; for a geometry with scales (h, r, c) the shape space normal is
+			/// the normalized (X / r, Y / h, Z / c).
+			/// </summary>
+			/// <param name="xz">The points, holding x and z.</param>
+			/// <param name="heights">Receives a height per point.</param>
+			/// <param name="normals">Receives a normal per point.</param>
+			/// <param name="materials">Optionally receives a material index per point.</param>
+			/// <param name="parallel">If true the batch is split across threads, worth it for very large batches.</param>
+			void SampleSurface(array<Vector2>^ xz, array<float>^ heights, array<Vector3>^ normals, [Optional] array<short>^ materials, [Optional] bool parallel);
+
 			/// <summary>
 			/// Gets an object which is responsible for serialization of this type.
 			/// </summary>
@@ -122,6 +210,10 @@ namespace PhysX
 				int get();
 			}
 
+		private:
+			void CreateSampler();
+			void Sample(const HeightFieldSampleBatchUnmanaged& batch, int count, bool parallel);
+
 		internal:
 			property PxHeightField* UnmanagedPointer
 			{
@@ -8,39 +8,64 @@ HeightFieldDesc::HeightFieldDesc()
 
 bool HeightFieldDesc::IsValid()
 {
-	auto desc = ToUnmanaged(this);
+	GCHandle pin;
+	try
+	{
+		auto desc = ToUnmanaged(this, pin);
 
-	bool valid = desc.isValid();
-
-	delete[] desc.samples.data;
-
-	return valid;
+		return desc.isValid();
+	}
+	catch (ArgumentException^)
+	{
+		return false;
+	}
+	finally
+	{
+		if (pin.IsAllocated)
+			pin.Free();
+	}
 }
 void HeightFieldDesc::SetToDefault()
 {
 	NumberOfColumns				= 0;
 	NumberOfRows				= 0;
 	Format						= HeightFieldFormat::Signed16BitIntegersWithTriangleMaterials;
+	Samples						= nullptr;
+	SampleData					= BoundedData();
 	Thickness					= -1.0f;
 	ConvexEdgeThreshold			= 0.0f;
 }
 
-PxHeightFieldDesc HeightFieldDesc::ToUnmanaged(HeightFieldDesc^ desc)
+PxHeightFieldDesc HeightFieldDesc::ToUnmanaged(HeightFieldDesc^ desc, GCHandle% pin)
 {
 	ThrowIfNull(desc, "desc");
 
-	PxStridedData samples;
-		samples.data = new PxHeightFieldSample[desc->Samples->Length];
-		samples.stride = sizeof(PxHeightFieldSample);
+	BoundedData source = desc->SampleData;
 
-		PxHeightFieldSample* s = (PxHeightFieldSample*)samples.data;
-		for (int i = 0; i < desc->Samples->Length; i++)
+	// The sample objects are packed once into a struct array, which is then read in place like SampleData
+	if (source.Count == 0 && desc->Samples != nullptr)
+	{
+		auto packed = gcnew array<HeightFieldSampleData>(desc->Samples->Length);
+
+		for (int i = 0; i < packed->Length; i++)
 		{
-			auto sample = HeightFieldSample::ToUnmanaged(desc->Samples[i]);
+			auto sample = desc->Samples[i];
 
-			memcpy(s++, &sample, sizeof(PxHeightFieldSample));
+			packed[i] = HeightFieldSampleData(sample->Height, sample->MaterialIndex0, sample->MaterialIndex1);
 		}
 
+		source = BoundedData(packed, 0, packed->Length, sizeof(PxHeightFieldSample));
+	}
+
+	if (source.Count != 0 && source.Count < desc->NumberOfRows * desc->NumberOfColumns)
+		throw gcnew ArgumentException(String::Format("{0} samples are needed for {1} rows and {2} columns, but only {3} were given", desc->NumberOfRows * desc->NumberOfColumns, desc->NumberOfRows, desc->NumberOfColumns, source.Count), "desc");
+
+	PxBoundedData data = source.ToUnmanaged(pin, sizeof(PxHeightFieldSample));
+
+	PxStridedData samples;
+		samples.data = data.data;
+		samples.stride = data.stride;
+
 	PxHeightFieldDesc d;
 		d.convexEdgeThreshold = desc->ConvexEdgeThreshold;
 		d.flags = ToUnmanagedEnum(PxHeightFieldFlag, desc->Flags);
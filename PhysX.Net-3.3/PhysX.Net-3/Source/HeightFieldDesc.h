@@ -2,13 +2,16 @@
 
 #include "HeightFieldEnum.h"
 #include "HeightFieldSample.h"
+#include "HeightFieldSampleData.h"
+#include "BoundedData.h"
 
 namespace PhysX
 {
 	public ref class HeightFieldDesc
 	{
 		internal:
-			static PxHeightFieldDesc ToUnmanaged(HeightFieldDesc^ desc);
+			// Pins the sample source into pin, which the caller must free once PhysX has copied the samples
+			static PxHeightFieldDesc ToUnmanaged(HeightFieldDesc^ desc, GCHandle% pin);
 
 		public:
 			HeightFieldDesc();
@@ -36,6 +39,12 @@ namespace PhysX
 			/// </summary>
 			property array<HeightFieldSample^>^ Samples;
 
+			/// <summary>
+			/// Gets or sets the samples as HeightFieldSampleData elements (row major, NumberOfRows * NumberOfColumns of them),
+			/// which PhysX reads in place. If Count is non-zero, Samples is ignored.
+			/// </summary>
+			property BoundedData SampleData;
+
 			/// <summary>
 			/// Gets or sets how thick the heightfield surface is. 
 			/// </summary>
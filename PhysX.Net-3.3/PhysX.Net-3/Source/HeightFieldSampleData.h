@@ -0,0 +1,39 @@
+#pragma once
+
+#include "BitAndData.h"
+
+using namespace System::Runtime::InteropServices;
+
+namespace PhysX
+{
+	/// <summary>
+	/// A height field sample laid out exactly as PxHeightFieldSample (4 bytes), so arrays of it can be handed to
+	/// PhysX in place. Prefer this over HeightFieldSample for large terrains, which would otherwise need one object per sample.
+	/// </summary>
+	[StructLayout(LayoutKind::Sequential)]
+	public value class HeightFieldSampleData
+	{
+	public:
+		HeightFieldSampleData(short height, BitAndByte materialIndex0, BitAndByte materialIndex1)
+		{
+			Height = height;
+			MaterialIndex0 = materialIndex0;
+			MaterialIndex1 = materialIndex1;
+		}
+
+		/// <summary>
+		/// The height of the heightfield sample.
+		/// </summary>
+		property short Height;
+
+		/// <summary>
+		/// The triangle material index of the quad's lower triangle + tesselation flag.
+		/// </summary>
+		property BitAndByte MaterialIndex0;
+
+		/// <summary>
+		/// The triangle material index of the quad's upper triangle + reserved flag.
+		/// </summary>
+		property BitAndByte MaterialIndex1;
+	};
+};
\ No newline at end of file
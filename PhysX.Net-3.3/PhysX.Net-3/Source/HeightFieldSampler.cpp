@@ -0,0 +1,101 @@
+// Compiled without /clr, batches can hold millions of points
+
+#include <foundation\PxMath.h>
+#include <geometry\PxHeightField.h>
+#include "HeightFieldSampler.h"
+
+using namespace physx;
+
+HeightFieldSampler::HeightFieldSampler(const PxHeightField& heightField)
+{
+	rows = heightField.getNbRows();
+	columns = heightField.getNbColumns();
+
+	samples.resize(rows * columns);
+
+	if (!samples.empty())
+		heightField.saveCells(&samples[0], (PxU32)(samples.size() * sizeof(PxHeightFieldSample)));
+}
+
+void HeightFieldSampler::sample(const HeightFieldSampleBatchUnmanaged& batch, PxU32 begin, PxU32 end) const
+{
+	if (rows < 2 || columns < 2)
+		return;
+
+	const PxHeightFieldSample* s = &samples[0];
+	const PxF32 maxX = (PxF32)(rows - 1);
+	const PxF32 maxZ = (PxF32)(columns - 1);
+
+	for (PxU32 i = begin; i < end; i++)
+	{
+		const PxF32* p = (const PxF32*)(batch.xz + i * batch.xzStride);
+
+		// Clamp to the height field, and into the last cell on its far edges
+		const PxF32 x = PxClamp(p[0], 0.0f, maxX);
+		const PxF32 z = PxClamp(p[1], 0.0f, maxZ);
+
+		const PxU32 row = PxMin((PxU32)x, rows - 2);
+		const PxU32 column = PxMin((PxU32)z, columns - 2);
+		const PxF32 fracX = x - (PxF32)row;
+		const PxF32 fracZ = z - (PxF32)column;
+
+		// v0 (row, column), v1 (row, column + 1), v2 (row + 1, column), v3 (row + 1, column + 1)
+		const PxU32 v0 = row * columns + column;
+		const PxF32 h0 = s[v0].height;
+		const PxF32 h1 = s[v0 + 1].height;
+		const PxF32 h2 = s[v0 + columns].height;
+		const PxF32 h3 = s[v0 + columns + 1].height;
+
+		// Slope of the triangle the point is on along x and z, and whether it is the cell's second triangle
+		PxF32 height, dx, dz;
+		bool second;
+
+		if (s[v0].tessFlag())
+		{
+			// The diagonal runs from v0 to v3
+			second = (fracZ > fracX);
+
+			if (second)
+			{
+				dx = h3 - h1;
+				dz = h1 - h0;
+			}
+			else
+			{
+				dx = h2 - h0;
+				dz = h3 - h2;
+			}
+
+			height = h0 + fracX * dx + fracZ * dz;
+		}
+		else
+		{
+			// The diagonal runs from v1 to v2
+			second = (fracX + fracZ >= 1.0f);
+
+			if (second)
+			{
+				dx = h3 - h1;
+				dz = h3 - h2;
+
+				height = h3 - (1.0f - fracX) * dx - (1.0f - fracZ) * dz;
+			}
+			else
+			{
+				dx = h2 - h0;
+				dz = h1 - h0;
+
+				height = h0 + fracX * dx + fracZ * dz;
+			}
+		}
+
+		if (batch.heights != NULL)
+			*(PxF32*)(batch.heights + i * batch.heightStride) = height;
+
+		if (batch.normals != NULL)
+			*(PxVec3*)(batch.normals + i * batch.normalStride) = PxVec3(-dx, 1.0f, -dz).getNormalized();
+
+		if (batch.materials != NULL)
+			*(PxU16*)(batch.materials + i * batch.materialStride) = second ? s[v0].materialIndex1 : s[v0].materialIndex0;
+	}
+}
\ No newline at end of file
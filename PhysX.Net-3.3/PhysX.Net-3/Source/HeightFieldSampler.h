@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+#include <foundation\PxSimpleTypes.h>
+#include <foundation\PxVec3.h>
+#include <geometry\PxHeightFieldSample.h>
+
+namespace physx
+{
+	class PxHeightField;
+};
+
+/// <summary>
+/// A batch of points to sample, and where to write the results. Any of the outputs may be NULL.
+/// </summary>
+struct HeightFieldSampleBatchUnmanaged
+{
+	// PxF32 pairs, x along the rows and z along the columns, in samples
+	const physx::PxU8* xz;
+	physx::PxU32 xzStride;
+	// PxF32
+	physx::PxU8* heights;
+	physx::PxU32 heightStride;
+	// PxVec3
+	physx::PxU8* normals;
+	physx::PxU32 normalStride;
+	// PxU16
+	physx::PxU8* materials;
+	physx::PxU32 materialStride;
+};
+
+/// <summary>
+/// Evaluates the height, normal and material of a height field at many points from a copy of its samples,
+/// interpolating over the triangles the same way PxHeightField::getHeight does.
+/// </summary>
+/// <remarks>
+/// Reading the samples directly avoids a virtual call per point. sample may be called for disjoint ranges of a batch
+/// from several threads.
+/// </remarks>
+class HeightFieldSampler
+{
+public:
+	explicit HeightFieldSampler(const physx::PxHeightField& heightField);
+
+	// Samples the points [begin, end) of a batch
+	void sample(const HeightFieldSampleBatchUnmanaged& batch, physx::PxU32 begin, physx::PxU32 end) const;
+
+private:
+	std::vector<physx::PxHeightFieldSample> samples;
+	physx::PxU32 rows;
+	physx::PxU32 columns;
+};
\ No newline at end of file
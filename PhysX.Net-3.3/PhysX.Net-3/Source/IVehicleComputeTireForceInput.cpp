@@ -1,3 +0,0 @@
-#include "StdAfx.h"
-#include "IVehicleComputeTireForceInput.h"
-
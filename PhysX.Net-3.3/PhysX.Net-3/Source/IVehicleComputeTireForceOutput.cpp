@@ -1,2 +0,0 @@
-#include "StdAfx.h"
-#include "IVehicleComputeTireForceOutput.h"
\ No newline at end of file
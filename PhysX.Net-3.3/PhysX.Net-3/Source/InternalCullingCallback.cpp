@@ -0,0 +1,85 @@
+#include "StdAfx.h"
+#include "InternalCullingCallback.h"
+
+#pragma managed(push, off)
+InternalCullingCallback::InternalCullingCallback(const PxPlane* planes, const PxU32* planeCounts, PxU32 volumeCount)
+	: PxHitCallback<PxOverlapHit>(_touches, TouchBufferSize)
+{
+	_planes = planes;
+	_planeCounts = planeCounts;
+	_volumeCount = volumeCount;
+}
+
+// Called for every batch of shapes the scene query trees find, so keep it native
+PxAgain InternalCullingCallback::processTouches(const PxOverlapHit* buffer, PxU32 nbHits)
+{
+	for (PxU32 i = 0; i < nbHits; i++)
+	{
+		const PxOverlapHit& hit = buffer[i];
+
+		PxBounds3 bounds = PxShapeExt::getWorldBounds(*hit.shape, *hit.actor, 1.0f);
+		PxVec3 center = bounds.getCenter();
+		PxVec3 extents = bounds.getExtents();
+
+		PxU32 mask = 0;
+		const PxPlane* planes = _planes;
+
+		for (PxU32 v = 0; v < _volumeCount; v++)
+		{
+			bool inside = true;
+
+			// Outside if the box is entirely in front of any plane
+			for (PxU32 p = 0; p < _planeCounts[v]; p++)
+			{
+				const PxPlane& plane = planes[p];
+
+				PxReal distance = plane.n.dot(center) + plane.d;
+				PxReal radius = PxAbs(plane.n.x) * extents.x + PxAbs(plane.n.y) * extents.y + PxAbs(plane.n.z) * extents.z;
+
+				if (distance - radius > 0)
+				{
+					inside = false;
+					break;
+				}
+			}
+
+			if (inside)
+				mask |= (1u << v);
+
+			planes += _planeCounts[v];
+		}
+
+		if (mask == 0)
+			continue;
+
+		// Actors with several shapes are reported once
+		std::unordered_map<PxActor*, PxU32>::iterator found = _indices.find(hit.actor);
+
+		if (found == _indices.end())
+		{
+			_indices[hit.actor] = (PxU32)_actors.size();
+			_actors.push_back(hit.actor);
+			_masks.push_back(mask);
+		}
+		else
+		{
+			_masks[found->second] |= mask;
+		}
+	}
+
+	return true;
+}
+
+PxU32 InternalCullingCallback::getActorCount() const
+{
+	return (PxU32)_actors.size();
+}
+PxActor* InternalCullingCallback::getActor(PxU32 index) const
+{
+	return _actors[index];
+}
+PxU32 InternalCullingCallback::getMask(PxU32 index) const
+{
+	return _masks[index];
+}
+#pragma managed(pop)
\ No newline at end of file
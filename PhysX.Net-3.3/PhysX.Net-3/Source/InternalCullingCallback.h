@@ -0,0 +1,34 @@
+#pragma once
+
+#include <unordered_map>
+
+/// <summary>
+/// Collects the actors with a shape whose world bounds are at least partly inside one of a set of convex volumes,
+/// as the scene query trees report the shapes overlapping the volumes' bounding box.
+/// </summary>
+class InternalCullingCallback : public PxOverlapCallback
+{
+private:
+	static const PxU32 TouchBufferSize = 256;
+
+	PxOverlapHit _touches[TouchBufferSize];
+
+	const PxPlane* _planes;
+	const PxU32* _planeCounts;
+	PxU32 _volumeCount;
+
+	// The visible actors in the order found, and the volumes each is visible in as a bit mask
+	std::vector<PxActor*> _actors;
+	std::vector<PxU32> _masks;
+	std::unordered_map<PxActor*, PxU32> _indices;
+
+public:
+	// The planes of each volume follow those of the previous one, with their normals pointing out of the volume
+	InternalCullingCallback(const PxPlane* planes, const PxU32* planeCounts, PxU32 volumeCount);
+
+	virtual PxAgain processTouches(const PxOverlapHit* buffer, PxU32 nbHits);
+
+	PxU32 getActorCount() const;
+	PxActor* getActor(PxU32 index) const;
+	PxU32 getMask(PxU32 index) const;
+};
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "StdAfx.h"
+#include "InternalProximityCallback.h"
+
+#include <algorithm>
+
+#pragma managed(push, off)
+InternalProximityCallback::InternalProximityCallback(const PxVec3& point)
+	: PxHitCallback<PxOverlapHit>(_touches, TouchBufferSize)
+{
+	_point = point;
+}
+
+// Keeps one entry per actor, however many of its shapes overlap
+PxAgain InternalProximityCallback::processTouches(const PxOverlapHit* buffer, PxU32 nbHits)
+{
+	for (PxU32 i = 0; i < nbHits; i++)
+	{
+		const PxOverlapHit& hit = buffer[i];
+
+		PxBounds3 bounds = PxShapeExt::getWorldBounds(*hit.shape, *hit.actor, 1.0f);
+
+		PxVec3 closest = _point.maximum(bounds.minimum).minimum(bounds.maximum);
+		PxReal distance = (closest - _point).magnitude();
+
+		// Actors with several shapes are reported once, at the distance of their closest shape
+		std::unordered_map<PxActor*, PxU32>::iterator found = _indices.find(hit.actor);
+
+		if (found == _indices.end())
+		{
+			_indices[hit.actor] = (PxU32)_actors.size();
+			_actors.push_back(std::make_pair(distance, (PxActor*)hit.actor));
+		}
+		else if (distance < _actors[found->second].first)
+		{
+			_actors[found->second].first = distance;
+		}
+	}
+
+	return true;
+}
+
+void InternalProximityCallback::dropActor(PxU32 index)
+{
+	_actors[index].second = NULL;
+}
+
+static bool IsDropped(const std::pair<PxReal, PxActor*>& actor)
+{
+	return actor.second == NULL;
+}
+
+void InternalProximityCallback::sortNearest(PxU32 count)
+{
+	_actors.erase(std::remove_if(_actors.begin(), _actors.end(), IsDropped), _actors.end());
+
+	count = PxMin(count, (PxU32)_actors.size());
+
+	std::partial_sort(_actors.begin(), _actors.begin() + count, _actors.end());
+}
+
+PxU32 InternalProximityCallback::getActorCount() const
+{
+	return (PxU32)_actors.size();
+}
+PxActor* InternalProximityCallback::getActor(PxU32 index) const
+{
+	return _actors[index].second;
+}
+PxReal InternalProximityCallback::getDistance(PxU32 index) const
+{
+	return _actors[index].first;
+}
+#pragma managed(pop)
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <unordered_map>
+
+/// <summary>
+/// Collects the actors with a shape overlapping a sphere together with their distance from its center,
+/// measured to the closest point of the shapes' world bounds.
+/// </summary>
+class InternalProximityCallback : public PxOverlapCallback
+{
+private:
+	static const PxU32 TouchBufferSize = 256;
+
+	PxOverlapHit _touches[TouchBufferSize];
+
+	PxVec3 _point;
+
+	// The actors in the order found with the distance to their closest shape
+	std::vector<std::pair<PxReal, PxActor*>> _actors;
+	std::unordered_map<PxActor*, PxU32> _indices;
+
+public:
+	InternalProximityCallback(const PxVec3& point);
+
+	virtual PxAgain processTouches(const PxOverlapHit* buffer, PxU32 nbHits);
+
+	// Marks an actor to be left out by sortNearest
+	void dropActor(PxU32 index);
+	// Removes the dropped actors, then orders the first count actors nearest first, leaving the order of the rest unspecified
+	void sortNearest(PxU32 count);
+
+	PxU32 getActorCount() const;
+	PxActor* getActor(PxU32 index) const;
+	PxReal getDistance(PxU32 index) const;
+};
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "StdAfx.h"
+#include "MemoryMappedInputData.h"
+
+MemoryMappedInputData::MemoryMappedInputData(String^ filename)
+{
+	ThrowIfNull(filename, "filename");
+
+	_data = NULL;
+	_length = 0;
+	_position = 0;
+
+	pin_ptr<const wchar_t> path = PtrToStringChars(filename);
+
+	HANDLE file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+
+	if (file == INVALID_HANDLE_VALUE)
+		throw gcnew System::IO::FileNotFoundException(String::Format("Failed to open file (error {0})", (int)GetLastError()), filename);
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size))
+	{
+		CloseHandle(file);
+		throw gcnew System::IO::IOException(String::Format("Failed to get the size of file '{0}'", filename));
+	}
+	if (size.QuadPart == 0)
+	{
+		CloseHandle(file);
+		throw gcnew System::IO::IOException(String::Format("File '{0}' is of zero length", filename));
+	}
+	if (size.QuadPart > 0xFFFFFFFF)
+	{
+		CloseHandle(file);
+		throw gcnew System::IO::IOException(String::Format("File '{0}' is too large, PhysX streams are limited to 4 GB", filename));
+	}
+
+	// Copy-on-write, binary deserialization fixes up pointers in place
+	HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+
+	if (mapping == NULL)
+	{
+		CloseHandle(file);
+		throw gcnew System::IO::IOException(String::Format("Failed to create a file mapping for '{0}' (error {1})", filename, (int)GetLastError()));
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+
+	// The view holds its own references to the mapping and file
+	CloseHandle(mapping);
+	CloseHandle(file);
+
+	if (view == NULL)
+		throw gcnew System::IO::IOException(String::Format("Failed to map a view of '{0}' (error {1})", filename, (int)GetLastError()));
+
+	_data = (PxU8*)view;
+	_length = (PxU32)size.QuadPart;
+}
+MemoryMappedInputData::~MemoryMappedInputData()
+{
+	if (_data != NULL)
+		UnmapViewOfFile(_data);
+
+	_data = NULL;
+	_length = 0;
+}
+
+PxU32 MemoryMappedInputData::read(void* dest, PxU32 count)
+{
+	PxU32 n = PxMin(count, _length - _position);
+
+	memcpy(dest, _data + _position, n);
+	_position += n;
+
+	return n;
+}
+
+PxU32 MemoryMappedInputData::getLength() const
+{
+	return _length;
+}
+
+void MemoryMappedInputData::seek(PxU32 offset)
+{
+	_position = PxMin(offset, _length);
+}
+
+PxU32 MemoryMappedInputData::tell() const
+{
+	return _position;
+}
+
+PxU8* MemoryMappedInputData::getData() const
+{
+	return _data;
+}
\ No newline at end of file
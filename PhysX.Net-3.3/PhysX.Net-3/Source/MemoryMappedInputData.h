@@ -0,0 +1,32 @@
+#pragma once
+
+namespace PhysX
+{
+	/// <summary>
+	/// A PxInputData implementation that reads directly from a copy-on-write view of a file.
+	/// Pages are only loaded as PhysX touches them and only become private memory when written to
+	/// (as in-place binary deserialization does), so loading never needs a second copy of the file.
+	/// </summary>
+	class MemoryMappedInputData : public PxInputData
+	{
+	private:
+		PxU8* _data;
+		PxU32 _length;
+		PxU32 _position;
+
+	public:
+		MemoryMappedInputData(String^ filename);
+		virtual ~MemoryMappedInputData();
+
+		virtual PxU32 read(void* dest, PxU32 count);
+		virtual PxU32 getLength() const;
+		virtual void seek(PxU32 offset);
+		virtual PxU32 tell() const;
+
+		/// <summary>
+		/// Gets the start of the mapped view. The view is aligned to the system allocation granularity (64 KB),
+		/// which satisfies the PX_SERIAL_FILE_ALIGN requirement of binary deserialization.
+		/// </summary>
+		PxU8* getData() const;
+	};
+};
\ No newline at end of file
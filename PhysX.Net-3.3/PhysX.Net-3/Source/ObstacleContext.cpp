@@ -2,6 +2,77 @@
 #include "ObstacleContext.h"
 #include "ControllerManager.h"
 
+namespace PhysX
+{
+	// Native layout of ObstacleState
+	struct ObstacleStateUnmanaged
+	{
+		PxVec3 position;
+		PxQuat rotation;
+		PxVec3 extents;
+	};
+};
+
+#pragma managed(push, off)
+static bool UpdateBoxObstacle(PxObstacleContext* context, ObstacleHandle handle, const PxObstacle* existing, const PhysX::ObstacleStateUnmanaged& state, bool updateExtents)
+{
+	PxBoxObstacle box = *static_cast<const PxBoxObstacle*>(existing);
+		box.mPos = PxExtendedVec3(state.position.x, state.position.y, state.position.z);
+		box.mRot = state.rotation;
+
+	if (updateExtents)
+		box.mHalfExtents = state.extents;
+
+	return context->updateObstacle(handle, box);
+}
+static bool UpdateCapsuleObstacle(PxObstacleContext* context, ObstacleHandle handle, const PxObstacle* existing, const PhysX::ObstacleStateUnmanaged& state, bool updateExtents)
+{
+	PxCapsuleObstacle capsule = *static_cast<const PxCapsuleObstacle*>(existing);
+		capsule.mPos = PxExtendedVec3(state.position.x, state.position.y, state.position.z);
+		capsule.mRot = state.rotation;
+
+	if (updateExtents)
+	{
+		capsule.mRadius = state.extents.x;
+		capsule.mHalfHeight = state.extents.y;
+	}
+
+	return context->updateObstacle(handle, capsule);
+}
+
+static int UpdateObstacleStates(PxObstacleContext* context, const ObstacleHandle* handles, const PhysX::ObstacleStateUnmanaged* states, PxU32 count, bool updateExtents)
+{
+	int updated = 0;
+
+	for (PxU32 i = 0; i < count; i++)
+	{
+		const PxObstacle* existing = context->getObstacleByHandle(handles[i]);
+
+		if (existing == NULL)
+			continue;
+
+		// Copy the existing obstacle so anything not in the state, such as its user data, is kept
+		bool ok = false;
+		switch (existing->getType())
+		{
+			case PxGeometryType::eBOX:
+				ok = UpdateBoxObstacle(context, handles[i], existing, states[i], updateExtents);
+				break;
+			case PxGeometryType::eCAPSULE:
+				ok = UpdateCapsuleObstacle(context, handles[i], existing, states[i], updateExtents);
+				break;
+			default:
+				break;
+		}
+
+		if (ok)
+			updated++;
+	}
+
+	return updated;
+}
+#pragma managed(pop)
+
 ObstacleContext::ObstacleContext(PxObstacleContext* context, ControllerManager^ owner)
 {
 	if (context == NULL)
@@ -69,6 +140,53 @@ bool ObstacleContext::UpdateObstacle(int handle, Obstacle^ obstacle)
 	return _context->updateObstacle(handle, *obstacle->UnmanagedPointer);
 }
 
+int ObstacleContext::UpdateObstacles(array<int>^ handles, array<ObstacleState>^ states, [Optional] bool updateExtents)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(handles, "handles");
+	ThrowIfNull(states, "states");
+
+	if (states->Length < handles->Length)
+		throw gcnew ArgumentException("There must be a state for each handle", "states");
+
+	if (handles->Length == 0)
+		return 0;
+
+	pin_ptr<int> h = &handles[0];
+	pin_ptr<ObstacleState> s = &states[0];
+
+	return UpdateObstacleStates(_context, (const ObstacleHandle*)h, (const ObstacleStateUnmanaged*)s, handles->Length, updateExtents);
+}
+
+ObstacleState ObstacleContext::GetObstacleState(int handle)
+{
+	ThrowIfThisDisposed();
+
+	const PxObstacle* obstacle = _context->getObstacleByHandle(handle);
+
+	if (obstacle == NULL)
+		throw gcnew ArgumentException(String::Format("No obstacle with handle {0} exists in the context", handle), "handle");
+
+	ObstacleState state;
+		state.Position = MathUtil::PxExtendedVec3ToVector3(obstacle->mPos);
+		state.Rotation = MathUtil::PxQuatToQuaternion(obstacle->mRot);
+
+	switch (obstacle->getType())
+	{
+		case PxGeometryType::eBOX:
+			state.Extents = MathUtil::PxVec3ToVector3(static_cast<const PxBoxObstacle*>(obstacle)->mHalfExtents);
+			break;
+		case PxGeometryType::eCAPSULE:
+			{
+				auto capsule = static_cast<const PxCapsuleObstacle*>(obstacle);
+				state.Extents = Vector3(capsule->mRadius, capsule->mHalfHeight, 0);
+			}
+			break;
+	}
+
+	return state;
+}
+
 Obstacle^ ObstacleContext::GetObstacle(int i)
 {
 	throw gcnew NotImplementedException();
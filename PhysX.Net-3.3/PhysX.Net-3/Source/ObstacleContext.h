@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Obstacle.h"
+#include "ObstacleState.h"
 
 namespace PhysX
 {
@@ -46,6 +47,20 @@ namespace PhysX
 		/// Updates data for an existing obstacle.
 		/// </summary>
 		bool UpdateObstacle(int handle, Obstacle^ obstacle);
+
+		/// <summary>
+		/// Updates many existing box and capsule obstacles in a single native call. Returns the number of obstacles updated,
+		/// handles which don't refer to an obstacle in the context are skipped.
+		/// </summary>
+		/// <param name="handles">The handles of the obstacles to update.</param>
+		/// <param name="states">The new state of each obstacle. Must be at least as long as handles.</param>
+		/// <param name="updateExtents">Whether to also update the size of the obstacles, or only their pose.</param>
+		int UpdateObstacles(array<int>^ handles, array<ObstacleState>^ states, [Optional] bool updateExtents);
+
+		/// <summary>
+		/// Gets the state of an obstacle by handle.
+		/// </summary>
+		ObstacleState GetObstacleState(int handle);
 		
 		/// <summary>
 		/// Retrieves desired obstacle.
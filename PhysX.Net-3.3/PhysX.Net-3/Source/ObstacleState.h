@@ -0,0 +1,30 @@
+#pragma once
+
+using namespace System::Runtime::InteropServices;
+
+namespace PhysX
+{
+	/// <summary>
+	/// The pose and size of an obstacle, for updating many obstacles at once with ObstacleContext.UpdateObstacles.
+	/// </summary>
+	[StructLayout(LayoutKind::Sequential)]
+	public value class ObstacleState
+	{
+	public:
+		/// <summary>
+		/// Gets or sets the position of the obstacle.
+		/// </summary>
+		property Vector3 Position;
+
+		/// <summary>
+		/// Gets or sets the rotation of the obstacle.
+		/// </summary>
+		property Quaternion Rotation;
+
+		/// <summary>
+		/// Gets or sets the size of the obstacle. For box obstacles these are the half extents, for capsule obstacles
+		/// X is the radius and Y is the half height.
+		/// </summary>
+		property Vector3 Extents;
+	};
+};
\ No newline at end of file
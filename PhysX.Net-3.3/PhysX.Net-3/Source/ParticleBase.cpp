@@ -5,11 +5,29 @@
 #include "ParticleReadData.h"
 #include "ParticleCreationData.h"
 #include "Physics.h"
+#include "ParticleIndexPool.h"
+#include "ParticleEmitter.h"
+
+static void CheckCount(BoundedData data, int count, String^ name)
+{
+	if (data.Count < count)
+		throw gcnew ArgumentOutOfRangeException(name, String::Format("{0} must hold at least {1} elements", name, count));
+}
+static void CheckOptionalCount(BoundedData data, int count, String^ name)
+{
+	if (data.Count != 0)
+		CheckCount(data, count, name);
+}
+static void CheckIndexBufferLength(array<int>^ indexBuffer, int count)
+{
+	if (indexBuffer->Length < count)
+		throw gcnew ArgumentException("indexBuffer must hold an index for each value", "indexBuffer");
+}
 
 ParticleBase::ParticleBase(PxParticleBase* particleBase, PhysX::Physics^ owner)
 	: Actor(particleBase, owner)
 {
-	
+	_emitters = gcnew List<ParticleEmitter^>();
 }
 
 ParticleReadData^ ParticleBase::LockParticleReadData()
@@ -21,17 +39,142 @@ int ParticleBase::CreateParticles(ParticleCreationData^ creationData)
 {
 	ThrowIfNull(creationData, "creationData");
 
-	PxParticleCreationData data = ParticleCreationData::ToUnmanaged(creationData);
+	creationData->Validate();
+
+	const int n = creationData->NumberOfParticles;
+
+	if (n == 0)
+		return 0;
+
+	array<int>^ indexBuffer = creationData->IndexBuffer;
+	array<Vector3>^ positionBuffer = creationData->PositionBuffer;
+	array<Vector3>^ velocityBuffer = creationData->VelocityBuffer;
+	array<float>^ restOffsetBuffer = creationData->RestOffsetBuffer;
+	array<int>^ flagBuffer = creationData->FlagBuffer;
+
+	// Pin the buffers in place instead of copying them
+	pin_ptr<int> i = nullptr;
+	pin_ptr<Vector3> p = nullptr;
+	pin_ptr<Vector3> v = nullptr;
+	pin_ptr<float> r = nullptr;
+	pin_ptr<int> f = nullptr;
+
+	PxParticleCreationData data;
+	data.numParticles = n;
+
+	if (indexBuffer != nullptr)
+	{
+		i = &indexBuffer[0];
+		data.indexBuffer = PxStrideIterator<const PxU32>((const PxU32*)i);
+	}
+	if (positionBuffer != nullptr)
+	{
+		p = &positionBuffer[0];
+		data.positionBuffer = PxStrideIterator<const PxVec3>((const PxVec3*)p);
+	}
+	if (velocityBuffer != nullptr)
+	{
+		v = &velocityBuffer[0];
+		data.velocityBuffer = PxStrideIterator<const PxVec3>((const PxVec3*)v);
+	}
+	if (restOffsetBuffer != nullptr)
+	{
+		r = &restOffsetBuffer[0];
+		data.restOffsetBuffer = PxStrideIterator<const PxF32>((const PxF32*)r);
+	}
+	if (flagBuffer != nullptr)
+	{
+		f = &flagBuffer[0];
+		data.flagBuffer = PxStrideIterator<const PxU32>((const PxU32*)f);
+	}
 
 	if (!data.isValid())
 		throw gcnew ArgumentException("Particle creation data is invalid", "creationData");
 
 	return this->UnmanagedPointer->createParticles(data);
 }
+int ParticleBase::CreateParticles(BoundedData positions, [Optional] BoundedData velocities, [Optional] BoundedData restOffsets, [Optional] BoundedData indices)
+{
+	const int n = positions.Count;
+
+	if (n <= 0)
+		return 0;
+
+	CheckOptionalCount(velocities, n, "velocities");
+	CheckOptionalCount(restOffsets, n, "restOffsets");
+	CheckOptionalCount(indices, n, "indices");
+
+	ParticleIndexPool^ pool = this->IndexPool;
+
+	GCHandle positionPin, velocityPin, restOffsetPin, indexPin;
+
+	try
+	{
+		PxBoundedData p = positions.ToUnmanaged(positionPin, sizeof(PxVec3));
+		PxBoundedData v = velocities.ToUnmanaged(velocityPin, sizeof(PxVec3));
+		PxBoundedData r = restOffsets.ToUnmanaged(restOffsetPin, sizeof(PxF32));
+		PxBoundedData i = indices.ToUnmanaged(indexPin, sizeof(PxU32));
+
+		// The SDK needs the indices even if the caller doesn't, reserve them into a reused array
+		pin_ptr<int> scratch = nullptr;
+		if (i.data == NULL)
+		{
+			if (_createIndices == nullptr || _createIndices->Length < n)
+				_createIndices = gcnew array<int>(n);
+
+			scratch = &_createIndices[0];
+
+			i.data = scratch;
+			i.stride = sizeof(PxU32);
+		}
+
+		PxU32* indexData = (PxU32*)i.data;
+
+		const PxU32 allocated = pool->Allocate(n, indexData, i.stride);
+
+		if (allocated == 0)
+			return 0;
+
+		PxParticleCreationData data;
+		data.numParticles = allocated;
+		data.indexBuffer = PxStrideIterator<const PxU32>(indexData, i.stride);
+		data.positionBuffer = PxStrideIterator<const PxVec3>((const PxVec3*)p.data, p.stride);
+		if (v.data != NULL)
+			data.velocityBuffer = PxStrideIterator<const PxVec3>((const PxVec3*)v.data, v.stride);
+		if (r.data != NULL)
+			data.restOffsetBuffer = PxStrideIterator<const PxF32>((const PxF32*)r.data, r.stride);
+
+		const PxU32 created = this->UnmanagedPointer->createParticles(data);
+
+		// Give back the indices of any particles the SDK couldn't create
+		if (created < allocated)
+			pool->Free(allocated - created, (const PxU32*)((PxU8*)indexData + created * i.stride), i.stride);
+
+		return created;
+	}
+	finally
+	{
+		if (positionPin.IsAllocated)
+			positionPin.Free();
+		if (velocityPin.IsAllocated)
+			velocityPin.Free();
+		if (restOffsetPin.IsAllocated)
+			restOffsetPin.Free();
+		if (indexPin.IsAllocated)
+			indexPin.Free();
+	}
+}
 
 void ParticleBase::ReleaseParticles()
 {
 	this->UnmanagedPointer->releaseParticles();
+
+	// The emitters' particles are gone, and their indices are about to be handed out again
+	for (int i = 0; i < _emitters->Count; i++)
+		_emitters[i]->Reset();
+
+	if (_indexPool != nullptr && !_indexPool->Disposed)
+		_indexPool->FreeAll();
 }
 void ParticleBase::ReleaseParticles(int numberOfParticles, [Optional] array<PxU32>^ indexBuffer)
 {
@@ -39,87 +182,222 @@ void ParticleBase::ReleaseParticles(int numberOfParticles, [Optional] array<PxU3
 	
 	if (indexBuffer->Length == 0)
 		return;
+	if (numberOfParticles < 0 || numberOfParticles > indexBuffer->Length)
+		throw gcnew ArgumentOutOfRangeException("numberOfParticles", "numberOfParticles must be between zero and the length of indexBuffer");
 
 	pin_ptr<PxU32> b = &indexBuffer[0];
 	const PxStrideIterator<PxU32> i(b);
 	
 	this->UnmanagedPointer->releaseParticles(numberOfParticles, i);
+
+	if (_indexPool != nullptr && !_indexPool->Disposed)
+		_indexPool->Free(numberOfParticles, b, sizeof(PxU32));
+}
+void ParticleBase::ReleaseParticles(BoundedData indices)
+{
+	GCHandle pin;
+
+	try
+	{
+		PxBoundedData i = indices.ToUnmanaged(pin, sizeof(PxU32));
+
+		if (i.count == 0)
+			return;
+
+		this->UnmanagedPointer->releaseParticles(i.count, PxStrideIterator<const PxU32>((const PxU32*)i.data, i.stride));
+
+		if (_indexPool != nullptr && !_indexPool->Disposed)
+			_indexPool->Free(i.count, (const PxU32*)i.data, i.stride);
+	}
+	finally
+	{
+		if (pin.IsAllocated)
+			pin.Free();
+	}
 }
 
 void ParticleBase::SetPositions(array<Vector3>^ positions, array<int>^ indexBuffer)
 {
 	ThrowIfNull(positions, "positions");
 	ThrowIfNull(indexBuffer, "indexBuffer");
-	if (indexBuffer->Length == 0)
+	if (indexBuffer->Length == 0 || positions->Length == 0)
 		return;
+	CheckIndexBufferLength(indexBuffer, positions->Length);
 
-	PxVec3* p = (PxVec3*)malloc(sizeof(PxVec3) * positions->Length);
-	Util::AsUnmanagedArray(positions, p);
-	const PxStrideIterator<PxVec3> pos(p);
-
+	pin_ptr<Vector3> p = &positions[0];
 	pin_ptr<int> b = &indexBuffer[0];
-	const PxStrideIterator<PxU32> i((PxU32*)b);
 
-	this->UnmanagedPointer->setPositions(positions->Length, i, pos);
+	this->UnmanagedPointer->setPositions(positions->Length, PxStrideIterator<const PxU32>((const PxU32*)b), PxStrideIterator<const PxVec3>((const PxVec3*)p));
+}
+void ParticleBase::SetPositions(BoundedData positions, BoundedData indices)
+{
+	const int n = indices.Count;
+	if (n <= 0)
+		return;
+	CheckCount(positions, n, "positions");
+
+	GCHandle positionPin, indexPin;
 
-	free(p);
+	try
+	{
+		PxBoundedData p = positions.ToUnmanaged(positionPin, sizeof(PxVec3));
+		PxBoundedData i = indices.ToUnmanaged(indexPin, sizeof(PxU32));
+
+		this->UnmanagedPointer->setPositions(n, PxStrideIterator<const PxU32>((const PxU32*)i.data, i.stride), PxStrideIterator<const PxVec3>((const PxVec3*)p.data, p.stride));
+	}
+	finally
+	{
+		if (positionPin.IsAllocated)
+			positionPin.Free();
+		if (indexPin.IsAllocated)
+			indexPin.Free();
+	}
 }
 
 void ParticleBase::SetVelocities(array<Vector3>^ velocities, array<int>^ indexBuffer)
 {
 	ThrowIfNull(velocities, "velocities");
 	ThrowIfNull(indexBuffer, "indexBuffer");
-	if (indexBuffer->Length == 0)
+	if (indexBuffer->Length == 0 || velocities->Length == 0)
 		return;
+	CheckIndexBufferLength(indexBuffer, velocities->Length);
 
-	PxVec3* v = (PxVec3*)malloc(sizeof(PxVec3) * velocities->Length);
-	Util::AsUnmanagedArray(velocities, v);
-	const PxStrideIterator<PxVec3> vel(v);
-
+	pin_ptr<Vector3> v = &velocities[0];
 	pin_ptr<int> b = &indexBuffer[0];
-	const PxStrideIterator<PxU32> i((PxU32*)b);
 
-	this->UnmanagedPointer->setVelocities(velocities->Length, i, vel);
+	this->UnmanagedPointer->setVelocities(velocities->Length, PxStrideIterator<const PxU32>((const PxU32*)b), PxStrideIterator<const PxVec3>((const PxVec3*)v));
+}
+void ParticleBase::SetVelocities(BoundedData velocities, BoundedData indices)
+{
+	const int n = indices.Count;
+	if (n <= 0)
+		return;
+	CheckCount(velocities, n, "velocities");
+
+	GCHandle velocityPin, indexPin;
+
+	try
+	{
+		PxBoundedData v = velocities.ToUnmanaged(velocityPin, sizeof(PxVec3));
+		PxBoundedData i = indices.ToUnmanaged(indexPin, sizeof(PxU32));
 
-	free(v);
+		this->UnmanagedPointer->setVelocities(n, PxStrideIterator<const PxU32>((const PxU32*)i.data, i.stride), PxStrideIterator<const PxVec3>((const PxVec3*)v.data, v.stride));
+	}
+	finally
+	{
+		if (velocityPin.IsAllocated)
+			velocityPin.Free();
+		if (indexPin.IsAllocated)
+			indexPin.Free();
+	}
 }
 
-void ParticleBase::SetRestOffsets(array<Vector3>^ restOffsets, array<int>^ indexBuffer)
+void ParticleBase::SetRestOffsets(array<float>^ restOffsets, array<int>^ indexBuffer)
 {
 	ThrowIfNull(restOffsets, "restOffsets");
 	ThrowIfNull(indexBuffer, "indexBuffer");
-	if (indexBuffer->Length == 0)
+	if (indexBuffer->Length == 0 || restOffsets->Length == 0)
 		return;
+	CheckIndexBufferLength(indexBuffer, restOffsets->Length);
 
-	float* r = (float*)malloc(sizeof(float) * restOffsets->Length);
-	Util::AsUnmanagedArray(restOffsets, r);
-	const PxStrideIterator<float> rest(r);
-
+	pin_ptr<float> r = &restOffsets[0];
 	pin_ptr<int> b = &indexBuffer[0];
-	const PxStrideIterator<PxU32> i((PxU32*)b);
 
-	this->UnmanagedPointer->setRestOffsets(restOffsets->Length, i, rest);
+	this->UnmanagedPointer->setRestOffsets(restOffsets->Length, PxStrideIterator<const PxU32>((const PxU32*)b), PxStrideIterator<const PxF32>((const PxF32*)r));
+}
+void ParticleBase::SetRestOffsets(BoundedData restOffsets, BoundedData indices)
+{
+	const int n = indices.Count;
+	if (n <= 0)
+		return;
+	CheckCount(restOffsets, n, "restOffsets");
+
+	GCHandle restOffsetPin, indexPin;
+
+	try
+	{
+		PxBoundedData r = restOffsets.ToUnmanaged(restOffsetPin, sizeof(PxF32));
+		PxBoundedData i = indices.ToUnmanaged(indexPin, sizeof(PxU32));
 
-	free(r);
+		this->UnmanagedPointer->setRestOffsets(n, PxStrideIterator<const PxU32>((const PxU32*)i.data, i.stride), PxStrideIterator<const PxF32>((const PxF32*)r.data, r.stride));
+	}
+	finally
+	{
+		if (restOffsetPin.IsAllocated)
+			restOffsetPin.Free();
+		if (indexPin.IsAllocated)
+			indexPin.Free();
+	}
 }
 
 void ParticleBase::AddForces(array<Vector3>^ forces, array<int>^ indexBuffer, ForceMode forceMode)
 {
 	ThrowIfNull(forces, "forces");
 	ThrowIfNull(indexBuffer, "indexBuffer");
-	if (indexBuffer->Length == 0)
+	if (indexBuffer->Length == 0 || forces->Length == 0)
 		return;
+	CheckIndexBufferLength(indexBuffer, forces->Length);
 
-	PxVec3* f = (PxVec3*)malloc(sizeof(PxVec3) * forces->Length);
-	Util::AsUnmanagedArray(forces, f);
-	const PxStrideIterator<PxVec3> fi(f);
-
+	pin_ptr<Vector3> f = &forces[0];
 	pin_ptr<int> b = &indexBuffer[0];
-	const PxStrideIterator<PxU32> i((PxU32*)b);
 
-	this->UnmanagedPointer->addForces(forces->Length, i, fi, ToUnmanagedEnum(PxForceMode, forceMode));
+	this->UnmanagedPointer->addForces(forces->Length, PxStrideIterator<const PxU32>((const PxU32*)b), PxStrideIterator<const PxVec3>((const PxVec3*)f), ToUnmanagedEnum(PxForceMode, forceMode));
+}
+void ParticleBase::AddForces(BoundedData forces, BoundedData indices, ForceMode forceMode)
+{
+	const int n = indices.Count;
+	if (n <= 0)
+		return;
+	CheckCount(forces, n, "forces");
 
-	free(f);
+	GCHandle forcePin, indexPin;
+
+	try
+	{
+		PxBoundedData f = forces.ToUnmanaged(forcePin, sizeof(PxVec3));
+		PxBoundedData i = indices.ToUnmanaged(indexPin, sizeof(PxU32));
+
+		this->UnmanagedPointer->addForces(n, PxStrideIterator<const PxU32>((const PxU32*)i.data, i.stride), PxStrideIterator<const PxVec3>((const PxVec3*)f.data, f.stride), ToUnmanagedEnum(PxForceMode, forceMode));
+	}
+	finally
+	{
+		if (forcePin.IsAllocated)
+			forcePin.Free();
+		if (indexPin.IsAllocated)
+			indexPin.Free();
+	}
+}
+
+ParticleIndexPool^ ParticleBase::IndexPool::get()
+{
+	if (_indexPool == nullptr)
+		_indexPool = gcnew ParticleIndexPool(this);
+
+	return _indexPool;
+}
+
+int ParticleBase::UpdateEmitters(float elapsedTime)
+{
+	int emitted = 0;
+
+	for (int i = 0; i < _emitters->Count; i++)
+		emitted += _emitters[i]->Update(elapsedTime);
+
+	return emitted;
+}
+
+IEnumerable<ParticleEmitter^>^ ParticleBase::Emitters::get()
+{
+	return _emitters->AsReadOnly();
+}
+
+void ParticleBase::AddEmitter(ParticleEmitter^ emitter)
+{
+	_emitters->Add(emitter);
+}
+void ParticleBase::RemoveEmitter(ParticleEmitter^ emitter)
+{
+	_emitters->Remove(emitter);
 }
 
 float ParticleBase::Damping::get()
@@ -2,11 +2,14 @@
 
 #include "Actor.h"
 #include "ParticleEnum.h"
+#include "BoundedData.h"
 
 namespace PhysX
 {
 	ref class ParticleReadData;
 	ref class ParticleCreationData;
+	ref class ParticleIndexPool;
+	ref class ParticleEmitter;
 	value class FilterData;
 
 	/// <summary>
@@ -14,6 +17,11 @@ namespace PhysX
 	/// </summary>
 	public ref class ParticleBase abstract : Actor
 	{
+		private:
+			ParticleIndexPool^ _indexPool;
+			array<int>^ _createIndices;
+			List<ParticleEmitter^>^ _emitters;
+
 		internal:
 			ParticleBase(PxParticleBase* particleBase, PhysX::Physics^ owner);
 
@@ -36,6 +44,15 @@ namespace PhysX
 			/// </summary>
 			/// <returns>Number of successfully created particles.</returns>
 			int CreateParticles(ParticleCreationData^ creationData);
+			/// <summary>
+			/// Creates new particles at indices reserved from IndexPool, reading their data in place from the given buffers.
+			/// </summary>
+			/// <param name="positions">The positions of the new particles as Vector3. Its Count is the number of particles to create.</param>
+			/// <param name="velocities">The velocities of the new particles as Vector3, or empty for zero velocity.</param>
+			/// <param name="restOffsets">The rest offsets of the new particles as float, or empty. Only used when the particle system was created with per particle rest offsets.</param>
+			/// <param name="indices">Receives the index of each new particle as int, or empty when the indices aren't needed.</param>
+			/// <returns>Number of successfully created particles, fewer than requested when the pool runs out of indices.</returns>
+			int CreateParticles(BoundedData positions, [Optional] BoundedData velocities, [Optional] BoundedData restOffsets, [Optional] BoundedData indices);
 
 			/// <summary>
 			/// Releases all particles.
@@ -51,6 +68,11 @@ namespace PhysX
 			/// <param name="numberOfParticles">Number of particles to be released.</param>
 			/// <param name="indexBuffer">Structure describing indices of particles that should be deleted. (Has to be consistent with numParticles).</param>
 			void ReleaseParticles(int numberOfParticles, [Optional] array<PxU32>^ indexBuffer);
+			/// <summary>
+			/// Releases particles, returning their indices to IndexPool if it is in use.
+			/// </summary>
+			/// <param name="indices">The indices of the particles to release as int. Passing duplicate indices is not allowed.</param>
+			void ReleaseParticles(BoundedData indices);
 
 			/// <summary>
 			/// Sets particle positions.
@@ -61,6 +83,12 @@ namespace PhysX
 			/// <param name="positions">Structure describing positions for position updates. (Has to be consistent with numParticles).</param>
 			/// <param name="indexBuffer">Structure describing indices of particles that should be updated. (Has to be consistent with numParticles).</param>
 			void SetPositions(array<Vector3>^ positions, array<int>^ indexBuffer);
+			/// <summary>
+			/// Sets particle positions, reading them in place from the given buffers.
+			/// </summary>
+			/// <param name="positions">The new positions as Vector3, one per index.</param>
+			/// <param name="indices">The indices of the particles to update as int.</param>
+			void SetPositions(BoundedData positions, BoundedData indices);
 
 			/// <summary>
 			/// Sets particle velocities.
@@ -71,6 +99,12 @@ namespace PhysX
 			/// <param name="positions">Structure describing indices of particles that should be updated. (Has to be consistent with numParticles).</param>
 			/// <param name="indexBuffer">Structure describing velocities for velocity updates. (Has to be consistent with numParticles).</param>
 			void SetVelocities(array<Vector3>^ positions, array<int>^ indexBuffer);
+			/// <summary>
+			/// Sets particle velocities, reading them in place from the given buffers.
+			/// </summary>
+			/// <param name="velocities">The new velocities as Vector3, one per index.</param>
+			/// <param name="indices">The indices of the particles to update as int.</param>
+			void SetVelocities(BoundedData velocities, BoundedData indices);
 
 			/// <summary>
 			/// Sets particle rest offsets.
@@ -80,7 +114,13 @@ namespace PhysX
 			/// </summary>
 			/// <param name="positions">Structure describing indices of particles that should be updated. (Has to be consistent with numParticles).</param>
 			/// <param name="indexBuffer">Structure describing indices of particles that should be updated. (Has to be consistent with numParticles).</param>
-			void SetRestOffsets(array<Vector3>^ positions, array<int>^ indexBuffer);
+			void SetRestOffsets(array<float>^ restOffsets, array<int>^ indexBuffer);
+			/// <summary>
+			/// Sets particle rest offsets, reading them in place from the given buffers.
+			/// </summary>
+			/// <param name="restOffsets">The new rest offsets as float, one per index.</param>
+			/// <param name="indices">The indices of the particles to update as int.</param>
+			void SetRestOffsets(BoundedData restOffsets, BoundedData indices);
 
 			/// <summary>
 			/// Set forces to be applied to the particles when the simulation starts.
@@ -90,6 +130,38 @@ namespace PhysX
 			/// <param name="indexBuffer">Structure describing indices of particles that should be updated. (Has to be consistent with numParticles).</param>
 			/// <param name="forceMode">Describes type of update.</param>
 			void AddForces(array<Vector3>^ positions, array<int>^ indexBuffer, ForceMode forceMode);
+			/// <summary>
+			/// Set forces to be applied to the particles when the simulation starts, reading them in place from the given buffers.
+			/// This call is ignored on particle system that aren't assigned to a scene.
+			/// </summary>
+			/// <param name="forces">The values as Vector3, one per index, interpreted according to forceMode.</param>
+			/// <param name="indices">The indices of the particles to update as int.</param>
+			/// <param name="forceMode">Describes type of update.</param>
+			void AddForces(BoundedData forces, BoundedData indices, ForceMode forceMode);
+
+			/// <summary>
+			/// Gets the pool of free particle indices of this particle system, creating it on first use.
+			/// The pool is disposed with the particle system.
+			/// </summary>
+			property ParticleIndexPool^ IndexPool
+			{
+				ParticleIndexPool^ get();
+			}
+
+			/// <summary>
+			/// Updates every emitter of this particle system, see ParticleEmitter.Update.
+			/// </summary>
+			/// <param name="elapsedTime">The time since the last update in seconds.</param>
+			/// <returns>The number of particles emitted.</returns>
+			int UpdateEmitters(float elapsedTime);
+
+			/// <summary>
+			/// Gets the emitters of this particle system.
+			/// </summary>
+			property IEnumerable<ParticleEmitter^>^ Emitters
+			{
+				IEnumerable<ParticleEmitter^>^ get();
+			}
 
 			/// <summary>
 			/// Gets or sets the particle system damping (must be nonnegative).
@@ -226,6 +298,9 @@ namespace PhysX
 			}
 
 		internal:
+			void AddEmitter(ParticleEmitter^ emitter);
+			void RemoveEmitter(ParticleEmitter^ emitter);
+
 			property PxParticleBase* UnmanagedPointer
 			{
 				PxParticleBase* get() new;
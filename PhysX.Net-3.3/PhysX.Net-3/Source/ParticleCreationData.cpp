@@ -1,49 +1,20 @@
 #include "StdAfx.h"
 #include "ParticleCreationData.h"
 
-PxParticleCreationData ParticleCreationData::ToUnmanaged(ParticleCreationData^ data)
+static void CheckBufferLength(Array^ buffer, int numberOfParticles, String^ name)
 {
-	ThrowIfNull(data, "data");
+	if (buffer != nullptr && buffer->Length < numberOfParticles)
+		throw gcnew ArgumentException(String::Format("{0} must hold at least NumberOfParticles elements", name), name);
+}
 
-	int n = data->NumberOfParticles;
-
-	PxParticleCreationData d;
-		d.numParticles = data->NumberOfParticles;
-	
-	if (data->IndexBuffer != nullptr)
-	{
-		PxU32* i = new PxU32[n];
-		Util::AsUnmanagedArray(data->IndexBuffer, i, n);
-		d.indexBuffer = PxStrideIterator<const PxU32>(i);
-	}
-
-	if (data->PositionBuffer != nullptr)
-	{
-		PxVec3* p = new PxVec3[n];
-		Util::AsUnmanagedArray(data->PositionBuffer, p, n);
-		d.positionBuffer = PxStrideIterator<const PxVec3>(p);
-	}
-
-	if (data->VelocityBuffer != nullptr)
-	{
-		PxVec3* v = new PxVec3[n];
-		Util::AsUnmanagedArray(data->VelocityBuffer, v, n);
-		d.velocityBuffer = PxStrideIterator<const PxVec3>(v);
-	}
-
-	if (data->RestOffsetBuffer != nullptr)
-	{
-		float* r = new float[n];
-		Util::AsUnmanagedArray(data->RestOffsetBuffer, r, n);
-		d.restOffsetBuffer = PxStrideIterator<const float>(r);
-	}
+void ParticleCreationData::Validate()
+{
+	if (this->NumberOfParticles < 0)
+		throw gcnew ArgumentOutOfRangeException("NumberOfParticles", "NumberOfParticles cannot be negative");
 
-	if (data->FlagBuffer != nullptr)
-	{
-		PxU32* f = new PxU32[n];
-		Util::AsUnmanagedArray(data->FlagBuffer, f, n);
-		d.flagBuffer = PxStrideIterator<const PxU32>(f);
-	}
-	
-	return d;
+	CheckBufferLength(this->IndexBuffer, this->NumberOfParticles, "IndexBuffer");
+	CheckBufferLength(this->PositionBuffer, this->NumberOfParticles, "PositionBuffer");
+	CheckBufferLength(this->VelocityBuffer, this->NumberOfParticles, "VelocityBuffer");
+	CheckBufferLength(this->RestOffsetBuffer, this->NumberOfParticles, "RestOffsetBuffer");
+	CheckBufferLength(this->FlagBuffer, this->NumberOfParticles, "FlagBuffer");
 }
\ No newline at end of file
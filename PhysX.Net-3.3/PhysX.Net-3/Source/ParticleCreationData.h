@@ -9,7 +9,8 @@ namespace PhysX
 	public ref class ParticleCreationData
 	{
 		internal:
-			static PxParticleCreationData ToUnmanaged(ParticleCreationData^ data);
+			// Throws if a buffer holds fewer than NumberOfParticles elements, the buffers are pinned in place when creating
+			void Validate();
 
 		public:
 			property int NumberOfParticles;
@@ -17,7 +18,7 @@ namespace PhysX
 			property array<int>^ IndexBuffer;
 			property array<Vector3>^ PositionBuffer;
 			property array<Vector3>^ VelocityBuffer;
-			property array<Vector3>^ RestOffsetBuffer;
+			property array<float>^ RestOffsetBuffer;
 			property array<int>^ FlagBuffer;
 	};
 };
\ No newline at end of file
@@ -0,0 +1,486 @@
+#include "StdAfx.h"
+#include "ParticleEmitter.h"
+#include "ParticleBase.h"
+#include "ParticleFluid.h"
+#include "ParticleIndexPool.h"
+#include "RigidActor.h"
+
+// Native mirrors of ParticleEmitterType, ParticleEmitterShape and ParticleEmitterFlag
+static const PxU32 ConstantPressureType = 0;
+static const PxU32 RectangleShape = 1;
+static const PxU32 EllipseShape = 2;
+static const PxU32 EnabledFlag = (1 << 0);
+static const PxU32 AddActorVelocityFlag = (1 << 1);
+
+// Emission and recycling run every step for potentially thousands of particles, keep them free of managed transitions
+#pragma managed(push, off)
+InternalParticleEmitter::InternalParticleEmitter(PxU32 maxParticles)
+{
+	this->localPose = PxTransform(PxIdentity);
+	this->type = ConstantPressureType;
+	this->shape = RectangleShape;
+	this->flags = EnabledFlag;
+	this->dimensionX = 0.25f;
+	this->dimensionY = 0.25f;
+	this->randomPosition = PxVec3(0);
+	this->randomAngle = 0;
+	this->velocityMagnitude = 1;
+	this->rate = 100;
+	this->particleSpacing = 0.1f;
+	this->particleLifetime = 0;
+
+	this->liveIndices = new PxU32[maxParticles];
+	this->expiryTimes = new PxF64[maxParticles];
+	this->maxParticles = maxParticles;
+	this->head = 0;
+	this->liveCount = 0;
+	this->nextExpiry = PX_MAX_F64;
+
+	this->time = 0;
+	this->pending = 0;
+	this->seed = 0x9E3779B9;
+
+	// Sized once so updates never allocate
+	this->newIndices.resize(maxParticles);
+	this->newPositions.resize(maxParticles);
+	this->newVelocities.resize(maxParticles);
+	this->expiredIndices.resize(maxParticles);
+}
+InternalParticleEmitter::~InternalParticleEmitter()
+{
+	delete[] this->liveIndices;
+	delete[] this->expiryTimes;
+}
+
+PxU32 InternalParticleEmitter::update(PxParticleBase* particles, PxParticleExt::IndexPool* pool, const PxRigidActor* frameActor, PxF32 elapsedTime, PxU32& released)
+{
+	this->time += elapsedTime;
+
+	released = recycle(particles, pool);
+
+	if ((this->flags & EnabledFlag) == 0)
+	{
+		this->pending = 0;
+		return 0;
+	}
+
+	this->pending += emissionRate() * elapsedTime;
+
+	PxU32 count = (PxU32)this->pending;
+	this->pending -= count;
+
+	// Particles that don't fit are dropped rather than emitted in a burst once space frees up
+	count = PxMin(count, this->maxParticles - this->liveCount);
+
+	if (count == 0)
+		return 0;
+
+	return emit(particles, pool, frameActor, count);
+}
+
+PxU32 InternalParticleEmitter::releaseAll(PxParticleBase* particles, PxParticleExt::IndexPool* pool)
+{
+	const PxU32 n = this->liveCount;
+
+	if (n == 0)
+		return 0;
+
+	for (PxU32 i = 0; i < n; i++)
+		this->expiredIndices[i] = this->liveIndices[(this->head + i) % this->maxParticles];
+
+	const PxStrideIterator<const PxU32> indices(&this->expiredIndices[0]);
+
+	particles->releaseParticles(n, indices);
+	pool->freeIndices(n, indices);
+
+	reset();
+
+	return n;
+}
+
+void InternalParticleEmitter::reset()
+{
+	this->head = 0;
+	this->liveCount = 0;
+	this->nextExpiry = PX_MAX_F64;
+}
+
+PxF32 InternalParticleEmitter::emissionRate() const
+{
+	if (this->type != ConstantPressureType)
+		return this->rate;
+
+	const PxF32 spacing = this->particleSpacing;
+
+	if (spacing <= 0)
+		return 0;
+
+	PxF32 area;
+	if (this->shape == RectangleShape)
+		area = 4 * this->dimensionX * this->dimensionY;
+	else if (this->shape == EllipseShape)
+		area = PxPi * this->dimensionX * this->dimensionY;
+	else
+		area = 0;
+
+	// A surface smaller than one particle still carries a single stream of particles
+	area = PxMax(area, spacing * spacing);
+
+	return area * this->velocityMagnitude / (spacing * spacing * spacing);
+}
+
+PxU32 InternalParticleEmitter::recycle(PxParticleBase* particles, PxParticleExt::IndexPool* pool)
+{
+	if (this->nextExpiry > this->time)
+		return 0;
+
+	// Move the expired particles out and compact the rest towards the head, keeping their order
+	PxU32 n = 0;
+	PxU32 kept = 0;
+	PxF64 nextExpiry = PX_MAX_F64;
+
+	for (PxU32 i = 0; i < this->liveCount; i++)
+	{
+		const PxU32 slot = (this->head + i) % this->maxParticles;
+		const PxF64 expiry = this->expiryTimes[slot];
+
+		if (expiry <= this->time)
+		{
+			this->expiredIndices[n++] = this->liveIndices[slot];
+			continue;
+		}
+
+		const PxU32 keptSlot = (this->head + kept++) % this->maxParticles;
+
+		this->liveIndices[keptSlot] = this->liveIndices[slot];
+		this->expiryTimes[keptSlot] = expiry;
+
+		nextExpiry = PxMin(nextExpiry, expiry);
+	}
+
+	this->liveCount = kept;
+	this->nextExpiry = nextExpiry;
+
+	if (n == 0)
+		return 0;
+
+	const PxStrideIterator<const PxU32> indices(&this->expiredIndices[0]);
+
+	particles->releaseParticles(n, indices);
+	pool->freeIndices(n, indices);
+
+	return n;
+}
+
+PxU32 InternalParticleEmitter::emit(PxParticleBase* particles, PxParticleExt::IndexPool* pool, const PxRigidActor* frameActor, PxU32 count)
+{
+	const PxU32 allocated = pool->allocateIndices(count, PxStrideIterator<PxU32>(&this->newIndices[0]));
+
+	if (allocated == 0)
+		return 0;
+
+	const PxTransform pose = (frameActor != NULL ? frameActor->getGlobalPose() * this->localPose : this->localPose);
+	const PxRigidBody* body = (frameActor != NULL && (this->flags & AddActorVelocityFlag) != 0 ? frameActor->is<PxRigidBody>() : NULL);
+
+	const PxF32 cosMaxAngle = PxCos(this->randomAngle);
+
+	for (PxU32 i = 0; i < allocated; i++)
+	{
+		PxVec3 local(0);
+
+		if (this->shape == RectangleShape)
+		{
+			local.x = (random() * 2 - 1) * this->dimensionX;
+			local.y = (random() * 2 - 1) * this->dimensionY;
+		}
+		else if (this->shape == EllipseShape)
+		{
+			// Square root of the radius spreads the particles evenly over the area
+			const PxF32 r = PxSqrt(random());
+			const PxF32 a = random() * 2 * PxPi;
+
+			local.x = r * PxCos(a) * this->dimensionX;
+			local.y = r * PxSin(a) * this->dimensionY;
+		}
+
+		local.x += (random() * 2 - 1) * this->randomPosition.x;
+		local.y += (random() * 2 - 1) * this->randomPosition.y;
+		local.z += (random() * 2 - 1) * this->randomPosition.z;
+
+		// Uniform direction within the cone of randomAngle around Z
+		const PxF32 cosTheta = 1 - random() * (1 - cosMaxAngle);
+		const PxF32 sinTheta = PxSqrt(PxMax(0.0f, 1 - cosTheta * cosTheta));
+		const PxF32 phi = random() * 2 * PxPi;
+
+		const PxVec3 direction(sinTheta * PxCos(phi), sinTheta * PxSin(phi), cosTheta);
+
+		const PxVec3 position = pose.transform(local);
+		PxVec3 velocity = pose.rotate(direction) * this->velocityMagnitude;
+
+		if (body != NULL)
+			velocity += PxRigidBodyExt::getVelocityAtPos(*body, position);
+
+		this->newPositions[i] = position;
+		this->newVelocities[i] = velocity;
+	}
+
+	PxParticleCreationData data;
+	data.numParticles = allocated;
+	data.indexBuffer = PxStrideIterator<const PxU32>(&this->newIndices[0]);
+	data.positionBuffer = PxStrideIterator<const PxVec3>(&this->newPositions[0]);
+	data.velocityBuffer = PxStrideIterator<const PxVec3>(&this->newVelocities[0]);
+
+	const PxU32 created = particles->createParticles(data);
+
+	if (created < allocated)
+		pool->freeIndices(allocated - created, PxStrideIterator<const PxU32>(&this->newIndices[created]));
+
+	const PxF64 expiry = (this->particleLifetime > 0 ? this->time + this->particleLifetime : PX_MAX_F64);
+
+	if (created > 0)
+		this->nextExpiry = PxMin(this->nextExpiry, expiry);
+
+	for (PxU32 i = 0; i < created; i++)
+	{
+		const PxU32 slot = (this->head + this->liveCount) % this->maxParticles;
+
+		this->liveIndices[slot] = this->newIndices[i];
+		this->expiryTimes[slot] = expiry;
+		this->liveCount++;
+	}
+
+	return created;
+}
+
+PxF32 InternalParticleEmitter::random()
+{
+	// xorshift32, plenty for scattering particles
+	this->seed ^= this->seed << 13;
+	this->seed ^= this->seed >> 17;
+	this->seed ^= this->seed << 5;
+
+	return (this->seed >> 8) * (1.0f / 16777216.0f);
+}
+#pragma managed(pop)
+
+ParticleEmitter::ParticleEmitter(PhysX::ParticleBase^ particleBase, int maximumParticles)
+{
+	ThrowIfNullOrDisposed(particleBase, "particleBase");
+
+	if (maximumParticles <= 0)
+		throw gcnew ArgumentOutOfRangeException("maximumParticles", "maximumParticles must be greater than zero");
+
+	_emitter = new InternalParticleEmitter(maximumParticles);
+	_particleBase = particleBase;
+
+	ParticleFluid^ fluid = dynamic_cast<ParticleFluid^>(particleBase);
+	if (fluid != nullptr)
+		_emitter->particleSpacing = fluid->RestParticleDistance;
+
+	ObjectTable::AddObjectOwner(this, particleBase);
+
+	particleBase->AddEmitter(this);
+}
+ParticleEmitter::~ParticleEmitter()
+{
+	this->!ParticleEmitter();
+}
+ParticleEmitter::!ParticleEmitter()
+{
+	OnDisposing(this, nullptr);
+
+	if (this->Disposed)
+		return;
+
+	_particleBase->RemoveEmitter(this);
+
+	SAFE_DELETE(_emitter);
+
+	_particleBase = nullptr;
+	_frameActor = nullptr;
+
+	OnDisposed(this, nullptr);
+}
+bool ParticleEmitter::Disposed::get()
+{
+	return (_emitter == NULL);
+}
+
+int ParticleEmitter::Update(float elapsedTime)
+{
+	ThrowIfThisDisposed();
+
+	ParticleIndexPool^ pool = _particleBase->IndexPool;
+	ThrowIfNullOrDisposed(pool, "IndexPool");
+
+	PxRigidActor* frameActor = NULL;
+	if (_frameActor != nullptr)
+	{
+		ThrowIfNullOrDisposed(_frameActor, "FrameActor");
+
+		frameActor = _frameActor->UnmanagedPointer;
+	}
+
+	PxU32 released;
+	PxU32 emitted = _emitter->update(_particleBase->UnmanagedPointer, pool->UnmanagedPointer, frameActor, elapsedTime, released);
+
+	pool->TrackIndices(emitted, released);
+
+	return emitted;
+}
+
+void ParticleEmitter::ReleaseParticles()
+{
+	ThrowIfThisDisposed();
+
+	ParticleIndexPool^ pool = _particleBase->IndexPool;
+	ThrowIfNullOrDisposed(pool, "IndexPool");
+
+	PxU32 released = _emitter->releaseAll(_particleBase->UnmanagedPointer, pool->UnmanagedPointer);
+
+	pool->TrackIndices(0, released);
+}
+
+void ParticleEmitter::Reset()
+{
+	_emitter->reset();
+}
+
+//
+
+PhysX::ParticleBase^ ParticleEmitter::ParticleBase::get()
+{
+	return _particleBase;
+}
+
+RigidActor^ ParticleEmitter::FrameActor::get()
+{
+	return _frameActor;
+}
+void ParticleEmitter::FrameActor::set(RigidActor^ value)
+{
+	_frameActor = value;
+}
+
+Matrix4x4 ParticleEmitter::LocalPose::get()
+{
+	return MathUtil::PxTransformToMatrix(&_emitter->localPose);
+}
+void ParticleEmitter::LocalPose::set(Matrix4x4 value)
+{
+	_emitter->localPose = MathUtil::MatrixToPxTransform(value);
+}
+
+ParticleEmitterType ParticleEmitter::Type::get()
+{
+	return (ParticleEmitterType)_emitter->type;
+}
+void ParticleEmitter::Type::set(ParticleEmitterType value)
+{
+	_emitter->type = (PxU32)value;
+}
+
+ParticleEmitterShape ParticleEmitter::Shape::get()
+{
+	return (ParticleEmitterShape)_emitter->shape;
+}
+void ParticleEmitter::Shape::set(ParticleEmitterShape value)
+{
+	_emitter->shape = (PxU32)value;
+}
+
+float ParticleEmitter::DimensionX::get()
+{
+	return _emitter->dimensionX;
+}
+void ParticleEmitter::DimensionX::set(float value)
+{
+	_emitter->dimensionX = value;
+}
+
+float ParticleEmitter::DimensionY::get()
+{
+	return _emitter->dimensionY;
+}
+void ParticleEmitter::DimensionY::set(float value)
+{
+	_emitter->dimensionY = value;
+}
+
+Vector3 ParticleEmitter::RandomPosition::get()
+{
+	return MathUtil::PxVec3ToVector3(_emitter->randomPosition);
+}
+void ParticleEmitter::RandomPosition::set(Vector3 value)
+{
+	_emitter->randomPosition = UV(value);
+}
+
+float ParticleEmitter::RandomAngle::get()
+{
+	return _emitter->randomAngle;
+}
+void ParticleEmitter::RandomAngle::set(float value)
+{
+	_emitter->randomAngle = value;
+}
+
+float ParticleEmitter::VelocityMagnitude::get()
+{
+	return _emitter->velocityMagnitude;
+}
+void ParticleEmitter::VelocityMagnitude::set(float value)
+{
+	_emitter->velocityMagnitude = value;
+}
+
+float ParticleEmitter::Rate::get()
+{
+	return _emitter->rate;
+}
+void ParticleEmitter::Rate::set(float value)
+{
+	_emitter->rate = value;
+}
+
+float ParticleEmitter::ParticleSpacing::get()
+{
+	return _emitter->particleSpacing;
+}
+void ParticleEmitter::ParticleSpacing::set(float value)
+{
+	_emitter->particleSpacing = value;
+}
+
+float ParticleEmitter::ParticleLifetime::get()
+{
+	return _emitter->particleLifetime;
+}
+void ParticleEmitter::ParticleLifetime::set(float value)
+{
+	_emitter->particleLifetime = value;
+}
+
+ParticleEmitterFlag ParticleEmitter::Flags::get()
+{
+	return (ParticleEmitterFlag)_emitter->flags;
+}
+void ParticleEmitter::Flags::set(ParticleEmitterFlag value)
+{
+	_emitter->flags = (PxU32)value;
+}
+
+float ParticleEmitter::EmissionRate::get()
+{
+	return _emitter->emissionRate();
+}
+
+int ParticleEmitter::MaximumParticles::get()
+{
+	return _emitter->maxParticles;
+}
+
+int ParticleEmitter::ParticleCount::get()
+{
+	return _emitter->liveCount;
+}
\ No newline at end of file
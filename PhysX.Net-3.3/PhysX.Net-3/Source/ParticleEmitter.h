@@ -0,0 +1,270 @@
+#pragma once
+
+#include "ParticleEnum.h"
+
+namespace PhysX
+{
+	ref class ParticleBase;
+	ref class RigidActor;
+
+	class InternalParticleEmitter
+	{
+		public:
+			PxTransform localPose;
+			PxU32 type;
+			PxU32 shape;
+			PxU32 flags;
+			PxF32 dimensionX;
+			PxF32 dimensionY;
+			PxVec3 randomPosition;
+			PxF32 randomAngle;
+			PxF32 velocityMagnitude;
+			PxF32 rate;
+			PxF32 particleSpacing;
+			PxF32 particleLifetime;
+
+			// Emitted particles oldest first, as a ring of maxParticles entries. The lifetime can change at any time,
+			// so particles don't necessarily expire in order and the whole ring is scanned once one is due.
+			PxU32* liveIndices;
+			PxF64* expiryTimes;
+			PxU32 maxParticles;
+			PxU32 head;
+			PxU32 liveCount;
+			PxF64 nextExpiry;
+
+			// Kept in double precision, a float clock stops advancing by a frame after a day or so
+			PxF64 time;
+			PxF32 pending;
+			PxU32 seed;
+
+			std::vector<PxU32> newIndices;
+			std::vector<PxVec3> newPositions;
+			std::vector<PxVec3> newVelocities;
+			std::vector<PxU32> expiredIndices;
+
+		public:
+			InternalParticleEmitter(PxU32 maxParticles);
+			~InternalParticleEmitter();
+
+			// Recycles expired particles then emits new ones, returning the number emitted
+			PxU32 update(PxParticleBase* particles, PxParticleExt::IndexPool* pool, const PxRigidActor* frameActor, PxF32 elapsedTime, PxU32& released);
+			// Releases every particle emitted, returning the number released
+			PxU32 releaseAll(PxParticleBase* particles, PxParticleExt::IndexPool* pool);
+			// Forgets every particle emitted, for when they have been released along with the whole particle system
+			void reset();
+
+			PxF32 emissionRate() const;
+
+		private:
+			PxU32 recycle(PxParticleBase* particles, PxParticleExt::IndexPool* pool);
+			PxU32 emit(PxParticleBase* particles, PxParticleExt::IndexPool* pool, const PxRigidActor* frameActor, PxU32 count);
+			PxF32 random();
+	};
+
+	/// <summary>
+	/// Emits particles into a particle system or fluid from a point, rectangle or ellipse, optionally attached to an
+	/// actor, and releases them again once their lifetime has passed. Emission and recycling run natively, with
+	/// particle indices taken from and returned to ParticleBase.IndexPool.
+	/// </summary>
+	/// <remarks>
+	/// Call ParticleBase.UpdateEmitters (or Update) once per step, before Scene.Simulate. The particles of an emitter
+	/// should only be released by the emitter, as it releases each of them again when its lifetime is over.
+	/// Disposing the emitter leaves its particles in place, call ReleaseParticles first to remove them.
+	/// </remarks>
+	public ref class ParticleEmitter : IDisposable
+	{
+	public:
+		/// <summary>Raised before any disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposing;
+		/// <summary>Raised once all disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposed;
+
+	private:
+		InternalParticleEmitter* _emitter;
+		PhysX::ParticleBase^ _particleBase;
+		RigidActor^ _frameActor;
+
+	public:
+		/// <summary>
+		/// Creates an emitter for a particle system or fluid. The emitter is disposed with the particle system.
+		/// </summary>
+		/// <param name="particleBase">The particle system or fluid to emit into.</param>
+		/// <param name="maximumParticles">The maximum number of particles of this emitter alive at once.</param>
+		ParticleEmitter(PhysX::ParticleBase^ particleBase, int maximumParticles);
+		~ParticleEmitter();
+	protected:
+		!ParticleEmitter();
+	public:
+		property bool Disposed
+		{
+			virtual bool get();
+		}
+
+		/// <summary>
+		/// Releases particles whose lifetime is over, then emits the particles due over the elapsed time.
+		/// </summary>
+		/// <param name="elapsedTime">The time since the last update in seconds.</param>
+		/// <returns>The number of particles emitted.</returns>
+		int Update(float elapsedTime);
+
+		/// <summary>
+		/// Releases every particle emitted by this emitter that is still alive.
+		/// </summary>
+		void ReleaseParticles();
+
+		/// <summary>
+		/// Gets the particle system or fluid the emitter emits into.
+		/// </summary>
+		property PhysX::ParticleBase^ ParticleBase
+		{
+			PhysX::ParticleBase^ get();
+		}
+
+		/// <summary>
+		/// Gets or sets the actor the emitter is attached to, or null to place the emitter in world space.
+		/// </summary>
+		property RigidActor^ FrameActor
+		{
+			RigidActor^ get();
+			void set(RigidActor^ value);
+		}
+
+		/// <summary>
+		/// Gets or sets the pose of the emitter relative to FrameActor, or in world space without a frame actor.
+		/// Particles are emitted along the Z axis of the pose.
+		/// </summary>
+		property Matrix4x4 LocalPose
+		{
+			Matrix4x4 get();
+			void set(Matrix4x4 value);
+		}
+
+		/// <summary>
+		/// Gets or sets how the number of particles to emit is decided.
+		/// </summary>
+		property ParticleEmitterType Type
+		{
+			ParticleEmitterType get();
+			void set(ParticleEmitterType value);
+		}
+
+		/// <summary>
+		/// Gets or sets the shape of the emitting surface.
+		/// </summary>
+		property ParticleEmitterShape Shape
+		{
+			ParticleEmitterShape get();
+			void set(ParticleEmitterShape value);
+		}
+
+		/// <summary>
+		/// Gets or sets the half extent (or radius) of the emitting surface along the X axis of the pose.
+		/// </summary>
+		property float DimensionX
+		{
+			float get();
+			void set(float value);
+		}
+
+		/// <summary>
+		/// Gets or sets the half extent (or radius) of the emitting surface along the Y axis of the pose.
+		/// </summary>
+		property float DimensionY
+		{
+			float get();
+			void set(float value);
+		}
+
+		/// <summary>
+		/// Gets or sets the maximum random offset added to the start position of each particle, per axis of the pose.
+		/// </summary>
+		property Vector3 RandomPosition
+		{
+			Vector3 get();
+			void set(Vector3 value);
+		}
+
+		/// <summary>
+		/// Gets or sets the maximum angle in radians between the emission direction of a particle and the Z axis of the pose.
+		/// </summary>
+		property float RandomAngle
+		{
+			float get();
+			void set(float value);
+		}
+
+		/// <summary>
+		/// Gets or sets the speed of emitted particles.
+		/// </summary>
+		property float VelocityMagnitude
+		{
+			float get();
+			void set(float value);
+		}
+
+		/// <summary>
+		/// Gets or sets the number of particles emitted per second by a ParticleEmitterType.ConstantFlowRate emitter.
+		/// </summary>
+		property float Rate
+		{
+			float get();
+			void set(float value);
+		}
+
+		/// <summary>
+		/// Gets or sets the distance between particles a ParticleEmitterType.ConstantPressure emitter keeps.
+		/// Defaults to ParticleFluid.RestParticleDistance for fluids.
+		/// </summary>
+		property float ParticleSpacing
+		{
+			float get();
+			void set(float value);
+		}
+
+		/// <summary>
+		/// Gets or sets the time in seconds a particle lives before it is released, or zero for particles that live until
+		/// ReleaseParticles is called. Changing the lifetime only affects particles emitted afterwards.
+		/// </summary>
+		property float ParticleLifetime
+		{
+			float get();
+			void set(float value);
+		}
+
+		/// <summary>
+		/// Gets or sets the emitter flags.
+		/// </summary>
+		property ParticleEmitterFlag Flags
+		{
+			ParticleEmitterFlag get();
+			void set(ParticleEmitterFlag value);
+		}
+
+		/// <summary>
+		/// Gets the number of particles emitted per second, given the current type, shape and settings.
+		/// </summary>
+		property float EmissionRate
+		{
+			float get();
+		}
+
+		/// <summary>
+		/// Gets the maximum number of particles of this emitter alive at once.
+		/// </summary>
+		property int MaximumParticles
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of particles of this emitter currently alive.
+		/// </summary>
+		property int ParticleCount
+		{
+			int get();
+		}
+
+	internal:
+		void Reset();
+	};
+};
\ No newline at end of file
@@ -122,4 +122,57 @@ namespace PhysX
 		/// </summary>
 		SpatialDataStructureOverflow = PxParticleFlag::eSPATIAL_DATA_STRUCTURE_OVERFLOW,
 	};
+
+	/// <summary>
+	/// How a ParticleEmitter decides how many particles to emit.
+	/// </summary>
+	public enum class ParticleEmitterType
+	{
+		/// <summary>
+		/// Emits enough particles to keep a continuous column of particles, spaced ParticleEmitter.ParticleSpacing apart,
+		/// flowing out of the emitter surface at ParticleEmitter.VelocityMagnitude. The rate follows the emitter area.
+		/// </summary>
+		ConstantPressure = 0,
+
+		/// <summary>
+		/// Emits ParticleEmitter.Rate particles per second regardless of the emitter size.
+		/// </summary>
+		ConstantFlowRate = 1
+	};
+
+	/// <summary>
+	/// The shape of the surface a ParticleEmitter emits particles from. The surface lies in the XY plane of the emitter
+	/// pose and particles are emitted along its Z axis.
+	/// </summary>
+	public enum class ParticleEmitterShape
+	{
+		/// <summary>
+		/// All particles start at the origin of the emitter pose.
+		/// </summary>
+		Point = 0,
+
+		/// <summary>
+		/// A rectangle with half extents ParticleEmitter.DimensionX and ParticleEmitter.DimensionY.
+		/// </summary>
+		Rectangle = 1,
+
+		/// <summary>
+		/// An ellipse with radii ParticleEmitter.DimensionX and ParticleEmitter.DimensionY.
+		/// </summary>
+		Ellipse = 2
+	};
+
+	[Flags]
+	public enum class ParticleEmitterFlag
+	{
+		/// <summary>
+		/// The emitter emits particles when updated. Particles already emitted are still recycled when disabled.
+		/// </summary>
+		Enabled = (1 << 0),
+
+		/// <summary>
+		/// Adds the velocity of the frame actor at the emission point to the velocity of new particles.
+		/// </summary>
+		AddActorVelocity = (1 << 1)
+	};
 };
\ No newline at end of file
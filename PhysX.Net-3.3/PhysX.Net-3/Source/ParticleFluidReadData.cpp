@@ -8,19 +8,102 @@ ParticleFluidReadData::ParticleFluidReadData(PxParticleFluidReadData* particleBa
 
 array<float>^ ParticleFluidReadData::GetDensityBuffer()
 {
+	auto buffer = this->UnmanagedPointer->densityBuffer;
+
+	if (buffer.ptr() == NULL)
+		return nullptr;
+
 	const int n = this->NumberOfValidParticles;
 
 	if (n <= 0)
 		return nullptr;
 
 	array<float>^ ret = gcnew array<float>(n);
+	pin_ptr<float> d = &ret[0];
 
-	for (int i = 0; i < n; i++)
-		ret[i] = this->UnmanagedPointer->densityBuffer[i];
+	Gather(buffer.ptr(), buffer.stride(), sizeof(PxF32), d);
 
 	return ret;
 }
 
+int ParticleFluidReadData::ReadFluidParticles(BoundedData positions, BoundedData velocities, BoundedData densities, [Optional] BoundedData indices)
+{
+	int capacity = this->NumberOfValidParticles;
+	capacity = Capacity(capacity, positions);
+	capacity = Capacity(capacity, velocities);
+	capacity = Capacity(capacity, densities);
+	capacity = Capacity(capacity, indices);
+
+	GCHandle positionPin, velocityPin, densityPin, indexPin;
+
+	try
+	{
+		PxBoundedData p = positions.ToUnmanaged(positionPin, sizeof(PxVec3));
+		PxBoundedData v = velocities.ToUnmanaged(velocityPin, sizeof(PxVec3));
+		PxBoundedData d = densities.ToUnmanaged(densityPin, sizeof(PxF32));
+		PxBoundedData i = indices.ToUnmanaged(indexPin, sizeof(PxU32));
+
+		ParticleReadTargets targets;
+		targets.positions = (PxU8*)p.data;
+		targets.positionStride = p.stride;
+		targets.velocities = (PxU8*)v.data;
+		targets.velocityStride = v.stride;
+		targets.densities = (PxU8*)d.data;
+		targets.densityStride = d.stride;
+		targets.indices = (PxU8*)i.data;
+		targets.indexStride = i.stride;
+
+		return Read(targets, this->UnmanagedPointer->densityBuffer, capacity);
+	}
+	finally
+	{
+		if (positionPin.IsAllocated)
+			positionPin.Free();
+		if (velocityPin.IsAllocated)
+			velocityPin.Free();
+		if (densityPin.IsAllocated)
+			densityPin.Free();
+		if (indexPin.IsAllocated)
+			indexPin.Free();
+	}
+}
+int ParticleFluidReadData::ReadFluidParticles(array<Vector3>^ positions, array<Vector3>^ velocities, array<float>^ densities, [Optional] array<int>^ indices, [Optional] int offset)
+{
+	int capacity = this->NumberOfValidParticles;
+	capacity = Capacity(capacity, positions, offset, "positions");
+	capacity = Capacity(capacity, velocities, offset, "velocities");
+	capacity = Capacity(capacity, densities, offset, "densities");
+	capacity = Capacity(capacity, indices, offset, "indices");
+
+	if (capacity <= 0)
+		return 0;
+
+	pin_ptr<Vector3> p = nullptr;
+	if (positions != nullptr)
+		p = &positions[offset];
+	pin_ptr<Vector3> v = nullptr;
+	if (velocities != nullptr)
+		v = &velocities[offset];
+	pin_ptr<float> d = nullptr;
+	if (densities != nullptr)
+		d = &densities[offset];
+	pin_ptr<int> i = nullptr;
+	if (indices != nullptr)
+		i = &indices[offset];
+
+	ParticleReadTargets targets;
+	targets.positions = (PxU8*)p;
+	targets.positionStride = sizeof(PxVec3);
+	targets.velocities = (PxU8*)v;
+	targets.velocityStride = sizeof(PxVec3);
+	targets.densities = (PxU8*)d;
+	targets.densityStride = sizeof(PxF32);
+	targets.indices = (PxU8*)i;
+	targets.indexStride = sizeof(PxU32);
+
+	return Read(targets, this->UnmanagedPointer->densityBuffer, capacity);
+}
+
 PxParticleFluidReadData* ParticleFluidReadData::UnmanagedPointer::get()
 {
 	return (PxParticleFluidReadData*)ParticleReadData::UnmanagedPointer;	
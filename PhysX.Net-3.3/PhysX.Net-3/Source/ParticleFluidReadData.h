@@ -10,8 +10,33 @@ namespace PhysX
 			ParticleFluidReadData(PxParticleFluidReadData* particleBase);
 
 		public:
+			/// <summary>
+			/// Gets the densities of the valid particles, packed in index order.
+			/// </summary>
 			array<float>^ GetDensityBuffer();
 
+			/// <summary>
+			/// Copies the valid fluid particles into caller owned buffers in a single walk over the valid particle bitmap,
+			/// as ParticleReadData.ReadParticles does, additionally writing each particle's density.
+			/// </summary>
+			/// <param name="positions">Receives the particle positions as Vector3.</param>
+			/// <param name="velocities">Receives the particle velocities as Vector3.</param>
+			/// <param name="densities">Receives the particle densities as float.</param>
+			/// <param name="indices">Receives the index of each particle within the particle system as int.</param>
+			/// <returns>The number of particles written, which is NumberOfValidParticles unless a destination is smaller.</returns>
+			int ReadFluidParticles(BoundedData positions, BoundedData velocities, BoundedData densities, [Optional] BoundedData indices);
+			/// <summary>
+			/// Copies the valid fluid particles into caller owned arrays in a single walk over the valid particle bitmap,
+			/// as ParticleReadData.ReadParticles does, additionally writing each particle's density.
+			/// </summary>
+			/// <param name="positions">Receives the particle positions.</param>
+			/// <param name="velocities">Receives the particle velocities.</param>
+			/// <param name="densities">Receives the particle densities.</param>
+			/// <param name="indices">Receives the index of each particle within the particle system.</param>
+			/// <param name="offset">The element of each array to start writing at.</param>
+			/// <returns>The number of particles written, which is NumberOfValidParticles unless an array is smaller.</returns>
+			int ReadFluidParticles(array<Vector3>^ positions, array<Vector3>^ velocities, array<float>^ densities, [Optional] array<int>^ indices, [Optional] int offset);
+
 		internal:
 			property PxParticleFluidReadData* UnmanagedPointer
 			{
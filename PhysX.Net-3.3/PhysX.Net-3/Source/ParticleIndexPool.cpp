@@ -0,0 +1,136 @@
+#include "StdAfx.h"
+#include "ParticleIndexPool.h"
+#include "ParticleBase.h"
+#include "FailedToCreateObjectException.h"
+
+ParticleIndexPool::ParticleIndexPool(PhysX::ParticleBase^ particleBase)
+{
+	ThrowIfNullOrDisposed(particleBase, "particleBase");
+
+	_maximumParticles = particleBase->MaximumParticles;
+
+	_pool = PxParticleExt::createIndexPool(_maximumParticles);
+
+	if (_pool == NULL)
+		throw gcnew FailedToCreateObjectException("Failed to create particle index pool");
+
+	_particleBase = particleBase;
+	_allocatedCount = 0;
+
+	ObjectTable::AddObjectOwner(this, particleBase);
+}
+ParticleIndexPool::~ParticleIndexPool()
+{
+	this->!ParticleIndexPool();
+}
+ParticleIndexPool::!ParticleIndexPool()
+{
+	OnDisposing(this, nullptr);
+
+	if (this->Disposed)
+		return;
+
+	_pool->release();
+	_pool = NULL;
+
+	_particleBase = nullptr;
+
+	OnDisposed(this, nullptr);
+}
+bool ParticleIndexPool::Disposed::get()
+{
+	return (_pool == NULL);
+}
+
+int ParticleIndexPool::AllocateIndices(BoundedData indices)
+{
+	ThrowIfThisDisposed();
+
+	GCHandle pin;
+
+	try
+	{
+		PxBoundedData i = indices.ToUnmanaged(pin, sizeof(PxU32));
+
+		if (i.count == 0)
+			return 0;
+
+		return Allocate(i.count, (PxU32*)i.data, i.stride);
+	}
+	finally
+	{
+		if (pin.IsAllocated)
+			pin.Free();
+	}
+}
+
+void ParticleIndexPool::FreeIndices(BoundedData indices)
+{
+	ThrowIfThisDisposed();
+
+	GCHandle pin;
+
+	try
+	{
+		PxBoundedData i = indices.ToUnmanaged(pin, sizeof(PxU32));
+
+		if (i.count > 0)
+			Free(i.count, (const PxU32*)i.data, i.stride);
+	}
+	finally
+	{
+		if (pin.IsAllocated)
+			pin.Free();
+	}
+}
+void ParticleIndexPool::FreeIndices()
+{
+	ThrowIfThisDisposed();
+
+	FreeAll();
+}
+
+PxU32 ParticleIndexPool::Allocate(PxU32 count, PxU32* indices, PxU32 stride)
+{
+	PxU32 n = _pool->allocateIndices(count, PxStrideIterator<PxU32>(indices, stride));
+
+	TrackIndices(n, 0);
+
+	return n;
+}
+void ParticleIndexPool::Free(PxU32 count, const PxU32* indices, PxU32 stride)
+{
+	_pool->freeIndices(count, PxStrideIterator<const PxU32>(indices, stride));
+
+	TrackIndices(0, count);
+}
+void ParticleIndexPool::FreeAll()
+{
+	_pool->freeIndices();
+
+	_allocatedCount = 0;
+}
+void ParticleIndexPool::TrackIndices(int allocated, int freed)
+{
+	_allocatedCount = Math::Max(0, _allocatedCount + allocated - freed);
+}
+
+PhysX::ParticleBase^ ParticleIndexPool::ParticleBase::get()
+{
+	return _particleBase;
+}
+
+int ParticleIndexPool::AllocatedCount::get()
+{
+	return _allocatedCount;
+}
+
+int ParticleIndexPool::FreeCount::get()
+{
+	return _maximumParticles - _allocatedCount;
+}
+
+PxParticleExt::IndexPool* ParticleIndexPool::UnmanagedPointer::get()
+{
+	return _pool;
+}
\ No newline at end of file
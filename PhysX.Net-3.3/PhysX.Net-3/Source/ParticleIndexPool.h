@@ -0,0 +1,97 @@
+#pragma once
+
+#include "BoundedData.h"
+
+namespace PhysX
+{
+	ref class ParticleBase;
+
+	/// <summary>
+	/// Hands out free particle indices of a particle system or fluid, so particles can be created and released
+	/// without the application tracking which indices are in use.
+	/// </summary>
+	/// <remarks>
+	/// Once a pool is in use every particle of its particle system should get its index from the pool (as
+	/// ParticleBase.CreateParticles(BoundedData, ...) does), otherwise the pool may hand out an index that is already
+	/// taken. ParticleBase.ReleaseParticles returns the indices of released particles to the pool.
+	/// </remarks>
+	public ref class ParticleIndexPool : IDisposable
+	{
+	public:
+		/// <summary>Raised before any disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposing;
+		/// <summary>Raised once all disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposed;
+
+	private:
+		PxParticleExt::IndexPool* _pool;
+		PhysX::ParticleBase^ _particleBase;
+		int _maximumParticles;
+		int _allocatedCount;
+
+	internal:
+		ParticleIndexPool(PhysX::ParticleBase^ particleBase);
+	public:
+		~ParticleIndexPool();
+	protected:
+		!ParticleIndexPool();
+	public:
+		property bool Disposed
+		{
+			virtual bool get();
+		}
+
+		/// <summary>
+		/// Reserves free indices, writing them to indices. Fewer than indices.Count are reserved when the pool runs out.
+		/// </summary>
+		/// <param name="indices">Receives the reserved indices as int.</param>
+		/// <returns>The number of indices reserved.</returns>
+		int AllocateIndices(BoundedData indices);
+
+		/// <summary>
+		/// Returns indices to the pool. This does not release the particles, see ParticleBase.ReleaseParticles.
+		/// </summary>
+		/// <param name="indices">The indices to return as int. Each must have been reserved from this pool.</param>
+		void FreeIndices(BoundedData indices);
+		/// <summary>
+		/// Returns all indices to the pool. This does not release the particles, see ParticleBase.ReleaseParticles.
+		/// </summary>
+		void FreeIndices();
+
+		/// <summary>
+		/// Gets the particle system or fluid the indices belong to.
+		/// </summary>
+		property PhysX::ParticleBase^ ParticleBase
+		{
+			PhysX::ParticleBase^ get();
+		}
+
+		/// <summary>
+		/// Gets the number of indices currently reserved.
+		/// </summary>
+		property int AllocatedCount
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of indices that can still be reserved.
+		/// </summary>
+		property int FreeCount
+		{
+			int get();
+		}
+
+	internal:
+		PxU32 Allocate(PxU32 count, PxU32* indices, PxU32 stride);
+		void Free(PxU32 count, const PxU32* indices, PxU32 stride);
+		void FreeAll();
+		// Accounts for indices reserved and returned natively through UnmanagedPointer
+		void TrackIndices(int allocated, int freed);
+
+		property PxParticleExt::IndexPool* UnmanagedPointer
+		{
+			PxParticleExt::IndexPool* get();
+		}
+	};
+};
\ No newline at end of file
@@ -1,6 +1,74 @@
 #include "StdAfx.h"
 #include "ParticleReadData.h"
 
+#include <intrin.h>
+
+#pragma managed(push, off)
+// Visits the set bits of the valid particle bitmap one 32 particle word at a time, so runs of released particles cost
+// a single compare and each valid particle is found with one bit scan
+static PxU32 ReadValidParticles(const PxParticleReadData& data, PxStrideIterator<const PxF32> densityBuffer, const ParticleReadTargets& targets, PxU32 capacity)
+{
+	const PxU32 words = (data.validParticleRange + 31) >> 5;
+
+	PxStrideIterator<const PxVec3> positionBuffer = data.positionBuffer;
+	PxStrideIterator<const PxVec3> velocityBuffer = data.velocityBuffer;
+
+	PxU32 n = 0;
+
+	for (PxU32 w = 0; w < words && n < capacity; w++)
+	{
+		PxU32 bits = data.validParticleBitmap[w];
+
+		while (bits != 0 && n < capacity)
+		{
+			unsigned long bit;
+			_BitScanForward(&bit, bits);
+			bits &= bits - 1;
+
+			const PxU32 index = (w << 5) | bit;
+
+			if (targets.positions != NULL)
+				*reinterpret_cast<PxVec3*>(targets.positions + n * targets.positionStride) = positionBuffer[index];
+			if (targets.velocities != NULL)
+				*reinterpret_cast<PxVec3*>(targets.velocities + n * targets.velocityStride) = velocityBuffer[index];
+			if (targets.densities != NULL)
+				*reinterpret_cast<PxF32*>(targets.densities + n * targets.densityStride) = densityBuffer[index];
+			if (targets.indices != NULL)
+				*reinterpret_cast<PxU32*>(targets.indices + n * targets.indexStride) = index;
+
+			n++;
+		}
+	}
+
+	return n;
+}
+
+static PxU32 GatherValidParticles(const PxU32* bitmap, PxU32 range, const PxU8* source, PxU32 sourceStride, PxU32 size, PxU8* destination)
+{
+	const PxU32 words = (range + 31) >> 5;
+
+	PxU32 n = 0;
+
+	for (PxU32 w = 0; w < words; w++)
+	{
+		PxU32 bits = bitmap[w];
+
+		while (bits != 0)
+		{
+			unsigned long bit;
+			_BitScanForward(&bit, bits);
+			bits &= bits - 1;
+
+			memcpy(destination + n * size, source + ((w << 5) | bit) * sourceStride, size);
+
+			n++;
+		}
+	}
+
+	return n;
+}
+#pragma managed(pop)
+
 ParticleReadData::ParticleReadData(PxParticleReadData* data)
 	: LockedData(data)
 {
@@ -16,7 +84,10 @@ array<int>^ ParticleReadData::GetValidParticleBitmap()
 	if (this->UnmanagedPointer->validParticleRange == 0)
 		return nullptr;
 
-	return Util::AsManagedArray<int>(this->UnmanagedPointer->validParticleBitmap, this->UnmanagedPointer->validParticleRange - 1);
+	// One bit per particle index below the valid range
+	const int words = (this->UnmanagedPointer->validParticleRange + 31) >> 5;
+
+	return Util::AsManagedArray<int>(this->UnmanagedPointer->validParticleBitmap, words);
 }
 
 array<Vector3>^ ParticleReadData::GetPositions()
@@ -32,13 +103,9 @@ array<Vector3>^ ParticleReadData::GetPositions()
 		return nullptr;
 
 	auto positions = gcnew array<Vector3>(n);
-	
-	for (int i = 0; i < n; i++)
-	{
-		PxVec3 p = buffer[i];
+	pin_ptr<Vector3> p = &positions[0];
 
-		positions[i] = Vector3(p.x, p.y, p.z);
-	}
+	Gather(buffer.ptr(), buffer.stride(), sizeof(PxVec3), p);
 
 	return positions;
 }
@@ -56,13 +123,9 @@ array<Vector3>^ ParticleReadData::GetVelocities()
 		return nullptr;
 
 	auto velocities = gcnew array<Vector3>(n);
+	pin_ptr<Vector3> v = &velocities[0];
 
-	for (int i = 0; i < n; i++)
-	{
-		PxVec3 v = buffer[i];
-
-		velocities[i] = Vector3(v.x, v.y, v.z);
-	}
+	Gather(buffer.ptr(), buffer.stride(), sizeof(PxVec3), v);
 
 	return velocities;
 }
@@ -80,11 +143,9 @@ array<float>^ ParticleReadData::GetRestOffsets()
 		return nullptr;
 
 	auto restOffsets = gcnew array<float>(n);
+	pin_ptr<float> r = &restOffsets[0];
 
-	for (int i = 0; i < n; i++)
-	{
-		restOffsets[i] = buffer[i];
-	}
+	Gather(buffer.ptr(), buffer.stride(), sizeof(PxF32), r);
 
 	return restOffsets;
 }
@@ -101,14 +162,16 @@ array<ParticleFlag>^ ParticleReadData::GetFlags()
 	if (n <= 0)
 		return nullptr;
 
+	// The SDK stores 16 bit flags, pack them first then widen in place from the back
 	auto flags = gcnew array<ParticleFlag>(n);
+	pin_ptr<ParticleFlag> f = &flags[0];
 
-	for (int i = 0; i < n; i++)
-	{
-		PxU16 flag = buffer[i];
+	PxU16* packed = (PxU16*)f;
 
-		flags [i] = (ParticleFlag)flag;
-	}
+	Gather(buffer.ptr(), buffer.stride(), sizeof(PxU16), packed);
+
+	for (int i = n - 1; i >= 0; i--)
+		flags[i] = (ParticleFlag)packed[i];
 
 	return flags;
 }
@@ -126,13 +189,9 @@ array<Vector3>^ ParticleReadData::GetCollisionNormals()
 		return nullptr;
 
 	auto collisionNormals = gcnew array<Vector3>(n);
+	pin_ptr<Vector3> c = &collisionNormals[0];
 
-	for (int i = 0; i < n; i++)
-	{
-		PxVec3 n = buffer[i];
-
-		collisionNormals[i] = Vector3(n.x, n.y, n.z);
-	}
+	Gather(buffer.ptr(), buffer.stride(), sizeof(PxVec3), c);
 
 	return collisionNormals;
 }
@@ -150,15 +209,122 @@ array<Vector3>^ ParticleReadData::GetCollisionVelocities()
 		return nullptr;
 
 	auto collisionVelocities = gcnew array<Vector3>(n);
+	pin_ptr<Vector3> c = &collisionVelocities[0];
 
-	for (int i = 0; i < n; i++)
-	{
-		PxVec3 n = buffer[i];
+	Gather(buffer.ptr(), buffer.stride(), sizeof(PxVec3), c);
+
+	return collisionVelocities;
+}
+
+int ParticleReadData::ReadParticles(BoundedData positions, [Optional] BoundedData velocities, [Optional] BoundedData indices)
+{
+	int capacity = this->NumberOfValidParticles;
+	capacity = Capacity(capacity, positions);
+	capacity = Capacity(capacity, velocities);
+	capacity = Capacity(capacity, indices);
+
+	GCHandle positionPin, velocityPin, indexPin;
 
-		collisionVelocities[i] = Vector3(n.x, n.y, n.z);
+	try
+	{
+		PxBoundedData p = positions.ToUnmanaged(positionPin, sizeof(PxVec3));
+		PxBoundedData v = velocities.ToUnmanaged(velocityPin, sizeof(PxVec3));
+		PxBoundedData i = indices.ToUnmanaged(indexPin, sizeof(PxU32));
+
+		ParticleReadTargets targets;
+		targets.positions = (PxU8*)p.data;
+		targets.positionStride = p.stride;
+		targets.velocities = (PxU8*)v.data;
+		targets.velocityStride = v.stride;
+		targets.densities = NULL;
+		targets.densityStride = 0;
+		targets.indices = (PxU8*)i.data;
+		targets.indexStride = i.stride;
+
+		return Read(targets, PxStrideIterator<const PxF32>(), capacity);
+	}
+	finally
+	{
+		if (positionPin.IsAllocated)
+			positionPin.Free();
+		if (velocityPin.IsAllocated)
+			velocityPin.Free();
+		if (indexPin.IsAllocated)
+			indexPin.Free();
 	}
+}
+int ParticleReadData::ReadParticles(array<Vector3>^ positions, [Optional] array<Vector3>^ velocities, [Optional] array<int>^ indices, [Optional] int offset)
+{
+	int capacity = this->NumberOfValidParticles;
+	capacity = Capacity(capacity, positions, offset, "positions");
+	capacity = Capacity(capacity, velocities, offset, "velocities");
+	capacity = Capacity(capacity, indices, offset, "indices");
+
+	if (capacity <= 0)
+		return 0;
+
+	pin_ptr<Vector3> p = nullptr;
+	if (positions != nullptr)
+		p = &positions[offset];
+	pin_ptr<Vector3> v = nullptr;
+	if (velocities != nullptr)
+		v = &velocities[offset];
+	pin_ptr<int> i = nullptr;
+	if (indices != nullptr)
+		i = &indices[offset];
+
+	ParticleReadTargets targets;
+	targets.positions = (PxU8*)p;
+	targets.positionStride = sizeof(PxVec3);
+	targets.velocities = (PxU8*)v;
+	targets.velocityStride = sizeof(PxVec3);
+	targets.densities = NULL;
+	targets.densityStride = 0;
+	targets.indices = (PxU8*)i;
+	targets.indexStride = sizeof(PxU32);
+
+	return Read(targets, PxStrideIterator<const PxF32>(), capacity);
+}
 
-	return collisionVelocities;
+int ParticleReadData::Read(const ParticleReadTargets& targets, PxStrideIterator<const PxF32> densityBuffer, int capacity)
+{
+	PxParticleReadData* data = this->UnmanagedPointer;
+
+	if (targets.positions != NULL && data->positionBuffer.ptr() == NULL)
+		throw gcnew InvalidOperationException("The particle positions are not available, enable ParticleReadDataFlag.PositionBuffer");
+	if (targets.velocities != NULL && data->velocityBuffer.ptr() == NULL)
+		throw gcnew InvalidOperationException("The particle velocities are not available, enable ParticleReadDataFlag.VelocityBuffer");
+	if (targets.densities != NULL && densityBuffer.ptr() == NULL)
+		throw gcnew InvalidOperationException("The particle densities are not available, enable ParticleReadDataFlag.DensityBuffer");
+
+	if (capacity <= 0 || data->validParticleBitmap == NULL)
+		return 0;
+
+	return ReadValidParticles(*data, densityBuffer, targets, capacity);
+}
+int ParticleReadData::Gather(const void* source, PxU32 sourceStride, PxU32 size, void* destination)
+{
+	PxParticleReadData* data = this->UnmanagedPointer;
+
+	if (data->validParticleBitmap == NULL)
+		return 0;
+
+	return GatherValidParticles(data->validParticleBitmap, data->validParticleRange, (const PxU8*)source, sourceStride, size, (PxU8*)destination);
+}
+
+int ParticleReadData::Capacity(int capacity, Array^ buffer, int offset, String^ paramName)
+{
+	if (buffer == nullptr)
+		return capacity;
+
+	if (offset < 0 || offset > buffer->Length)
+		throw gcnew ArgumentOutOfRangeException("offset", String::Format("The offset must lie within {0}", paramName));
+
+	return Math::Min(capacity, buffer->Length - offset);
+}
+int ParticleReadData::Capacity(int capacity, BoundedData data)
+{
+	return data.Count > 0 ? Math::Min(capacity, data.Count) : capacity;
 }
 
 PhysX::DataAccessFlag ParticleReadData::DataAccessFlag::get()
@@ -2,9 +2,23 @@
 
 #include "LockedData.h"
 #include "ParticleEnum.h"
+#include "BoundedData.h"
 
 namespace PhysX
 {
+	// Destinations of one walk over the valid particle bitmap, a NULL pointer skips that attribute
+	struct ParticleReadTargets
+	{
+		PxU8* positions;
+		PxU32 positionStride;
+		PxU8* velocities;
+		PxU32 velocityStride;
+		PxU8* densities;
+		PxU32 densityStride;
+		PxU8* indices;
+		PxU32 indexStride;
+	};
+
 	public ref class ParticleReadData : LockedData
 	{
 		public:
@@ -13,13 +27,53 @@ namespace PhysX
 			virtual void Unlock() override;
 
 			array<int>^ GetValidParticleBitmap();
+			/// <summary>
+			/// Gets the positions of the valid particles, packed in index order.
+			/// </summary>
 			array<Vector3>^ GetPositions();
+			/// <summary>
+			/// Gets the velocities of the valid particles, packed in index order.
+			/// </summary>
 			array<Vector3>^ GetVelocities();
+			/// <summary>
+			/// Gets the rest offsets of the valid particles, packed in index order.
+			/// </summary>
 			array<float>^ GetRestOffsets();
+			/// <summary>
+			/// Gets the flags of the valid particles, packed in index order.
+			/// </summary>
 			array<ParticleFlag>^ GetFlags();
+			/// <summary>
+			/// Gets the collision normals of the valid particles, packed in index order.
+			/// </summary>
 			array<Vector3>^ GetCollisionNormals();
+			/// <summary>
+			/// Gets the collision velocities of the valid particles, packed in index order.
+			/// </summary>
 			array<Vector3>^ GetCollisionVelocities();
 
+			/// <summary>
+			/// Copies the valid particles into caller owned buffers in a single walk over the valid particle bitmap,
+			/// packing them in index order without allocating. Each destination may be left empty (a Count of zero)
+			/// to skip that attribute, or may share a buffer with the others and use a larger Stride to write
+			/// interleaved vertices.
+			/// </summary>
+			/// <param name="positions">Receives the particle positions as Vector3.</param>
+			/// <param name="velocities">Receives the particle velocities as Vector3.</param>
+			/// <param name="indices">Receives the index of each particle within the particle system as int.</param>
+			/// <returns>The number of particles written, which is NumberOfValidParticles unless a destination is smaller.</returns>
+			int ReadParticles(BoundedData positions, [Optional] BoundedData velocities, [Optional] BoundedData indices);
+			/// <summary>
+			/// Copies the valid particles into caller owned arrays in a single walk over the valid particle bitmap,
+			/// packing them in index order without allocating. Any array may be null to skip that attribute.
+			/// </summary>
+			/// <param name="positions">Receives the particle positions.</param>
+			/// <param name="velocities">Receives the particle velocities.</param>
+			/// <param name="indices">Receives the index of each particle within the particle system.</param>
+			/// <param name="offset">The element of each array to start writing at.</param>
+			/// <returns>The number of particles written, which is NumberOfValidParticles unless an array is smaller.</returns>
+			int ReadParticles(array<Vector3>^ positions, [Optional] array<Vector3>^ velocities, [Optional] array<int>^ indices, [Optional] int offset);
+
 			property PhysX::DataAccessFlag DataAccessFlag
 			{
 				virtual PhysX::DataAccessFlag get() override;
@@ -36,6 +90,14 @@ namespace PhysX
 			}
 
 		internal:
+			// Writes the valid particles into targets, the density source is only read when targets.densities is set
+			int Read(const ParticleReadTargets& targets, PxStrideIterator<const PxF32> densityBuffer, int capacity);
+			// Packs one attribute of the valid particles into destination, returning the number written
+			int Gather(const void* source, PxU32 sourceStride, PxU32 size, void* destination);
+
+			static int Capacity(int capacity, Array^ buffer, int offset, String^ paramName);
+			static int Capacity(int capacity, BoundedData data);
+
 			property PxParticleReadData* UnmanagedPointer
 			{
 				virtual PxParticleReadData* get() new;
@@ -39,6 +39,7 @@
 #include "PrismaticJoint.h"
 #include "RevoluteJoint.h"
 #include "SphericalJoint.h"
+#include "MemoryMappedInputData.h"
 
 //#include <PvdConnection.h>
 //#include <extensions\PxCollectionExt.h>
@@ -67,6 +68,9 @@ Physics::Physics(PhysX::Foundation^ foundation, [Optional] bool checkRuntimeFile
 	if (_physics == NULL)
 		throw gcnew Exception("Failed to create physics instance");
 
+	// Allocated only once the native physics exists, so a failed construction leaves nothing for the finalizer to miss
+	_mappedFiles = new std::vector<MemoryMappedInputData*>();
+
 	PostInit(foundation);
 }
 Physics::~Physics()
@@ -85,6 +89,11 @@ Physics::!Physics()
 	_physics->release();
 	_physics = NULL;
 
+	// Only now that every object has been released can the memory they were deserialized into be unmapped
+	for (size_t i = 0; i < _mappedFiles->size(); i++)
+		delete (*_mappedFiles)[i];
+	SAFE_DELETE(_mappedFiles);
+
 	_instantiated = false;
 	
 	OnDisposed(this, nullptr);
@@ -196,7 +205,23 @@ HeightField^ Physics::CreateHeightField(HeightFieldDesc^ desc)
 {
 	ThrowIfDescriptionIsNullOrInvalid(desc, "desc");
 
-	auto hf = _physics->createHeightField(HeightFieldDesc::ToUnmanaged(desc));
+	GCHandle pin;
+	try
+	{
+		PxHeightFieldDesc d = HeightFieldDesc::ToUnmanaged(desc, pin);
+
+		return CreateHeightField(d);
+	}
+	finally
+	{
+		// PhysX copies the samples
+		if (pin.IsAllocated)
+			pin.Free();
+	}
+}
+HeightField^ Physics::CreateHeightField(const PxHeightFieldDesc& desc)
+{
+	auto hf = _physics->createHeightField(desc);
 
 	if (hf == NULL)
 		throw gcnew FailedToCreateObjectException("Failed to create height field object");
@@ -210,52 +235,62 @@ TriangleMesh^ Physics::CreateTriangleMesh(System::IO::Stream^ stream)
 {
 	ThrowIfNull(stream, "stream");
 
-	try
-	{
-		// TODO: Memory leak
-		PxDefaultMemoryInputData* ms = Util::StreamToUnmanagedInputStream(stream);
+	ArraySegment<Byte> data = Util::ReadStream(stream);
+	if (data.Count == 0)
+		throw gcnew ArgumentException("Stream is of zero length", "stream");
 
-		PxTriangleMesh* triangleMesh = _physics->createTriangleMesh(*ms);
+	pin_ptr<Byte> pin = &data.Array[data.Offset];
 
-		if (triangleMesh == NULL)
-			throw gcnew FailedToCreateObjectException("Failed to create triangle mesh");
-	
-		auto t = gcnew TriangleMesh(triangleMesh, this);
+	PxDefaultMemoryInputData in(pin, data.Count);
 
-		//delete ms;
+	return CreateTriangleMesh(in);
+}
+TriangleMesh^ Physics::CreateTriangleMesh(String^ filename)
+{
+	MemoryMappedInputData in(filename);
 
-		return t;
-	}
-	finally
-	{
-		//delete[] ms.GetMemory();
-	}
+	return CreateTriangleMesh(in);
+}
+TriangleMesh^ Physics::CreateTriangleMesh(PxInputStream& stream)
+{
+	PxTriangleMesh* triangleMesh = _physics->createTriangleMesh(stream);
+
+	if (triangleMesh == NULL)
+		throw gcnew FailedToCreateObjectException("Failed to create triangle mesh");
+
+	return gcnew TriangleMesh(triangleMesh, this);
 }
 #pragma endregion
 
 #pragma region Convex Mesh
 ConvexMesh^ Physics::CreateConvexMesh(System::IO::Stream^ stream)
 {
-	try
-	{
-		// TODO: Memory leak
-		PxDefaultMemoryInputData* ms = Util::StreamToUnmanagedInputStream(stream);
+	ThrowIfNull(stream, "stream");
 
-		PxConvexMesh* convexMesh = _physics->createConvexMesh(*ms);
+	ArraySegment<Byte> data = Util::ReadStream(stream);
+	if (data.Count == 0)
+		throw gcnew ArgumentException("Stream is of zero length", "stream");
 
-		if (convexMesh == NULL)
-			throw gcnew FailedToCreateObjectException("Failed to create convex mesh");
-	
-		auto cm = gcnew ConvexMesh(convexMesh, this);
+	pin_ptr<Byte> pin = &data.Array[data.Offset];
 
-		//delete ms;
+	PxDefaultMemoryInputData in(pin, data.Count);
 
-		return cm;
-	}
-	finally
-	{
-		//delete[] ms.GetMemory();
-	}
+	return CreateConvexMesh(in);
+}
+ConvexMesh^ Physics::CreateConvexMesh(String^ filename)
+{
+	MemoryMappedInputData in(filename);
+
+	return CreateConvexMesh(in);
+}
+ConvexMesh^ Physics::CreateConvexMesh(PxInputStream& stream)
+{
+	PxConvexMesh* convexMesh = _physics->createConvexMesh(stream);
+
+	if (convexMesh == NULL)
+		throw gcnew FailedToCreateObjectException("Failed to create convex mesh");
+
+	return gcnew ConvexMesh(convexMesh, this);
 }
 #pragma endregion
 
@@ -521,31 +556,34 @@ ClothFabric^ Physics::CreateClothFabric(System::IO::Stream^ cookedStream)
 	ThrowIfNull(cookedStream, "cookedStream");
 	if (!cookedStream->CanRead)
 		throw gcnew ArgumentNullException("Cannot read from cooked stream", "cookedStream");
-	if (cookedStream->Length == 0)
-		throw gcnew ArgumentNullException("Cooked stream is of zero length", "cookedStream");
-
-	int n = (int)cookedStream->Length;
 
-	// Read the data from the stream
-	array<Byte>^ cookedData = gcnew array<Byte>(n);
-	cookedStream->Read(cookedData, 0, n);
+	// Read the data from the stream (without a copy if it's a memory stream)
+	ArraySegment<Byte> cookedData = Util::ReadStream(cookedStream);
+	if (cookedData.Count == 0)
+		throw gcnew ArgumentNullException("Cooked stream is of zero length", "cookedStream");
 
 	// Get a pointer to the first byte
-	pin_ptr<Byte> pin = &cookedData[0];
+	pin_ptr<Byte> pin = &cookedData.Array[cookedData.Offset];
 
 	// Create an PxInputStream around the data
-	PxDefaultMemoryInputData in(pin, n);
+	PxDefaultMemoryInputData in(pin, cookedData.Count);
 
-	// Create the cloth fabric
-	PxClothFabric* clothFabric = _physics->createClothFabric(in);
+	return CreateClothFabric(in);
+}
+ClothFabric^ Physics::CreateClothFabric(String^ cookedFilename)
+{
+	MemoryMappedInputData in(cookedFilename);
+
+	return CreateClothFabric(in);
+}
+ClothFabric^ Physics::CreateClothFabric(PxInputStream& stream)
+{
+	PxClothFabric* clothFabric = _physics->createClothFabric(stream);
 
 	if (clothFabric == NULL)
 		throw gcnew FailedToCreateObjectException("Failed to create PxClothFabric instance. See your error output instance for any details");
 
-	// Create a managed version of the cloth fabric
-	ClothFabric^ cf = gcnew ClothFabric(clothFabric, this);
-
-	return cf;
+	return gcnew ClothFabric(clothFabric, this);
 }
 ClothFabric^ Physics::CreateClothFabric(ClothFabricDesc^ desc)
 {
@@ -588,6 +626,14 @@ Aggregate^ Physics::CreateAggregate(int maximumSize, bool enableSelfCollision)
 	return gcnew Aggregate(a, this);
 }
 
+void Physics::AddMappedFile(MemoryMappedInputData* mappedFile)
+{
+	if (mappedFile == NULL)
+		throw gcnew ArgumentNullException("mappedFile");
+
+	_mappedFiles->push_back(mappedFile);
+}
+
 PxPhysics* Physics::UnmanagedPointer::get()
 {
 	return _physics;
@@ -6,6 +6,7 @@
 
 namespace PhysX
 {
+	class MemoryMappedInputData;
 	ref class Scene;
 	ref class SceneDesc;
 	ref class Material;
@@ -69,6 +70,9 @@ namespace PhysX
 
 		PhysX::VisualDebugger::ConnectionManager^ _connectionManager;
 
+		// Files mapped for in-place binary deserialization, these must outlive the PxPhysics instance
+		std::vector<MemoryMappedInputData*>* _mappedFiles;
+
 	public:
 		static Physics();
 
@@ -151,6 +155,13 @@ namespace PhysX
 		/// <param name="stream">The triangle mesh stream.</param>
 		/// <returns>The new triangle mesh.</returns>
 		TriangleMesh^ CreateTriangleMesh(System::IO::Stream^ stream);
+		/// <summary>
+		/// Creates a triangle mesh object from a cooked mesh file.
+		/// The file is memory mapped and read in place, it is never copied into an intermediate buffer.
+		/// </summary>
+		/// <param name="filename">The path of the cooked triangle mesh file.</param>
+		/// <returns>The new triangle mesh.</returns>
+		TriangleMesh^ CreateTriangleMesh(String^ filename);
 		#pragma endregion
 
 		#pragma region Convex Mesh
@@ -161,6 +172,13 @@ namespace PhysX
 		/// <param name="stream">The stream to load the convex mesh from.</param>
 		/// <returns>The new convex mesh.</returns>
 		ConvexMesh^ CreateConvexMesh(System::IO::Stream^ stream);
+		/// <summary>
+		/// Creates a convex mesh object from a cooked mesh file.
+		/// The file is memory mapped and read in place, it is never copied into an intermediate buffer.
+		/// </summary>
+		/// <param name="filename">The path of the cooked convex mesh file.</param>
+		/// <returns>The new convex mesh.</returns>
+		ConvexMesh^ CreateConvexMesh(String^ filename);
 		#pragma endregion
 
 		#pragma region HeightField
@@ -338,6 +356,12 @@ namespace PhysX
 		/// <param name="cookedStream">The stream to load the cloth fabric from.</param>
 		ClothFabric^ CreateClothFabric(System::IO::Stream^ cookedStream);
 		/// <summary>
+		/// Creates a cloth fabric object from a cooked fabric file.
+		/// The file is memory mapped and read in place, it is never copied into an intermediate buffer.
+		/// </summary>
+		/// <param name="cookedFilename">The path of the cooked cloth fabric file.</param>
+		ClothFabric^ CreateClothFabric(String^ cookedFilename);
+		/// <summary>
 		/// Creates a cloth fabric object from particle connectivity and restlength information.
 		/// This can then be instanced into PxCloth objects.
 		/// Note: We recommended using PxCooking.cookClothFabric() to create cloth fabrics from meshes and then
@@ -365,6 +389,18 @@ namespace PhysX
 		#pragma endregion
 
 	internal:
+		// Create objects from cooked data in any PhysX input stream (mapped files, memory, ...)
+		TriangleMesh^ CreateTriangleMesh(PxInputStream& stream);
+		ConvexMesh^ CreateConvexMesh(PxInputStream& stream);
+		ClothFabric^ CreateClothFabric(PxInputStream& stream);
+		HeightField^ CreateHeightField(const PxHeightFieldDesc& desc);
+
+		/// <summary>
+		/// Takes ownership of a mapped file whose memory is referenced by deserialized objects.
+		/// The view is unmapped once the PxPhysics instance (and so all its objects) has been released.
+		/// </summary>
+		void AddMappedFile(MemoryMappedInputData* mappedFile);
+
 		property PxPhysics* UnmanagedPointer
 		{
 			PxPhysics* get();
@@ -26,6 +26,8 @@
 #include "QueryCache.h"
 #include "OverlapHit.h"
 #include "InternalOverlapCallback.h"
+#include "InternalCullingCallback.h"
+#include "InternalProximityCallback.h"
 #include "Collection.h"
 #include "SceneLimits.h"
 #include "ContactModifyCallback.h"
@@ -327,6 +329,171 @@ bool Scene::Overlap(Geometry^ geometry, Matrix pose, int maximumOverlaps, Func<a
 	}
 }
 
+// Planes of the frustum of a view * projection matrix, facing out of the frustum
+static void GetFrustumPlanes(Matrix m, PxPlane* planes)
+{
+	// Row vectors, so each clip space coordinate is a column of the matrix
+	PxVec4 x(m.M11, m.M21, m.M31, m.M41);
+	PxVec4 y(m.M12, m.M22, m.M32, m.M42);
+	PxVec4 z(m.M13, m.M23, m.M33, m.M43);
+	PxVec4 w(m.M14, m.M24, m.M34, m.M44);
+
+	PxVec4 inside[6] = { w + x, w - x, w + y, w - y, z, w - z };
+
+	for (int i = 0; i < 6; i++)
+	{
+		PxPlane plane(-inside[i].getXYZ(), -inside[i].w);
+		plane.normalize();
+
+		planes[i] = plane;
+	}
+}
+
+int Scene::CullActors(array<Plane>^ planes, Bounds3 bounds, array<Actor^>^ results, [Optional] Nullable<QueryFilterData> filterData)
+{
+	ThrowIfNull(planes, "planes");
+	ThrowIfNull(results, "results");
+	if (planes->Length == 0)
+		throw gcnew ArgumentException("At least one plane is required", "planes");
+
+	// Plane has the same layout as PxPlane
+	pin_ptr<Plane> p = &planes[0];
+	PxU32 planeCount = planes->Length;
+
+	return Cull((const PxPlane*)p, &planeCount, 1, Bounds3::ToUnmanaged(bounds), results, nullptr, filterData);
+}
+int Scene::CullActors(array<Matrix>^ viewProjections, array<Actor^>^ results, [Optional] array<int>^ visibilityMasks, [Optional] Nullable<QueryFilterData> filterData)
+{
+	ThrowIfNull(viewProjections, "viewProjections");
+	ThrowIfNull(results, "results");
+	if (viewProjections->Length == 0 || viewProjections->Length > 32)
+		throw gcnew ArgumentOutOfRangeException("viewProjections", "Between 1 and 32 frusta can be culled at once");
+	if (visibilityMasks != nullptr && visibilityMasks->Length < results->Length)
+		throw gcnew ArgumentException("visibilityMasks must be at least as long as results", "visibilityMasks");
+
+	const int frustumCount = viewProjections->Length;
+
+	std::vector<PxPlane> planes(frustumCount * 6);
+	std::vector<PxU32> planeCounts(frustumCount, 6);
+	PxBounds3 bounds = PxBounds3::empty();
+
+	for (int i = 0; i < frustumCount; i++)
+	{
+		Matrix viewProjection = viewProjections[i];
+
+		GetFrustumPlanes(viewProjection, &planes[i * 6]);
+
+		// The corners of the frustum are the corners of the clip space box brought back to world space
+		Matrix inverse;
+		if (!Matrix::Invert(viewProjection, inverse))
+			throw gcnew ArgumentException(String::Format("View projection matrix {0} cannot be inverted", i), "viewProjections");
+
+		for (int c = 0; c < 8; c++)
+		{
+			Vector4 corner = Vector4::Transform(Vector4((c & 1) ? 1.0f : -1.0f, (c & 2) ? 1.0f : -1.0f, (c & 4) ? 1.0f : 0.0f, 1.0f), inverse);
+
+			bounds.include(PxVec3(corner.X, corner.Y, corner.Z) / corner.W);
+		}
+	}
+
+	return Cull(&planes[0], &planeCounts[0], frustumCount, bounds, results, visibilityMasks, filterData);
+}
+
+int Scene::Cull(const PxPlane* planes, const PxU32* planeCounts, PxU32 volumeCount, const PxBounds3& bounds, array<Actor^>^ results, array<int>^ visibilityMasks, Nullable<QueryFilterData> filterData)
+{
+	ThrowIfThisDisposed();
+
+	if (bounds.isEmpty())
+		return 0;
+
+	// The scene query trees report every shape whose bounds overlap the volumes' bounding box
+	PxBoxGeometry box(bounds.getExtents().maximum(PxVec3(PX_EPS_REAL)));
+	PxTransform pose(bounds.getCenter());
+
+	InternalCullingCallback callback(planes, planeCounts, volumeCount);
+
+	PxQueryFilterData fd = (filterData.HasValue ? QueryFilterData::ToUnmanaged(filterData.Value) : PxQueryFilterData());
+
+	_scene->overlap(box, pose, callback, fd);
+
+	if (callback.hasBlock)
+		callback.processTouches(&callback.block, 1);
+
+	int count = 0;
+
+	for (PxU32 i = 0; i < callback.getActorCount(); i++)
+	{
+		Actor^ actor = ObjectTable::TryGetObject<Actor^>((intptr_t)callback.getActor(i));
+
+		if (actor == nullptr)
+			continue;
+
+		if (count < results->Length)
+		{
+			results[count] = actor;
+
+			if (visibilityMasks != nullptr)
+				visibilityMasks[count] = (int)callback.getMask(i);
+		}
+
+		count++;
+	}
+
+	return count;
+}
+
+int Scene::FindNearestActors(Vector3 point, float radius, array<Actor^>^ results, [Optional] array<float>^ distances, [Optional] Nullable<QueryFilterData> filterData)
+{
+	return FindActorsNear(point, radius, results, distances, filterData, false);
+}
+int Scene::FindActorsWithinRadius(Vector3 point, float radius, array<Actor^>^ results, [Optional] array<float>^ distances, [Optional] Nullable<QueryFilterData> filterData)
+{
+	return FindActorsNear(point, radius, results, distances, filterData, true);
+}
+
+int Scene::FindActorsNear(Vector3 point, float radius, array<Actor^>^ results, array<float>^ distances, Nullable<QueryFilterData> filterData, bool countAll)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(results, "results");
+	if (radius <= 0)
+		throw gcnew ArgumentOutOfRangeException("radius", "Radius must be greater than zero");
+	if (distances != nullptr && distances->Length < results->Length)
+		throw gcnew ArgumentException("distances must be at least as long as results", "distances");
+
+	PxVec3 p = UV(point);
+
+	InternalProximityCallback callback(p);
+
+	PxQueryFilterData fd = (filterData.HasValue ? QueryFilterData::ToUnmanaged(filterData.Value) : PxQueryFilterData());
+
+	_scene->overlap(PxSphereGeometry(radius), PxTransform(p), callback, fd);
+
+	if (callback.hasBlock)
+		callback.processTouches(&callback.block, 1);
+
+	// Leave out the actors without a managed instance before sorting, so the nearest ones returned are the nearest found
+	for (PxU32 i = 0; i < callback.getActorCount(); i++)
+	{
+		if (ObjectTable::TryGetObject<Actor^>((intptr_t)callback.getActor(i)) == nullptr)
+			callback.dropActor(i);
+	}
+
+	callback.sortNearest(results->Length);
+
+	int count = (int)callback.getActorCount();
+	int written = Math::Min(count, results->Length);
+
+	for (int i = 0; i < written; i++)
+	{
+		results[i] = ObjectTable::GetObject<Actor^>((intptr_t)callback.getActor(i));
+
+		if (distances != nullptr)
+			distances[i] = callback.getDistance(i);
+	}
+
+	return countAll ? count : written;
+}
+
 #pragma region Character
 ControllerManager^ Scene::CreateControllerManager()
 {
@@ -248,6 +248,65 @@ namespace PhysX
 			bool Raycast(Vector3 origin, Vector3 direction, float distance, int maximumHits, Func<array<RaycastHit^>^, bool>^ hitCall, [Optional] HitFlag hitFlag, [Optional] Nullable<QueryFilterData> filterData, [Optional] QueryFilterCallback^ filterCallback, [Optional] QueryCache^ cache);
 			bool Sweep(Geometry^ geometry, Matrix pose, Vector3 direction, float distance, int maximumHits, Func<array<SweepHit^>^, bool>^ hitCall, [Optional] HitFlag hitFlag, [Optional] Nullable<QueryFilterData> filterData, [Optional] QueryFilterCallback^ filterCallback, [Optional] QueryCache^ cache);
 			bool Overlap(Geometry^ geometry, Matrix pose, int maximumOverlaps, Func<array<OverlapHit^>^, bool>^ hitCall, [Optional] Nullable<QueryFilterData> filterData, [Optional] QueryFilterCallback^ filterCallback);
+
+			/// <summary>
+			/// Finds the actors with a shape at least partly inside a convex volume. The scene query trees are searched
+			/// within the volume's bounds, and each shape found is tested natively against the planes.
+			/// Safe to call from several threads at once while the scene is not being written to.
+			/// </summary>
+			/// <param name="planes">The planes of the volume, with their normals pointing out of the volume.</param>
+			/// <param name="bounds">The bounds of the volume.</param>
+			/// <param name="results">Receives the visible actors.</param>
+			/// <param name="filterData">Optional filtering of the shapes tested, as for Overlap.</param>
+			/// <returns>
+			/// The number of visible actors. If it's larger than results.Length only the first results.Length were
+			/// written, so grow the buffer and cull again.
+			/// </returns>
+			int CullActors(array<Plane>^ planes, Bounds3 bounds, array<Actor^>^ results, [Optional] Nullable<QueryFilterData> filterData);
+			/// <summary>
+			/// Finds the actors with a shape at least partly inside any of up to 32 view frusta (e.g. several cameras or
+			/// the interest areas of several players) in a single search of the scene query trees.
+			/// Safe to call from several threads at once while the scene is not being written to.
+			/// </summary>
+			/// <param name="viewProjections">The view * projection matrix of each frustum, with depth from 0 (near) to 1 (far) as created by Matrix4x4.</param>
+			/// <param name="results">Receives the visible actors.</param>
+			/// <param name="visibilityMasks">Optionally receives, for each visible actor, a mask of the frusta it is visible in (bit i for frustum i).</param>
+			/// <param name="filterData">Optional filtering of the shapes tested, as for Overlap.</param>
+			/// <returns>
+			/// The number of visible actors. If it's larger than results.Length only the first results.Length were
+			/// written, so grow the buffer and cull again.
+			/// </returns>
+			int CullActors(array<Matrix>^ viewProjections, array<Actor^>^ results, [Optional] array<int>^ visibilityMasks, [Optional] Nullable<QueryFilterData> filterData);
+
+			/// <summary>
+			/// Finds the actors nearest to a point within a radius, nearest first, without allocating a hit per actor.
+			/// The distance to an actor is the distance to the closest point of its shapes' world bounds, so it is 0 for a point inside them.
+			/// Safe to call from several threads at once while the scene is not being written to.
+			/// </summary>
+			/// <param name="point">The point to search around.</param>
+			/// <param name="radius">The search radius.</param>
+			/// <param name="results">Receives the nearest actors, its length is the number of actors wanted.</param>
+			/// <param name="distances">Optionally receives the distance to each actor found.</param>
+			/// <param name="filterData">
+			/// Optional filtering of the shapes searched, as for Overlap. For example use QueryFlag.Dynamic to only find dynamic actors.
+			/// </param>
+			/// <returns>The number of actors written to results.</returns>
+			int FindNearestActors(Vector3 point, float radius, array<Actor^>^ results, [Optional] array<float>^ distances, [Optional] Nullable<QueryFilterData> filterData);
+			/// <summary>
+			/// Finds all the actors within a radius of a point, nearest first, without allocating a hit per actor.
+			/// The distance to an actor is the distance to the closest point of its shapes' world bounds, so it is 0 for a point inside them.
+			/// Safe to call from several threads at once while the scene is not being written to.
+			/// </summary>
+			/// <param name="point">The point to search around.</param>
+			/// <param name="radius">The search radius.</param>
+			/// <param name="results">Receives the actors found.</param>
+			/// <param name="distances">Optionally receives the distance to each actor found.</param>
+			/// <param name="filterData">Optional filtering of the shapes searched, as for Overlap.</param>
+			/// <returns>
+			/// The number of actors within the radius. If it's larger than results.Length only the nearest results.Length were
+			/// written, so grow the buffer and search again.
+			/// </returns>
+			int FindActorsWithinRadius(Vector3 point, float radius, array<Actor^>^ results, [Optional] array<float>^ distances, [Optional] Nullable<QueryFilterData> filterData);
 			#pragma endregion
 
 			#pragma region Character
@@ -372,6 +431,10 @@ namespace PhysX
 			/// </summary>
 			property Object^ UserData;
 
+		private:
+			int Cull(const PxPlane* planes, const PxU32* planeCounts, PxU32 volumeCount, const PxBounds3& bounds, array<Actor^>^ results, array<int>^ visibilityMasks, Nullable<QueryFilterData> filterData);
+			int FindActorsNear(Vector3 point, float radius, array<Actor^>^ results, array<float>^ distances, Nullable<QueryFilterData> filterData, bool countAll);
+
 		internal:
 			property PxScene* UnmanagedPointer
 			{
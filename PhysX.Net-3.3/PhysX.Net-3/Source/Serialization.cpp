@@ -5,6 +5,22 @@
 #include "SerializationRegistry.h"
 #include "Collection.h"
 #include "Cooking.h"
+#include "MemoryMappedInputData.h"
+#include "StreamOutputStream.h"
+
+void Serialization::Complete(Collection^ collection, SerializationRegistry^ sr, [Optional] Collection^ exceptFor, [Optional] Nullable<bool> followJoints)
+{
+	ThrowIfNullOrDisposed(collection, "collection");
+	ThrowIfNull(sr, "sr");
+
+	PxSerialization::complete
+	(
+		*collection->UnmanagedPointer,
+		*sr->UnmanagedPointer,
+		(exceptFor == nullptr ? NULL : exceptFor->UnmanagedPointer),
+		followJoints.GetValueOrDefault(false)
+	);
+}
 
 bool Serialization::SerializeCollectionToXml(Stream^ outputStream, Collection^ collection, SerializationRegistry^ sr, [Optional] Cooking^ cooking, [Optional] Collection^ externalRefs, [Optional] Nullable<XmlParserOptions> parserOptions)
 {
@@ -12,7 +28,7 @@ bool Serialization::SerializeCollectionToXml(Stream^ outputStream, Collection^ c
 	if (!outputStream->CanWrite)
 		throw gcnew ArgumentException("Cannot write to stream", "outputStream");
 
-	PxDefaultMemoryOutputStream s;
+	StreamOutputStream s(outputStream);
 
 	bool result = PxSerialization::serializeCollectionToXml
 	(
@@ -24,23 +40,13 @@ bool Serialization::SerializeCollectionToXml(Stream^ outputStream, Collection^ c
 		(parserOptions.HasValue ? &XmlParserOptions::ToUnmanaged(parserOptions.Value) : NULL)
 	);
 
+	// Don't leave a partial collection in the caller's stream
 	if (!result)
-		return false;
-
-	PxU32 size = s.getSize();
-
-	if (size <= 0)
-		return false;
-
-	PxU8* data = s.getData();
+		s.discard();
 
-	array<Byte>^ buffer = gcnew array<Byte>(size);
-	pin_ptr<Byte> b = &buffer[0];
-	memcpy_s(b, size, (void*)data, size);
+	s.flush();
 
-	outputStream->Write(buffer, 0, size);
-
-	return true;
+	return result && s.getBytesWritten() > 0;
 }
  
 bool Serialization::SerializeCollectionToBinary (Stream^ outputStream, Collection^ collection, SerializationRegistry^ sr, [Optional] Collection^ externalRefs, [Optional] Nullable<bool> exportNames)
@@ -49,7 +55,7 @@ bool Serialization::SerializeCollectionToBinary (Stream^ outputStream, Collectio
 	if (!outputStream->CanWrite)
 		throw gcnew ArgumentException("Cannot write to stream", "outputStream");
 
-	PxDefaultMemoryOutputStream s;
+	StreamOutputStream s(outputStream);
 
 	bool result = PxSerialization::serializeCollectionToBinary
 	(
@@ -61,22 +67,46 @@ bool Serialization::SerializeCollectionToBinary (Stream^ outputStream, Collectio
 	);
 
 	if (!result)
-		return false;
+		s.discard();
+
+	s.flush();
+
+	return result && s.getBytesWritten() > 0;
+}
+
+Collection^ Serialization::CreateCollectionFromBinary(String^ filename, SerializationRegistry^ sr, [Optional] Collection^ externalRefs)
+{
+	ThrowIfNull(filename, "filename");
+	ThrowIfNull(sr, "sr");
+
+	Physics^ physics = sr->Physics;
+	ThrowIfNullOrDisposed(physics, "sr.Physics");
 
-	PxU32 size = s.getSize();
+	MemoryMappedInputData* mappedFile = new MemoryMappedInputData(filename);
 
-	if (size <= 0)
-		return false;
+	if (((size_t)mappedFile->getData() & (PX_SERIAL_FILE_ALIGN - 1)) != 0)
+	{
+		delete mappedFile;
+		throw gcnew InvalidOperationException(String::Format("The mapped view is not aligned to {0} bytes", PX_SERIAL_FILE_ALIGN));
+	}
 
-	PxU8* data = s.getData();
+	PxCollection* collection = PxSerialization::createCollectionFromBinary
+	(
+		mappedFile->getData(),
+		*sr->UnmanagedPointer,
+		(externalRefs == nullptr ? NULL : externalRefs->UnmanagedPointer)
+	);
 
-	array<Byte>^ buffer = gcnew array<Byte>(size);
-	pin_ptr<Byte> b = &buffer[0];
-	memcpy_s(b, size, (void*)data, size);
+	if (collection == NULL)
+	{
+		delete mappedFile;
+		throw gcnew OperationFailedException("Failed to deserialize the binary collection. See the error log of the Physics instance.");
+	}
 
-	outputStream->Write(buffer, 0, size);
+	// The deserialized objects live in the mapped memory
+	physics->AddMappedFile(mappedFile);
 
-	return true;
+	return gcnew Collection(collection, physics);
 }
 
 SerializationRegistry^ Serialization::CreateSerializationRegistry(Physics^ physics)
@@ -85,5 +115,5 @@ SerializationRegistry^ Serialization::CreateSerializationRegistry(Physics^ physi
 
 	PxSerializationRegistry* sr = PxSerialization::createSerializationRegistry(*physics->UnmanagedPointer);
 
-	return gcnew SerializationRegistry(sr);
+	return gcnew SerializationRegistry(sr, physics);
 }
\ No newline at end of file
@@ -19,13 +19,30 @@ namespace PhysX
 
 	public:
 		//static bool IsSerializable(Collection^ collection, SerializationRegistry^ sr, [Optional] Collection^ externalReferences);
-		//static void Complete(Collection^ collection, SerializationRegistry^ sr, [Optional] Collection^ exceptFor, [Optional] Nullable<bool> followJoints);
+
+		/// <summary>
+		/// Adds to a collection all objects its objects require, so that it can be serialized on its own.
+		/// </summary>
+		/// <param name="collection">The collection to complete.</param>
+		/// <param name="sr">The serialization registry.</param>
+		/// <param name="exceptFor">Objects in this collection are not added (e.g. objects shared as external references).</param>
+		/// <param name="followJoints">Whether the actors connected by joints in the collection are also added.</param>
+		static void Complete(Collection^ collection, SerializationRegistry^ sr, [Optional] Collection^ exceptFor, [Optional] Nullable<bool> followJoints);
 		//static void CreateNames(Collection^ collection, long base);
 		//static void Remove(Collection^ collection, int serialType, SerializationRegistry^ sr, [Optional] Collection^ to);
 
 		//static PxCollection *  createCollectionFromXml (PxInputData &inputData, PxCooking &cooking, PxSerializationRegistry &sr, const PxCollection *externalRefs=NULL, PxStringTable *stringTable=NULL, PxXmlParserOptions *outArgs=NULL);
 		//
-		//static PxCollection *  createCollectionFromBinary (void *memBlock, PxSerializationRegistry &sr, const PxCollection *externalRefs=NULL);
+		/// <summary>
+		/// Deserializes a collection from a binary file, in place.
+		/// The file is memory mapped (copy-on-write) and PhysX creates the objects directly in the mapped memory,
+		/// so the file is never read into an intermediate buffer. The mapping is owned by the Physics instance
+		/// of the registry and stays alive until it is disposed.
+		/// </summary>
+		/// <param name="filename">The path of a file written by SerializeCollectionToBinary.</param>
+		/// <param name="sr">The serialization registry.</param>
+		/// <param name="externalRefs">Collection of objects the serialized collection references.</param>
+		static Collection^ CreateCollectionFromBinary(String^ filename, SerializationRegistry^ sr, [Optional] Collection^ externalRefs);
  
 		static bool SerializeCollectionToXml(Stream^ outputStream, Collection^ collection, SerializationRegistry^ sr, [Optional] Cooking^ cooking, [Optional] Collection^ externalRefs, [Optional] Nullable<XmlParserOptions> parserOptions);
  
@@ -1,12 +1,20 @@
 #include "StdAfx.h"
 #include "SerializationRegistry.h"
+#include "Physics.h"
 
-SerializationRegistry::SerializationRegistry(PxSerializationRegistry* serializationRegistry)
+SerializationRegistry::SerializationRegistry(PxSerializationRegistry* serializationRegistry, PhysX::Physics^ physics)
 {
 	if (serializationRegistry == NULL)
 		throw gcnew ArgumentNullException("serializationRegistry");
+	ThrowIfNullOrDisposed(physics, "physics");
 
 	_serializationRegistry = serializationRegistry;
+	_physics = physics;
+}
+
+PhysX::Physics^ SerializationRegistry::Physics::get()
+{
+	return _physics;
 }
 
 PxSerializationRegistry* SerializationRegistry::UnmanagedPointer::get()
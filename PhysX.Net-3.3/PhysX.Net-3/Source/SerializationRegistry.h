@@ -3,16 +3,25 @@
 
 namespace PhysX
 {
+	ref class Physics;
+
 	public ref class SerializationRegistry
 	{
 	private:
 		PxSerializationRegistry* _serializationRegistry;
+		PhysX::Physics^ _physics;
 
 	internal:
-		SerializationRegistry(PxSerializationRegistry* serializationRegistry);
+		SerializationRegistry(PxSerializationRegistry* serializationRegistry, PhysX::Physics^ physics);
 
 	public:
-
+		/// <summary>
+		/// Gets the physics instance the registry was created for.
+		/// </summary>
+		property PhysX::Physics^ Physics
+		{
+			PhysX::Physics^ get();
+		}
 
 	internal:
 		property PxSerializationRegistry* UnmanagedPointer
@@ -0,0 +1,108 @@
+#include "StdAfx.h"
+#include "StreamOutputStream.h"
+
+StreamOutputStream::StreamOutputStream(System::IO::Stream^ stream, PxU32 chunkSize)
+{
+	ThrowIfNull(stream, "stream");
+	if (!stream->CanWrite)
+		throw gcnew ArgumentException("Cannot write to stream", "stream");
+	if (chunkSize == 0)
+		throw gcnew ArgumentOutOfRangeException("chunkSize");
+
+	_stream = stream;
+	_buffer = gcnew array<Byte>(chunkSize);
+	_error = nullptr;
+	_bufferCount = 0;
+	_bytesWritten = 0;
+	_startPosition = (stream->CanSeek ? stream->Position : -1);
+}
+
+PxU32 StreamOutputStream::write(const void* src, PxU32 count)
+{
+	if (static_cast<Exception^>(_error) != nullptr)
+		return 0;
+
+	array<Byte>^ buffer = _buffer;
+	PxU32 capacity = buffer->Length;
+
+	const PxU8* s = (const PxU8*)src;
+	PxU32 remaining = count;
+
+	while (remaining > 0)
+	{
+		if (_bufferCount == capacity && !writeBuffer())
+			return count - remaining;
+
+		PxU32 n = PxMin(remaining, capacity - _bufferCount);
+
+		pin_ptr<Byte> b = &buffer[_bufferCount];
+		memcpy(b, s, n);
+
+		_bufferCount += n;
+		_bytesWritten += n;
+		s += n;
+		remaining -= n;
+	}
+
+	return count;
+}
+
+void StreamOutputStream::flush()
+{
+	writeBuffer();
+
+	Exception^ error = _error;
+	if (error != nullptr)
+	{
+		discard();
+
+		throw gcnew System::IO::IOException("Failed to write PhysX output to the stream", error);
+	}
+
+	_stream->Flush();
+}
+
+void StreamOutputStream::discard()
+{
+	_bufferCount = 0;
+
+	if (_startPosition < 0)
+		return;
+
+	try
+	{
+		_stream->SetLength(_startPosition);
+		_stream->Position = _startPosition;
+	}
+	catch (Exception^)
+	{
+		// The stream is already failing, the original error is the one worth reporting
+		if (static_cast<Exception^>(_error) == nullptr)
+			throw;
+	}
+}
+
+PxU64 StreamOutputStream::getBytesWritten() const
+{
+	return _bytesWritten;
+}
+
+bool StreamOutputStream::writeBuffer()
+{
+	if (_bufferCount == 0)
+		return true;
+
+	try
+	{
+		_stream->Write(_buffer, 0, _bufferCount);
+		_bufferCount = 0;
+
+		return true;
+	}
+	catch (Exception^ ex)
+	{
+		_error = ex;
+
+		return false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+namespace PhysX
+{
+	/// <summary>
+	/// A PxOutputStream implementation which writes to a managed stream in fixed size chunks.
+	/// PhysX output is copied once into a small staging buffer and then written straight to the stream, instead of being
+	/// accumulated in full in a PxDefaultMemoryOutputStream and copied into a managed array of the same size.
+	/// </summary>
+	/// <remarks>
+	/// Exceptions thrown by the managed stream can't be propagated through PhysX, so they are caught and the write reports
+	/// zero bytes written. Call Flush once PhysX is done, which writes any remaining data and rethrows a caught exception.
+	/// If the stream is seekable, a failed write or a call to Discard truncates it back to where PhysX started writing.
+	/// </remarks>
+	class StreamOutputStream : public PxOutputStream
+	{
+	public:
+		static const PxU32 DefaultChunkSize = 64 * 1024;
+
+	private:
+		gcroot<System::IO::Stream^> _stream;
+		gcroot<array<Byte>^> _buffer;
+		gcroot<Exception^> _error;
+		PxU32 _bufferCount;
+		PxU64 _bytesWritten;
+		PxI64 _startPosition;
+
+	public:
+		StreamOutputStream(System::IO::Stream^ stream, PxU32 chunkSize = DefaultChunkSize);
+
+		virtual PxU32 write(const void* src, PxU32 count);
+
+		/// <summary>
+		/// Writes the buffered data to the stream. Rethrows any exception the stream threw during a PhysX write.
+		/// </summary>
+		void flush();
+
+		/// <summary>
+		/// Drops the buffered data and, if the stream is seekable, truncates it back to where PhysX started writing.
+		/// Use this when PhysX reports a failure after having written part of its output.
+		/// </summary>
+		void discard();
+
+		/// <summary>
+		/// Gets the total number of bytes PhysX has written to this stream.
+		/// </summary>
+		PxU64 getBytesWritten() const;
+
+	private:
+		bool writeBuffer();
+	};
+};
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include "StdAfx.h"
+#include "StridedTriangleMeshDesc.h"
+#include "TriangleMeshDesc.h"
+
+StridedTriangleMeshDesc::StridedTriangleMeshDesc()
+{
+	ConvexEdgeThreshold = 0.001f;
+}
+
+StridedTriangleMeshDesc^ StridedTriangleMeshDesc::FromDesc(TriangleMeshDesc^ desc)
+{
+	ThrowIfNull(desc, "desc");
+
+	auto d = gcnew StridedTriangleMeshDesc();
+
+	d->Points = BoundedData(desc->Points, 0, desc->Points->Length, sizeof(PxVec3));
+	d->Flags = desc->Flags;
+	d->ConvexEdgeThreshold = desc->ConvexEdgeThreshold;
+
+	if (desc->Triangles != nullptr)
+	{
+		Nullable<bool> is16BitTris = desc->Is16BitTriangleIndices();
+		if (!is16BitTris.HasValue)
+			throw gcnew InvalidOperationException("Triangles must be a generic array of either 16 or 32 bit integers");
+
+		int indexSize = is16BitTris.Value ? sizeof(PxU16) : sizeof(PxU32);
+
+		d->Triangles = BoundedData(desc->Triangles, 0, desc->Triangles->Length / 3, indexSize * 3);
+
+		// The index size follows the array type
+		if (is16BitTris.Value)
+			d->Flags = d->Flags | MeshFlag::Indices16Bit;
+		else
+			d->Flags = d->Flags & ~MeshFlag::Indices16Bit;
+	}
+
+	if (desc->MaterialIndices != nullptr)
+		d->MaterialIndices = BoundedData(desc->MaterialIndices, 0, desc->MaterialIndices->Length, sizeof(PxMaterialTableIndex));
+
+	return d;
+}
+
+bool StridedTriangleMeshDesc::IsValid()
+{
+	// At least 1 triangle's worth of points
+	if (Points.Count < 3)
+		return false;
+	// Non-indexed meshes must define a whole number of triangles
+	if (Triangles.Count == 0 && (Points.Count % 3) != 0)
+		return false;
+	if (MaterialIndices.Count != 0 && MaterialIndices.Count < (Triangles.Count == 0 ? Points.Count / 3 : Triangles.Count))
+		return false;
+
+	return true;
+}
\ No newline at end of file
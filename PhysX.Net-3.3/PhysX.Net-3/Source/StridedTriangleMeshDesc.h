@@ -0,0 +1,48 @@
+#pragma once
+
+#include "GeometryUtilEnum.h"
+#include "BoundedData.h"
+
+namespace PhysX
+{
+	ref class TriangleMeshDesc;
+
+	/// <summary>
+	/// Describes a triangle mesh whose points, indices and material indices are read in place from native memory or
+	/// pinned managed arrays, each with its own stride.
+	/// Unlike TriangleMeshDesc, nothing is copied or repacked before cooking.
+	/// </summary>
+	public ref class StridedTriangleMeshDesc
+	{
+		public:
+			StridedTriangleMeshDesc();
+
+		internal:
+			// Describes the arrays of a TriangleMeshDesc in place
+			static StridedTriangleMeshDesc^ FromDesc(TriangleMeshDesc^ desc);
+
+		public:
+			bool IsValid();
+
+			/// <summary>
+			/// Gets or sets the vertex positions, three floats at the start of each element.
+			/// </summary>
+			property BoundedData Points;
+
+			/// <summary>
+			/// Gets or sets the triangles, three vertex indices at the start of each element.
+			/// The indices are 16 bit if Flags contains MeshFlag.Indices16Bit, otherwise 32 bit.
+			/// Leave empty for a non-indexed mesh, where every three points form a triangle.
+			/// </summary>
+			property BoundedData Triangles;
+
+			/// <summary>
+			/// Gets or sets the optional per triangle material indices, one 16 bit value at the start of each element.
+			/// </summary>
+			property BoundedData MaterialIndices;
+
+			property MeshFlag Flags;
+
+			property float ConvexEdgeThreshold;
+	};
+};
\ No newline at end of file
@@ -0,0 +1,530 @@
+#include "StdAfx.h"
+#include "TerrainPager.h"
+#include "Scene.h"
+#include "Physics.h"
+#include "Material.h"
+#include "RigidStatic.h"
+#include "HeightField.h"
+#include "HeightFieldDesc.h"
+#include "HeightFieldGeometry.h"
+
+namespace PhysX
+{
+	// A tile known to the pager, from when it's requested until it's evicted
+	private ref class TerrainTile
+	{
+	public:
+		int X;
+		int Z;
+
+		// Set by the loading thread
+		PhysX::HeightField^ HeightField;
+		Exception^ Error;
+
+		// Guarded by the queue lock, true while waiting in the request list
+		bool Queued;
+
+		// Only used by the updating thread
+		bool Loaded;
+		RigidStatic^ Actor;
+		bool Active;
+		float Distance;
+		int LastUsed;
+	};
+};
+
+TerrainPager::TerrainPager(PhysX::Scene^ scene, Material^ material, Func<int, int, HeightFieldDesc^>^ tileLoader, float tileSize)
+{
+	ThrowIfNullOrDisposed(scene, "scene");
+	ThrowIfNullOrDisposed(material, "material");
+	ThrowIfNull(tileLoader, "tileLoader");
+	if (tileSize <= 0)
+		throw gcnew ArgumentOutOfRangeException("tileSize", "Tile size must be greater than zero");
+
+	_scene = scene;
+	_material = material;
+	_tileLoader = tileLoader;
+	_tileSize = tileSize;
+
+	_tiles = gcnew Dictionary<__int64, TerrainTile^>();
+	_frame = 0;
+
+	_requests = gcnew List<TerrainTile^>();
+	_completed = gcnew List<TerrainTile^>();
+	_queueLock = gcnew Object();
+	_loading = 0;
+	_stopping = false;
+
+	HeightScale = 1;
+	LoadDistance = tileSize;
+	UnloadDistance = tileSize * 1.5f;
+	MaximumCachedTiles = 16;
+
+	_worker = gcnew Thread(gcnew ThreadStart(this, &TerrainPager::WorkerMain));
+	_worker->Name = "PhysX Terrain Pager";
+	_worker->IsBackground = true;
+	_worker->Start();
+
+	ObjectTable::AddObjectOwner(this, scene);
+}
+TerrainPager::~TerrainPager()
+{
+	this->!TerrainPager();
+}
+TerrainPager::!TerrainPager()
+{
+	OnDisposing(this, nullptr);
+
+	if (Disposed)
+		return;
+
+	// Drop the requests not yet started, and let the loading thread finish its current tile
+	Monitor::Enter(_queueLock);
+	try
+	{
+		_stopping = true;
+		_requests->Clear();
+
+		Monitor::PulseAll(_queueLock);
+	}
+	finally
+	{
+		Monitor::Exit(_queueLock);
+	}
+
+	_worker->Join();
+
+	for each(TerrainTile^ tile in _tiles->Values)
+		DisposeTile(tile);
+
+	_tiles->Clear();
+	_completed->Clear();
+	_scene = nullptr;
+
+	OnDisposed(this, nullptr);
+}
+bool TerrainPager::Disposed::get()
+{
+	return (_scene == nullptr);
+}
+
+void TerrainPager::Update(array<Vector3>^ pointsOfInterest, [Optional] bool waitForTiles)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(pointsOfInterest, "pointsOfInterest");
+
+	_frame++;
+
+	Exception^ error = nullptr;
+
+	Collect(error);
+	Request(pointsOfInterest);
+
+	if (waitForTiles)
+	{
+		WaitForRequests();
+		Collect(error);
+	}
+
+	Activate();
+	Evict();
+
+	// Everything else is up to date, the failed tiles are requested again next update
+	if (error != nullptr)
+		throw gcnew InvalidOperationException("Failed to load a terrain tile", error);
+}
+
+void TerrainPager::Collect(Exception^% error)
+{
+	List<TerrainTile^>^ completed;
+
+	Monitor::Enter(_queueLock);
+	try
+	{
+		completed = _completed;
+		_completed = gcnew List<TerrainTile^>();
+	}
+	finally
+	{
+		Monitor::Exit(_queueLock);
+	}
+
+	for each(TerrainTile^ tile in completed)
+	{
+		if (tile->Error != nullptr)
+		{
+			if (error == nullptr)
+				error = tile->Error;
+
+			_tiles->Remove(GetKey(tile->X, tile->Z));
+			continue;
+		}
+
+		tile->Loaded = true;
+	}
+}
+
+void TerrainPager::Request(array<Vector3>^ pointsOfInterest)
+{
+	float loadDistance = LoadDistance;
+	float unloadDistance = Math::Max(UnloadDistance, loadDistance);
+
+	for each(TerrainTile^ tile in _tiles->Values)
+	{
+		tile->Distance = GetDistance(tile->X, tile->Z, pointsOfInterest);
+
+		if (tile->Distance <= unloadDistance)
+			tile->LastUsed = _frame;
+	}
+
+	Monitor::Enter(_queueLock);
+	try
+	{
+		// Drop the requests which have gone out of range before being loaded
+		for (int i = _requests->Count - 1; i >= 0; i--)
+		{
+			TerrainTile^ tile = _requests[i];
+
+			if (tile->Distance > unloadDistance)
+			{
+				tile->Queued = false;
+				_tiles->Remove(GetKey(tile->X, tile->Z));
+				_requests->RemoveAt(i);
+			}
+		}
+
+		for each(Vector3 p in pointsOfInterest)
+		{
+			int minX = (int)Math::Floor((p.X - loadDistance) / _tileSize);
+			int maxX = (int)Math::Floor((p.X + loadDistance) / _tileSize);
+			int minZ = (int)Math::Floor((p.Z - loadDistance) / _tileSize);
+			int maxZ = (int)Math::Floor((p.Z + loadDistance) / _tileSize);
+
+			for (int x = minX; x <= maxX; x++)
+			{
+				for (int z = minZ; z <= maxZ; z++)
+				{
+					if (Find(x, z) != nullptr)
+						continue;
+
+					float distance = GetDistance(x, z, pointsOfInterest);
+					if (distance > loadDistance)
+						continue;
+
+					TerrainTile^ tile = gcnew TerrainTile();
+						tile->X = x;
+						tile->Z = z;
+						tile->Queued = true;
+						tile->Distance = distance;
+						tile->LastUsed = _frame;
+
+					_tiles->Add(GetKey(x, z), tile);
+					_requests->Add(tile);
+				}
+			}
+		}
+
+		_requests->Sort(gcnew Comparison<TerrainTile^>(&TerrainPager::CompareByDistance));
+
+		Monitor::PulseAll(_queueLock);
+	}
+	finally
+	{
+		Monitor::Exit(_queueLock);
+	}
+}
+
+void TerrainPager::WaitForRequests()
+{
+	Monitor::Enter(_queueLock);
+	try
+	{
+		while (_requests->Count > 0 || _loading > 0)
+			Monitor::Wait(_queueLock);
+	}
+	finally
+	{
+		Monitor::Exit(_queueLock);
+	}
+}
+
+void TerrainPager::Activate()
+{
+	float loadDistance = LoadDistance;
+	float unloadDistance = Math::Max(UnloadDistance, loadDistance);
+
+	PhysX::Physics^ physics = _scene->Physics;
+
+	for each(TerrainTile^ tile in _tiles->Values)
+	{
+		if (!tile->Loaded || tile->HeightField == nullptr)
+			continue;
+
+		if (!tile->Active && tile->Distance <= loadDistance)
+		{
+			if (tile->Actor == nullptr)
+			{
+				PhysX::HeightField^ heightField = tile->HeightField;
+
+				auto geometry = gcnew HeightFieldGeometry(
+					heightField,
+					(MeshGeometryFlag)0,
+					HeightScale,
+					_tileSize / Math::Max(heightField->NumberOfRows - 1, 1),
+					_tileSize / Math::Max(heightField->NumberOfColumns - 1, 1));
+
+				Monitor::Enter(physics);
+				try
+				{
+					RigidStatic^ actor = physics->CreateRigidStatic(Nullable<Matrix>(Matrix::CreateTranslation(tile->X * _tileSize, 0, tile->Z * _tileSize)));
+					actor->CreateShape(geometry, _material, Nullable<Matrix>());
+
+					tile->Actor = actor;
+				}
+				finally
+				{
+					Monitor::Exit(physics);
+				}
+			}
+
+			_scene->AddActor(tile->Actor);
+			tile->Active = true;
+		}
+		else if (tile->Active && tile->Distance > unloadDistance)
+		{
+			_scene->RemoveActor(tile->Actor);
+			tile->Active = false;
+		}
+	}
+}
+
+void TerrainPager::Evict()
+{
+	auto cached = gcnew List<TerrainTile^>();
+
+	for each(TerrainTile^ tile in _tiles->Values)
+	{
+		if (IsCached(tile))
+			cached->Add(tile);
+	}
+
+	int excess = cached->Count - Math::Max(MaximumCachedTiles, 0);
+	if (excess <= 0)
+		return;
+
+	cached->Sort(gcnew Comparison<TerrainTile^>(&TerrainPager::CompareByLastUsed));
+
+	for (int i = 0; i < excess; i++)
+	{
+		TerrainTile^ tile = cached[i];
+
+		DisposeTile(tile);
+		_tiles->Remove(GetKey(tile->X, tile->Z));
+	}
+}
+
+void TerrainPager::DisposeTile(TerrainTile^ tile)
+{
+	PhysX::Physics^ physics = _scene->Physics;
+
+	Monitor::Enter(physics);
+	try
+	{
+		// Releasing the actor also removes it from the scene, and it must go before the height field its shape uses
+		if (tile->Actor != nullptr)
+			delete tile->Actor;
+		if (tile->HeightField != nullptr)
+			delete tile->HeightField;
+	}
+	finally
+	{
+		Monitor::Exit(physics);
+	}
+
+	tile->Actor = nullptr;
+	tile->HeightField = nullptr;
+	tile->Active = false;
+	tile->Loaded = false;
+}
+
+RigidStatic^ TerrainPager::GetTileActor(int tileX, int tileZ)
+{
+	TerrainTile^ tile = Find(tileX, tileZ);
+
+	return (tile == nullptr ? nullptr : tile->Actor);
+}
+
+bool TerrainPager::IsTileActive(int tileX, int tileZ)
+{
+	TerrainTile^ tile = Find(tileX, tileZ);
+
+	return (tile != nullptr && tile->Active);
+}
+
+bool TerrainPager::IsCached(TerrainTile^ tile)
+{
+	// Loaded, but beyond UnloadDistance of every point of interest as of the last update
+	return (tile->Loaded && !tile->Active && tile->LastUsed != _frame);
+}
+
+TerrainTile^ TerrainPager::Find(int tileX, int tileZ)
+{
+	TerrainTile^ tile;
+	if (_tiles->TryGetValue(GetKey(tileX, tileZ), tile))
+		return tile;
+
+	return nullptr;
+}
+
+float TerrainPager::GetDistance(int tileX, int tileZ, array<Vector3>^ pointsOfInterest)
+{
+	float minX = tileX * _tileSize;
+	float minZ = tileZ * _tileSize;
+
+	float nearest = Single::MaxValue;
+
+	// Distance in the XZ plane from each point to the tile's square
+	for each(Vector3 p in pointsOfInterest)
+	{
+		float dx = Math::Max(Math::Max(minX - p.X, p.X - (minX + _tileSize)), 0.0f);
+		float dz = Math::Max(Math::Max(minZ - p.Z, p.Z - (minZ + _tileSize)), 0.0f);
+
+		nearest = Math::Min(nearest, dx * dx + dz * dz);
+	}
+
+	return (float)Math::Sqrt(nearest);
+}
+
+void TerrainPager::WorkerMain()
+{
+	while (true)
+	{
+		TerrainTile^ tile;
+
+		Monitor::Enter(_queueLock);
+		try
+		{
+			while (!_stopping && _requests->Count == 0)
+				Monitor::Wait(_queueLock);
+
+			if (_stopping)
+				return;
+
+			tile = _requests[0];
+			tile->Queued = false;
+			_requests->RemoveAt(0);
+			_loading++;
+		}
+		finally
+		{
+			Monitor::Exit(_queueLock);
+		}
+
+		try
+		{
+			HeightFieldDesc^ desc = _tileLoader(tile->X, tile->Z);
+
+			if (desc != nullptr)
+			{
+				PhysX::Physics^ physics = _scene->Physics;
+
+				Monitor::Enter(physics);
+				try
+				{
+					tile->HeightField = physics->CreateHeightField(desc);
+				}
+				finally
+				{
+					Monitor::Exit(physics);
+				}
+			}
+		}
+		catch (Exception^ ex)
+		{
+			tile->Error = ex;
+		}
+
+		Monitor::Enter(_queueLock);
+		try
+		{
+			_completed->Add(tile);
+			_loading--;
+
+			Monitor::PulseAll(_queueLock);
+		}
+		finally
+		{
+			Monitor::Exit(_queueLock);
+		}
+	}
+}
+
+__int64 TerrainPager::GetKey(int tileX, int tileZ)
+{
+	return ((__int64)tileX << 32) | (unsigned int)tileZ;
+}
+
+int TerrainPager::CompareByDistance(TerrainTile^ a, TerrainTile^ b)
+{
+	return a->Distance.CompareTo(b->Distance);
+}
+
+int TerrainPager::CompareByLastUsed(TerrainTile^ a, TerrainTile^ b)
+{
+	// Oldest first, and the furthest first among tiles last used in the same update
+	if (a->LastUsed != b->LastUsed)
+		return a->LastUsed.CompareTo(b->LastUsed);
+
+	return b->Distance.CompareTo(a->Distance);
+}
+
+//
+
+PhysX::Scene^ TerrainPager::Scene::get()
+{
+	return _scene;
+}
+
+float TerrainPager::TileSize::get()
+{
+	return _tileSize;
+}
+
+int TerrainPager::ActiveTileCount::get()
+{
+	int count = 0;
+
+	for each(TerrainTile^ tile in _tiles->Values)
+	{
+		if (tile->Active)
+			count++;
+	}
+
+	return count;
+}
+
+int TerrainPager::CachedTileCount::get()
+{
+	int count = 0;
+
+	for each(TerrainTile^ tile in _tiles->Values)
+	{
+		if (IsCached(tile))
+			count++;
+	}
+
+	return count;
+}
+
+int TerrainPager::PendingTileCount::get()
+{
+	int count = 0;
+
+	for each(TerrainTile^ tile in _tiles->Values)
+	{
+		if (!tile->Loaded)
+			count++;
+	}
+
+	return count;
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#pragma once
+
+using namespace System::Threading;
+
+namespace PhysX
+{
+	ref class Scene;
+	ref class Material;
+	ref class RigidStatic;
+	ref class HeightFieldDesc;
+	ref class TerrainTile;
+
+	/// <summary>
+	/// Splits a large terrain into square height field tiles and keeps only the tiles near points of interest
+	/// (players, vehicles) in the scene. Tiles are loaded and created on a background thread, added to and removed
+	/// from the scene by Update, and tiles which leave the scene are kept in a bounded cache in case they are needed again.
+	/// </summary>
+	/// <remarks>
+	/// Tile (x, z) covers [x * TileSize, (x + 1) * TileSize] along X and [z * TileSize, (z + 1) * TileSize] along Z,
+	/// with its rows running along X and its columns along Z. Neighbouring tiles should repeat their shared edge
+	/// samples so the terrain has no seams.
+	/// Height fields are created while holding the lock on the Physics instance, as the CookingService does, and the
+	/// pager takes the same lock when creating or disposing tile actors.
+	/// </remarks>
+	public ref class TerrainPager : IDisposable
+	{
+	public:
+		/// <summary>Raised before any disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposing;
+		/// <summary>Raised once all disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposed;
+
+	private:
+		PhysX::Scene^ _scene;
+		Material^ _material;
+		Func<int, int, HeightFieldDesc^>^ _tileLoader;
+		float _tileSize;
+
+		Dictionary<__int64, TerrainTile^>^ _tiles;
+		int _frame;
+
+		Thread^ _worker;
+
+		// Tiles waiting to be loaded, nearest first, and tiles loaded since the last update, guarded by _queueLock
+		List<TerrainTile^>^ _requests;
+		List<TerrainTile^>^ _completed;
+		Object^ _queueLock;
+		int _loading;
+		bool _stopping;
+
+	public:
+		/// <summary>
+		/// Creates a terrain pager and starts its loading thread.
+		/// </summary>
+		/// <param name="scene">The scene the tile actors are added to.</param>
+		/// <param name="material">The material of the tile shapes.</param>
+		/// <param name="tileLoader">
+		/// Called on the loading thread with the coordinates of a tile to get its description, or null if there is no terrain there.
+		/// </param>
+		/// <param name="tileSize">The length of the side of a tile in world units.</param>
+		TerrainPager(PhysX::Scene^ scene, Material^ material, Func<int, int, HeightFieldDesc^>^ tileLoader, float tileSize);
+		~TerrainPager();
+	protected:
+		!TerrainPager();
+	public:
+		property bool Disposed
+		{
+			virtual bool get();
+		}
+
+		/// <summary>
+		/// Requests the tiles within LoadDistance of the points of interest, adds the loaded ones to the scene, removes
+		/// tiles beyond UnloadDistance from the scene and evicts the least recently used tiles from the cache.
+		/// Call between simulation steps.
+		/// </summary>
+		/// <param name="pointsOfInterest">The positions of the players, vehicles, etc. that need terrain under them.</param>
+		/// <param name="waitForTiles">If true, blocks until every requested tile is loaded, e.g. when spawning.</param>
+		void Update(array<Vector3>^ pointsOfInterest, [Optional] bool waitForTiles);
+
+		/// <summary>
+		/// Gets the actor of a tile, or null if the tile is not loaded or has no terrain.
+		/// </summary>
+		RigidStatic^ GetTileActor(int tileX, int tileZ);
+
+		/// <summary>
+		/// Gets whether a tile's actor is in the scene.
+		/// </summary>
+		bool IsTileActive(int tileX, int tileZ);
+
+		/// <summary>
+		/// Gets the scene the tile actors are added to.
+		/// </summary>
+		property PhysX::Scene^ Scene
+		{
+			PhysX::Scene^ get();
+		}
+
+		/// <summary>
+		/// Gets the length of the side of a tile in world units.
+		/// </summary>
+		property float TileSize
+		{
+			float get();
+		}
+
+		/// <summary>
+		/// Gets or sets the scale applied to the tile samples' heights. Applies to tiles loaded afterwards.
+		/// </summary>
+		property float HeightScale;
+
+		/// <summary>
+		/// Gets or sets the distance from a point of interest within which tiles are loaded and added to the scene.
+		/// </summary>
+		property float LoadDistance;
+
+		/// <summary>
+		/// Gets or sets the distance from every point of interest beyond which tiles are removed from the scene.
+		/// Keep it larger than LoadDistance so tiles near the boundary don't go in and out every frame; smaller values are treated as LoadDistance.
+		/// </summary>
+		property float UnloadDistance;
+
+		/// <summary>
+		/// Gets or sets the number of loaded tiles kept beyond UnloadDistance before the least recently used are disposed.
+		/// </summary>
+		property int MaximumCachedTiles;
+
+		/// <summary>
+		/// Gets the number of tiles in the scene.
+		/// </summary>
+		property int ActiveTileCount
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of loaded tiles beyond UnloadDistance, kept in case they are needed again.
+		/// </summary>
+		property int CachedTileCount
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of tiles requested or being loaded.
+		/// </summary>
+		property int PendingTileCount
+		{
+			int get();
+		}
+
+	private:
+		TerrainTile^ Find(int tileX, int tileZ);
+		bool IsCached(TerrainTile^ tile);
+		void Collect(Exception^% error);
+		void Request(array<Vector3>^ pointsOfInterest);
+		void WaitForRequests();
+		void Activate();
+		void Evict();
+		void DisposeTile(TerrainTile^ tile);
+		float GetDistance(int tileX, int tileZ, array<Vector3>^ pointsOfInterest);
+		void WorkerMain();
+		static __int64 GetKey(int tileX, int tileZ);
+		static int CompareByDistance(TerrainTile^ a, TerrainTile^ b);
+		static int CompareByLastUsed(TerrainTile^ a, TerrainTile^ b);
+	};
+};
\ No newline at end of file
@@ -25,6 +25,7 @@ PxTriangleMeshDesc TriangleMeshDesc::ToUnmanaged(TriangleMeshDesc^ desc)
 	{
 		auto i = PxTypedStridedData<PxMaterialTableIndex>();
 		i.data = new PxMaterialTableIndex[desc->MaterialIndices->Length];
+		i.stride = sizeof(PxMaterialTableIndex);
 		
 		d.materialIndices = i;
 		Util::AsUnmanagedArray<short>(desc->MaterialIndices, (void*)i.data, desc->MaterialIndices->Length);
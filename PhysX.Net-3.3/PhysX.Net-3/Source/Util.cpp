@@ -1,5 +1,6 @@
 #include "StdAfx.h"
 #include "Util.h"
+#include "StreamOutputStream.h"
 
 using namespace PhysX;
 
@@ -114,35 +115,44 @@ Nullable<bool> Util::Is16Or32Bit(Array^ values)
 	return Nullable<bool>();
 }
 
-PxDefaultMemoryInputData* Util::StreamToUnmanagedInputStream(System::IO::Stream^ stream)
+ArraySegment<Byte> Util::ReadStream(System::IO::Stream^ stream)
 {
 	ThrowIfNull(stream, "stream");
 	if (!stream->CanRead)
 		throw gcnew ArgumentException("Cannot read from stream", "stream");
-	if (stream->Length > 0xFFFFFFFF) // Max 32 bit (4 GB) (somewhat arbitary, but nothing will ever allocate this much)
-		throw gcnew OutOfMemoryException("Trying to allocation too much memory, the max is 4 GB");
 
-	int streamSize = (int)stream->Length;
+	// Avoid copying a memory stream's buffer, just expose the unread part of it
+	auto memoryStream = dynamic_cast<System::IO::MemoryStream^>(stream);
+	ArraySegment<Byte> buffer;
+	if (memoryStream != nullptr && memoryStream->TryGetBuffer(buffer))
+	{
+		int position = (int)memoryStream->Position;
+		int remaining = (int)memoryStream->Length - position;
 
-	if (streamSize == 0)
-		return new PxDefaultMemoryInputData(NULL, 0);
+		memoryStream->Position = memoryStream->Length;
+
+		return ArraySegment<Byte>(buffer.Array, buffer.Offset + position, Math::Max(remaining, 0));
+	}
 
-	PxU8* memoryStreamPtr = (PxU8*)malloc(streamSize * sizeof(PxU8));
+	if (stream->Length - stream->Position > Int32::MaxValue)
+		throw gcnew OutOfMemoryException("Trying to allocation too much memory, the max is 2 GB. Use a memory mapped file overload instead");
 
-	auto data = new PxDefaultMemoryInputData(memoryStreamPtr, streamSize);
+	int size = (int)(stream->Length - stream->Position);
 
-	if (memoryStreamPtr == NULL)
-		throw gcnew InvalidOperationException("Failed to allocate memory used for cloning managed stream");
+	array<Byte>^ data = gcnew array<Byte>(size);
 
-	ZeroMemory((void*)memoryStreamPtr, streamSize);
+	// Stream.Read may return less than requested
+	int offset = 0;
+	while (offset < size)
+	{
+		int read = stream->Read(data, offset, size - offset);
+		if (read <= 0)
+			break;
 
-	array<Byte>^ buffer = gcnew array<Byte>(streamSize);
-	stream->Read(buffer, 0, streamSize);
-	pin_ptr<Byte> b = &buffer[0];
+		offset += read;
+	}
 
-	memcpy_s((void*)memoryStreamPtr, streamSize, b, streamSize);
-	
-	return data;
+	return ArraySegment<Byte>(data, 0, offset);
 }
 //System::IO::MemoryStream^ Util::UnmanagedMemoryStreamToStream(MemoryStream& memoryStream)
 //{
@@ -162,19 +172,15 @@ void Util::CopyIntoStream(PxDefaultMemoryOutputStream* from, System::IO::Stream^
 	if (!to->CanWrite)
 		throw gcnew ArgumentException("Cannot write to destination stream", "to");
 
-	int streamSize = (int)from->getSize();
+	PxU32 streamSize = from->getSize();
 
-	if (streamSize <= 0)
+	if (streamSize == 0)
 		return;
 
-	PxU8* fromData = from->getData();
-
-	array<Byte>^ buffer = gcnew array<Byte>(streamSize);
-	pin_ptr<Byte> b = &buffer[0];
-
-	memcpy_s(b, streamSize, fromData, streamSize);
-
-	to->Write(buffer, 0, streamSize);
+	// Write through in chunks rather than copying the whole buffer into a managed array first
+	StreamOutputStream s(to);
+	s.write(from->getData(), streamSize);
+	s.flush();
 }
 
 generic<typename T> where T : value class
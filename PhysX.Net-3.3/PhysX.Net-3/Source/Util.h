@@ -40,8 +40,9 @@ namespace PhysX
 			static PrimitiveTypeSize Is16Or32Bit(Type^ type);
 			static Nullable<bool> Is16Or32Bit(Array^ values);
 
-			// Returns an unmanaged stream clone of the data. The caller is responsible for freeing the allocated memory.
-			static PxDefaultMemoryInputData* StreamToUnmanagedInputStream(System::IO::Stream^ stream);
+			// Returns the remaining contents of the stream. Memory streams with an exposable buffer are returned without a copy.
+			// Pin the segment and wrap it in a PxDefaultMemoryInputData to hand it to PhysX.
+			static ArraySegment<Byte> ReadStream(System::IO::Stream^ stream);
 			//static System::IO::MemoryStream^ UnmanagedMemoryStreamToStream(MemoryStream& memoryStream);
 			static void CopyIntoStream(PxDefaultMemoryOutputStream* from, System::IO::Stream^ to);
 
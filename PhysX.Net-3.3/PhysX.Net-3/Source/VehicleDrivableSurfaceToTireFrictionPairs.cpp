@@ -0,0 +1,99 @@
+#include "StdAfx.h"
+#include "VehicleDrivableSurfaceToTireFrictionPairs.h"
+#include "Material.h"
+#include "FailedToCreateObjectException.h"
+
+VehicleDrivableSurfaceToTireFrictionPairs::VehicleDrivableSurfaceToTireFrictionPairs(int maxNumberOfTireTypes, int maxNumberOfSurfaceTypes, IDisposable^ owner)
+{
+	if (maxNumberOfTireTypes <= 0)
+		throw gcnew ArgumentOutOfRangeException("maxNumberOfTireTypes");
+	if (maxNumberOfSurfaceTypes <= 0)
+		throw gcnew ArgumentOutOfRangeException("maxNumberOfSurfaceTypes");
+	ThrowIfNullOrDisposed(owner, "owner");
+
+	_pairs = PxVehicleDrivableSurfaceToTireFrictionPairs::allocate(maxNumberOfTireTypes, maxNumberOfSurfaceTypes);
+
+	if (_pairs == NULL)
+		throw gcnew FailedToCreateObjectException("Failed to allocate the drivable surface to tire friction pairs");
+
+	ObjectTable::Add((intptr_t)_pairs, this, owner);
+}
+VehicleDrivableSurfaceToTireFrictionPairs::~VehicleDrivableSurfaceToTireFrictionPairs()
+{
+	this->!VehicleDrivableSurfaceToTireFrictionPairs();
+}
+VehicleDrivableSurfaceToTireFrictionPairs::!VehicleDrivableSurfaceToTireFrictionPairs()
+{
+	OnDisposing(this, nullptr);
+
+	if (this->Disposed)
+		return;
+
+	_pairs->release();
+	_pairs = NULL;
+
+	OnDisposed(this, nullptr);
+}
+
+bool VehicleDrivableSurfaceToTireFrictionPairs::Disposed::get()
+{
+	return (_pairs == NULL);
+}
+
+void VehicleDrivableSurfaceToTireFrictionPairs::Setup(int numberOfTireTypes, array<Material^>^ drivableSurfaceMaterials, array<int>^ drivableSurfaceTypes)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(drivableSurfaceMaterials, "drivableSurfaceMaterials");
+	ThrowIfNull(drivableSurfaceTypes, "drivableSurfaceTypes");
+
+	if (numberOfTireTypes <= 0 || numberOfTireTypes > this->MaxNumberOfTireTypes)
+		throw gcnew ArgumentOutOfRangeException("numberOfTireTypes", String::Format("The number of tire types must be between 1 and {0}", this->MaxNumberOfTireTypes));
+	if (drivableSurfaceMaterials->Length == 0 || drivableSurfaceMaterials->Length > this->MaxNumberOfSurfaceTypes)
+		throw gcnew ArgumentOutOfRangeException("drivableSurfaceMaterials", String::Format("The number of drivable surfaces must be between 1 and {0}", this->MaxNumberOfSurfaceTypes));
+	if (drivableSurfaceTypes->Length != drivableSurfaceMaterials->Length)
+		throw gcnew ArgumentException("There must be one surface type per drivable surface material", "drivableSurfaceTypes");
+
+	int n = drivableSurfaceMaterials->Length;
+
+	// setup copies both arrays
+	std::vector<const PxMaterial*> materials(n);
+	std::vector<PxVehicleDrivableSurfaceType> types(n);
+
+	for (int i = 0; i < n; i++)
+	{
+		ThrowIfNullOrDisposed(drivableSurfaceMaterials[i], "drivableSurfaceMaterials");
+
+		materials[i] = drivableSurfaceMaterials[i]->UnmanagedPointer;
+		types[i].mType = drivableSurfaceTypes[i];
+	}
+
+	_pairs->setup(numberOfTireTypes, n, &materials[0], &types[0]);
+}
+
+void VehicleDrivableSurfaceToTireFrictionPairs::SetTypePairFriction(int surfaceType, int tireType, float friction)
+{
+	ThrowIfThisDisposed();
+
+	_pairs->setTypePairFriction(surfaceType, tireType, friction);
+}
+float VehicleDrivableSurfaceToTireFrictionPairs::GetTypePairFriction(int surfaceType, int tireType)
+{
+	ThrowIfThisDisposed();
+
+	return _pairs->getTypePairFriction(surfaceType, tireType);
+}
+
+int VehicleDrivableSurfaceToTireFrictionPairs::MaxNumberOfTireTypes::get()
+{
+	return _pairs->getMaxNbTireTypes();
+}
+
+int VehicleDrivableSurfaceToTireFrictionPairs::MaxNumberOfSurfaceTypes::get()
+{
+	return _pairs->getMaxNbSurfaceTypes();
+}
+
+PxVehicleDrivableSurfaceToTireFrictionPairs* VehicleDrivableSurfaceToTireFrictionPairs::UnmanagedPointer::get()
+{
+	return _pairs;
+}
\ No newline at end of file
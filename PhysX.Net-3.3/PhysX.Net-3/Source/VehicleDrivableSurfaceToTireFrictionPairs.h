@@ -0,0 +1,75 @@
+#pragma once
+
+namespace PhysX
+{
+	ref class Material;
+
+	/// <summary>
+	/// Friction for each combination of driving surface type and tire type.
+	/// Drivable surface materials are mapped to integer surface types by Setup, and the friction of each
+	/// surface/tire pair is then set with SetTypePairFriction.
+	/// </summary>
+	public ref class VehicleDrivableSurfaceToTireFrictionPairs : IDisposable
+	{
+	public:
+		/// <summary>Raised before any disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposing;
+		/// <summary>Raised once all disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposed;
+
+	private:
+		PxVehicleDrivableSurfaceToTireFrictionPairs* _pairs;
+
+	internal:
+		VehicleDrivableSurfaceToTireFrictionPairs(int maxNumberOfTireTypes, int maxNumberOfSurfaceTypes, IDisposable^ owner);
+	public:
+		~VehicleDrivableSurfaceToTireFrictionPairs();
+	protected:
+		!VehicleDrivableSurfaceToTireFrictionPairs();
+	public:
+		property bool Disposed
+		{
+			virtual bool get();
+		}
+
+		/// <summary>
+		/// Sets up the mapping between drivable surface materials and surface types.
+		/// Every surface/tire pair friction is reset to 1.
+		/// </summary>
+		/// <param name="numberOfTireTypes">The number of tire types, no more than MaxNumberOfTireTypes.</param>
+		/// <param name="drivableSurfaceMaterials">The materials of the drivable surfaces, no more than MaxNumberOfSurfaceTypes.</param>
+		/// <param name="drivableSurfaceTypes">The surface type of each material in drivableSurfaceMaterials.</param>
+		void Setup(int numberOfTireTypes, array<Material^>^ drivableSurfaceMaterials, array<int>^ drivableSurfaceTypes);
+
+		/// <summary>
+		/// Sets the friction of a surface type and tire type combination.
+		/// </summary>
+		void SetTypePairFriction(int surfaceType, int tireType, float friction);
+		/// <summary>
+		/// Gets the friction of a surface type and tire type combination.
+		/// </summary>
+		float GetTypePairFriction(int surfaceType, int tireType);
+
+		/// <summary>
+		/// Gets the maximum number of tire types.
+		/// </summary>
+		property int MaxNumberOfTireTypes
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the maximum number of surface types.
+		/// </summary>
+		property int MaxNumberOfSurfaceTypes
+		{
+			int get();
+		}
+
+	internal:
+		property PxVehicleDrivableSurfaceToTireFrictionPairs* UnmanagedPointer
+		{
+			PxVehicleDrivableSurfaceToTireFrictionPairs* get();
+		}
+	};
+};
\ No newline at end of file
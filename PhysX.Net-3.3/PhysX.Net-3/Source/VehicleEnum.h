@@ -68,4 +68,59 @@ namespace PhysX
 		NegativeY = 1,
 		NegativeZ = 2
 	};
+
+	/// <summary>
+	/// The values a VehicleTelemetryRecorder samples. Wheel channels are recorded for each wheel.
+	/// </summary>
+	[Flags]
+	public enum class VehicleTelemetryChannel
+	{
+		None = 0,
+
+		/// <summary>Speed of the vehicle along its forward vector.</summary>
+		ForwardSpeed = 1 << 0,
+		/// <summary>Speed of the vehicle along its sideways vector.</summary>
+		SidewaysSpeed = 1 << 1,
+		/// <summary>Rotation speed of the engine in radians per second. Not a number for vehicles without a drive.</summary>
+		EngineRotationSpeed = 1 << 2,
+		/// <summary>The current gear. Not a number for vehicles without a drive.</summary>
+		Gear = 1 << 3,
+
+		/// <summary>Rotation speed of the wheel in radians per second.</summary>
+		WheelRotationSpeed = 1 << 8,
+		/// <summary>Longitudinal slip of the tire.</summary>
+		LongitudinalSlip = 1 << 9,
+		/// <summary>Lateral slip of the tire.</summary>
+		LateralSlip = 1 << 10,
+		/// <summary>Compression of the suspension spring.</summary>
+		SuspensionJounce = 1 << 11,
+		/// <summary>Force applied by the suspension spring.</summary>
+		SuspensionSpringForce = 1 << 12,
+		/// <summary>Friction between the tire and the drivable surface.</summary>
+		TireFriction = 1 << 13,
+		/// <summary>Steer angle of the wheel.</summary>
+		SteerAngle = 1 << 14,
+
+		VehicleChannels = ForwardSpeed | SidewaysSpeed | EngineRotationSpeed | Gear,
+		WheelChannels = WheelRotationSpeed | LongitudinalSlip | LateralSlip | SuspensionJounce | SuspensionSpringForce | TireFriction | SteerAngle
+	};
+
+	/// <summary>
+	/// The native tire force models that can be used as the tire force shader of a vehicle.
+	/// </summary>
+	public enum class VehicleTireModel
+	{
+		/// <summary>
+		/// The PhysX default tire model, parameterized by VehicleDefaultTireParameters.
+		/// </summary>
+		Default = 0,
+		/// <summary>
+		/// Pacejka's Magic Formula, parameterized by VehiclePacejkaTireParameters.
+		/// </summary>
+		Pacejka = 1,
+		/// <summary>
+		/// The brush model, parameterized by VehicleBrushTireParameters.
+		/// </summary>
+		Brush = 2
+	};
 };
\ No newline at end of file
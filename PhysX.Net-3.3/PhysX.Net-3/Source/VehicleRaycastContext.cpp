@@ -0,0 +1,227 @@
+#include "StdAfx.h"
+#include "VehicleRaycastContext.h"
+#include "Scene.h"
+#include "Shape.h"
+#include "VehicleWheels.h"
+#include "FailedToCreateObjectException.h"
+
+#pragma managed(push, off)
+// Called by PhysX for every shape a suspension line overlaps, so keep it native
+static PxQueryHitType::Enum DrivableSurfacePreFilter(PxFilterData queryFilterData, PxFilterData objectFilterData, const void* constantBlock, PxU32 constantBlockSize, PxHitFlags& hitFlags)
+{
+	PxU32 drivableSurfaceMask = *(const PxU32*)constantBlock;
+
+	return (objectFilterData.word3 & drivableSurfaceMask) == 0 ? PxQueryHitType::eNONE : PxQueryHitType::eBLOCK;
+}
+#pragma managed(pop)
+
+VehicleRaycastContext::VehicleRaycastContext(PhysX::Scene^ scene, int maxNumberOfWheels, [Optional] Nullable<int> drivableSurfaceMask)
+{
+	ThrowIfNullOrDisposed(scene, "scene");
+	if (maxNumberOfWheels <= 0)
+		throw gcnew ArgumentOutOfRangeException("maxNumberOfWheels");
+
+	_scene = scene;
+	_maxNumberOfWheels = maxNumberOfWheels;
+
+	_results = new PxRaycastQueryResult[maxNumberOfWheels];
+	_hits = new PxRaycastHit[maxNumberOfWheels];
+
+	// One raycast per wheel, written straight into our buffers
+	PxBatchQueryDesc desc(maxNumberOfWheels, 0, 0);
+	desc.queryMemory.userRaycastResultBuffer = _results;
+	desc.queryMemory.userRaycastTouchBuffer = _hits;
+	desc.queryMemory.raycastTouchBufferSize = maxNumberOfWheels;
+
+	PxU32 mask;
+	if (drivableSurfaceMask.HasValue)
+	{
+		// The filter shader data is copied by the batch query
+		mask = (PxU32)drivableSurfaceMask.Value;
+
+		desc.preFilterShader = DrivableSurfacePreFilter;
+		desc.filterShaderData = &mask;
+		desc.filterShaderDataSize = sizeof(PxU32);
+	}
+
+	_batchQuery = scene->UnmanagedPointer->createBatchQuery(desc);
+
+	if (_batchQuery == NULL)
+	{
+		delete[] _results;
+		delete[] _hits;
+
+		throw gcnew FailedToCreateObjectException("Failed to create the suspension raycast batch query");
+	}
+
+	_vehicles = new std::vector<PxVehicleWheels*>();
+	_firstResult = new std::vector<int>();
+	_wasRaycast = new std::vector<bool>();
+	_vehicleCount = 0;
+	_resultCount = 0;
+
+	ObjectTable::AddObjectOwner(this, scene);
+}
+VehicleRaycastContext::~VehicleRaycastContext()
+{
+	this->!VehicleRaycastContext();
+}
+VehicleRaycastContext::!VehicleRaycastContext()
+{
+	OnDisposing(this, nullptr);
+
+	if (this->Disposed)
+		return;
+
+	_batchQuery->release();
+	_batchQuery = NULL;
+
+	delete[] _results;
+	delete[] _hits;
+	_results = NULL;
+	_hits = NULL;
+
+	SAFE_DELETE(_vehicles);
+	SAFE_DELETE(_firstResult);
+	SAFE_DELETE(_wasRaycast);
+	_vehicleCount = 0;
+	_resultCount = 0;
+
+	_scene = nullptr;
+
+	OnDisposed(this, nullptr);
+}
+bool VehicleRaycastContext::Disposed::get()
+{
+	return (_scene == nullptr);
+}
+
+void VehicleRaycastContext::Raycast(array<VehicleWheels^>^ vehicles, [Optional] array<bool>^ vehiclesToRaycast)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(vehicles, "vehicles");
+	if (vehiclesToRaycast != nullptr && vehiclesToRaycast->Length < vehicles->Length)
+		throw gcnew ArgumentException("There must be an entry for each vehicle", "vehiclesToRaycast");
+
+	int n = vehicles->Length;
+
+	// The buffers only ever grow, so steady state raycasts don't allocate
+	if ((int)_vehicles->size() < n)
+	{
+		_vehicles->resize(n);
+		_firstResult->resize(n);
+		_wasRaycast->resize(n);
+	}
+
+	// PxVehicleSuspensionRaycasts lays out a result for every wheel of every vehicle, skipped or not
+	int wheelCount = 0;
+	int resultCount = 0;
+	for (int i = 0; i < n; i++)
+	{
+		ThrowIfNullOrDisposed(vehicles[i], "vehicles");
+
+		PxVehicleWheels* v = vehicles[i]->UnmanagedPointer;
+		int wheels = v->mWheelsSimData.getNbWheels();
+		bool raycast = (vehiclesToRaycast == nullptr || vehiclesToRaycast[i]);
+
+		(*_vehicles)[i] = v;
+		(*_firstResult)[i] = wheelCount;
+		(*_wasRaycast)[i] = raycast;
+
+		wheelCount += wheels;
+		if (raycast)
+			resultCount += wheels;
+	}
+
+	if (wheelCount > _maxNumberOfWheels)
+		throw gcnew ArgumentException(String::Format("The vehicles have {0} wheels, but the context was created for at most {1}", wheelCount, _maxNumberOfWheels), "vehicles");
+
+	_vehicleCount = n;
+	_resultCount = resultCount;
+
+	if (n == 0)
+		return;
+
+	// A managed bool array has the same layout as a native one, so it's read in place
+	pin_ptr<bool> toRaycast = nullptr;
+	if (vehiclesToRaycast != nullptr)
+		toRaycast = &vehiclesToRaycast[0];
+
+	PxVehicleSuspensionRaycasts(_batchQuery, n, &(*_vehicles)[0], _maxNumberOfWheels, _results, (const bool*)toRaycast);
+}
+
+bool VehicleRaycastContext::WasRaycast(int vehicleIndex)
+{
+	ThrowIfThisDisposed();
+
+	if (vehicleIndex < 0 || vehicleIndex >= _vehicleCount)
+		throw gcnew ArgumentOutOfRangeException("vehicleIndex");
+
+	return (*_wasRaycast)[vehicleIndex];
+}
+
+const PxRaycastQueryResult& VehicleRaycastContext::GetUnmanagedResult(int vehicleIndex, int wheelIndex)
+{
+	if (!WasRaycast(vehicleIndex))
+		throw gcnew InvalidOperationException("The vehicle was not raycast by the last call");
+
+	if (wheelIndex < 0 || wheelIndex >= (int)(*_vehicles)[vehicleIndex]->mWheelsSimData.getNbWheels())
+		throw gcnew ArgumentOutOfRangeException("wheelIndex");
+
+	return _results[(*_firstResult)[vehicleIndex] + wheelIndex];
+}
+
+VehicleSuspensionRaycastHit VehicleRaycastContext::GetResult(int vehicleIndex, int wheelIndex)
+{
+	return VehicleSuspensionRaycastHit::ToManaged(GetUnmanagedResult(vehicleIndex, wheelIndex));
+}
+
+int VehicleRaycastContext::GetResults(array<VehicleSuspensionRaycastHit>^ results, int offset)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(results, "results");
+	if (offset < 0 || offset + _resultCount > results->Length)
+		throw gcnew ArgumentOutOfRangeException("offset", "The results array is too small for the results from the offset");
+
+	int count = 0;
+	for (int i = 0; i < _vehicleCount; i++)
+	{
+		if (!(*_wasRaycast)[i])
+			continue;
+
+		int first = (*_firstResult)[i];
+		int wheels = (*_vehicles)[i]->mWheelsSimData.getNbWheels();
+
+		for (int w = 0; w < wheels; w++)
+			results[offset + count++] = VehicleSuspensionRaycastHit::ToManaged(_results[first + w]);
+	}
+
+	return count;
+}
+
+Shape^ VehicleRaycastContext::GetHitShape(int vehicleIndex, int wheelIndex)
+{
+	const PxRaycastQueryResult& result = GetUnmanagedResult(vehicleIndex, wheelIndex);
+
+	if (!result.hasBlock)
+		return nullptr;
+
+	return ObjectTable::GetObject<Shape^>((intptr_t)result.block.shape);
+}
+
+//
+
+PhysX::Scene^ VehicleRaycastContext::Scene::get()
+{
+	return _scene;
+}
+
+int VehicleRaycastContext::MaxNumberOfWheels::get()
+{
+	return _maxNumberOfWheels;
+}
+
+int VehicleRaycastContext::ResultCount::get()
+{
+	return _resultCount;
+}
\ No newline at end of file
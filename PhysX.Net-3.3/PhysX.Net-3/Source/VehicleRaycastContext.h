@@ -0,0 +1,123 @@
+#pragma once
+
+#include "VehicleSuspensionRaycastHit.h"
+
+namespace PhysX
+{
+	ref class Scene;
+	ref class Shape;
+	ref class VehicleWheels;
+
+	/// <summary>
+	/// Performs the suspension raycasts of a set of vehicles with PxVehicleSuspensionRaycasts.
+	/// The batch query and its result and hit buffers are created once for a maximum number of wheels and reused
+	/// every frame, and must be kept alive until the vehicles have been updated.
+	/// </summary>
+	/// <remarks>
+	/// Results are stored per wheel in the order of the vehicles passed to the last Raycast call. PhysX reserves a
+	/// result for every wheel of every vehicle passed, so vehicles that are skipped still count towards
+	/// MaxNumberOfWheels, but have no results.
+	/// </remarks>
+	public ref class VehicleRaycastContext : IDisposable
+	{
+	public:
+		/// <summary>Raised before any disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposing;
+		/// <summary>Raised once all disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposed;
+
+	private:
+		Scene^ _scene;
+		int _maxNumberOfWheels;
+
+		PxBatchQuery* _batchQuery;
+		PxRaycastQueryResult* _results;
+		PxRaycastHit* _hits;
+
+		std::vector<PxVehicleWheels*>* _vehicles;
+		// The index of the first result of each vehicle, whether or not it was raycast
+		std::vector<int>* _firstResult;
+		std::vector<bool>* _wasRaycast;
+		int _vehicleCount;
+		int _resultCount;
+
+	public:
+		/// <summary>
+		/// Creates a suspension raycast context.
+		/// </summary>
+		/// <param name="scene">The scene the vehicles are in.</param>
+		/// <param name="maxNumberOfWheels">The maximum total number of wheels raycast in one call.</param>
+		/// <param name="drivableSurfaceMask">
+		/// If set, a raycast only hits shapes whose query filter data word 3 shares a bit with the mask, so wheels don't hit
+		/// their own (or other vehicles') chassis. If not set, every shape is drivable.
+		/// </param>
+		VehicleRaycastContext(PhysX::Scene^ scene, int maxNumberOfWheels, [Optional] Nullable<int> drivableSurfaceMask);
+		~VehicleRaycastContext();
+	protected:
+		!VehicleRaycastContext();
+	public:
+		property bool Disposed
+		{
+			virtual bool get();
+		}
+
+		/// <summary>
+		/// Raycasts the suspension lines of the vehicles.
+		/// </summary>
+		/// <param name="vehicles">
+		/// The vehicles to raycast. Their total number of wheels, including those of skipped vehicles, must not exceed MaxNumberOfWheels.
+		/// </param>
+		/// <param name="vehiclesToRaycast">Optionally, whether to raycast each vehicle. Vehicles that are skipped keep their previous suspension state.</param>
+		void Raycast(array<VehicleWheels^>^ vehicles, [Optional] array<bool>^ vehiclesToRaycast);
+
+		/// <summary>
+		/// Gets whether a vehicle was raycast by the last call.
+		/// </summary>
+		bool WasRaycast(int vehicleIndex);
+
+		/// <summary>
+		/// Gets the result of a wheel of a vehicle from the last call.
+		/// </summary>
+		VehicleSuspensionRaycastHit GetResult(int vehicleIndex, int wheelIndex);
+
+		/// <summary>
+		/// Copies the results of every raycast wheel from the last call, in vehicle and then wheel order.
+		/// </summary>
+		/// <param name="results">The array to copy the results into.</param>
+		/// <param name="offset">The index in results to copy the first result to.</param>
+		/// <returns>The number of results copied, which is ResultCount.</returns>
+		int GetResults(array<VehicleSuspensionRaycastHit>^ results, int offset);
+
+		/// <summary>
+		/// Gets the shape hit by the suspension raycast of a wheel, or null if nothing was hit.
+		/// </summary>
+		Shape^ GetHitShape(int vehicleIndex, int wheelIndex);
+
+		/// <summary>
+		/// Gets the scene the vehicles are in.
+		/// </summary>
+		property PhysX::Scene^ Scene
+		{
+			PhysX::Scene^ get();
+		}
+
+		/// <summary>
+		/// Gets the maximum total number of wheels raycast in one call.
+		/// </summary>
+		property int MaxNumberOfWheels
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of wheels raycast by the last call.
+		/// </summary>
+		property int ResultCount
+		{
+			int get();
+		}
+
+	private:
+		const PxRaycastQueryResult& GetUnmanagedResult(int vehicleIndex, int wheelIndex);
+	};
+};
\ No newline at end of file
@@ -110,18 +110,13 @@ void VehicleSDK::VehicleSuspensionRaycasts(BatchQuery^ batchQuery, array<Vehicle
 
 	for (int i = 0; i < sceneQueryResults->Length; i++)
 	{
-		delete r[i].touches;
+		delete[] r[i].touches;
 	}
 
 	delete[] r;
 	delete[] v;
 }
 
-//void VehicleSDK::VehiclePostUpdates(VehicleConcurrentUpdateData^ concurrentUpdateData, array<VehicleWheels^>^ vehicles)
-//{
-//
-//}
-
 VehicleWheels^ VehicleSDK::VehicleUpdateCMassLocalPose(Matrix oldCMassLocalPose, Matrix newCMassLocalPose, VehicleGravityDirection gravityDirection, VehicleWheels^ vehicle)
 {
 	ThrowIfNullOrDisposed(vehicle, "vehicle");
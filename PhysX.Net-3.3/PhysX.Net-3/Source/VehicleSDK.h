@@ -103,12 +103,13 @@ namespace PhysX
 
 		void VehicleSetBasisVectors(Vector3 up, Vector3 forward);
 
-		// TODO: Add vehiclesToRaycast arg
+		/// <summary>
+		/// Raycasts the suspension lines of the vehicles. Use a VehicleRaycastContext to raycast every frame without
+		/// allocating, or to raycast only some of the vehicles.
+		/// </summary>
 		void VehicleSuspensionRaycasts(BatchQuery^ batchQuery, array<VehicleWheels^>^ vehicles, array<RaycastQueryResult^>^ sceneQueryResults);
-		
-		//void PxVehicleUpdates(float timestep, Vector3 gravity, VehicleDrivableSurfaceToTireFrictionPairs vehicleDrivableSurfaceToTireFrictionPairs, int numVehicles, array<VehicleWheels^>^ vehicles);
 
-		//void VehiclePostUpdates(VehicleConcurrentUpdateData^ concurrentUpdateData, array<VehicleWheels^>^ vehicles);
+		// PxVehicleUpdates and PxVehiclePostUpdates are wrapped by VehicleUpdater, which owns the buffers they need
 
 		/// <summary>
 		/// Reconfigure the vehicle to reflect a new center of mass local pose that has been applied to the actor.
@@ -0,0 +1,18 @@
+#include "StdAfx.h"
+#include "VehicleSuspensionRaycastHit.h"
+
+VehicleSuspensionRaycastHit VehicleSuspensionRaycastHit::ToManaged(const PxRaycastQueryResult& result)
+{
+	VehicleSuspensionRaycastHit hit;
+
+	hit.HasBlock = result.hasBlock;
+
+	if (result.hasBlock)
+	{
+		hit.Position = MV(result.block.position);
+		hit.Normal = MV(result.block.normal);
+		hit.Distance = result.block.distance;
+	}
+
+	return hit;
+}
\ No newline at end of file
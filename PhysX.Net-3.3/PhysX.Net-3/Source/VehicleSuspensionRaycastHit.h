@@ -0,0 +1,34 @@
+#pragma once
+
+namespace PhysX
+{
+	/// <summary>
+	/// The result of the suspension raycast of a single wheel.
+	/// </summary>
+	public value class VehicleSuspensionRaycastHit
+	{
+	internal:
+		static VehicleSuspensionRaycastHit ToManaged(const PxRaycastQueryResult& result);
+
+	public:
+		/// <summary>
+		/// Gets or sets whether the raycast hit a drivable surface. If false, the other fields are undefined.
+		/// </summary>
+		property bool HasBlock;
+
+		/// <summary>
+		/// World-space hit point on the drivable surface.
+		/// </summary>
+		property Vector3 Position;
+
+		/// <summary>
+		/// World-space normal of the drivable surface at the hit point.
+		/// </summary>
+		property Vector3 Normal;
+
+		/// <summary>
+		/// Distance along the suspension line to the hit point.
+		/// </summary>
+		property float Distance;
+	};
+};
\ No newline at end of file
@@ -0,0 +1,403 @@
+#include "StdAfx.h"
+#include "VehicleTelemetryRecorder.h"
+#include "VehicleWheels.h"
+#include "StreamOutputStream.h"
+
+using namespace System::IO;
+using namespace System::Globalization;
+
+// Bit positions of the VehicleTelemetryChannel values, in record order
+static const int VehicleChannelBits[] = { 0, 1, 2, 3 };
+static const int WheelChannelBits[] = { 8, 9, 10, 11, 12, 13, 14 };
+
+static int CountChannels(int channels, const int* bits, int n)
+{
+	int count = 0;
+	for (int i = 0; i < n; i++)
+	{
+		if (channels & (1 << bits[i]))
+			count++;
+	}
+
+	return count;
+}
+
+VehicleTelemetryRecorder::VehicleTelemetryRecorder(VehicleTelemetryChannel channels, int capacity, [Optional] int maxNumberOfWheels)
+{
+	if (capacity <= 0)
+		throw gcnew ArgumentOutOfRangeException("capacity", "Capacity must be greater than zero");
+
+	_channels = channels;
+	_capacity = capacity;
+	_maxNumberOfWheels = (maxNumberOfWheels <= 0 ? 4 : maxNumberOfWheels);
+
+	_vehicleChannelCount = CountChannels((int)channels, VehicleChannelBits, ARRAYSIZE(VehicleChannelBits));
+	_wheelChannelCount = CountChannels((int)channels, WheelChannelBits, ARRAYSIZE(WheelChannelBits));
+
+	// Time and slot, then the vehicle channels, then the wheel channels for each wheel
+	_recordSize = 2 + _vehicleChannelCount + _wheelChannelCount * _maxNumberOfWheels;
+
+	_records = new float[(size_t)(_recordSize - 1) * _capacity];
+	_times = new double[_capacity];
+	_next = 0;
+	_count = 0;
+	_time = 0;
+
+	_watched = new std::vector<PxVehicleWheels*>();
+	_watchedVehicles = gcnew List<VehicleWheels^>();
+}
+VehicleTelemetryRecorder::~VehicleTelemetryRecorder()
+{
+	this->!VehicleTelemetryRecorder();
+}
+VehicleTelemetryRecorder::!VehicleTelemetryRecorder()
+{
+	OnDisposing(this, nullptr);
+
+	if (this->Disposed)
+		return;
+
+	for each(VehicleWheels^ vehicle in _watchedVehicles)
+	{
+		if (vehicle != nullptr)
+			vehicle->OnDisposed -= gcnew EventHandler(this, &VehicleTelemetryRecorder::OnVehicleDisposed);
+	}
+	_watchedVehicles = nullptr;
+
+	delete[] _records;
+	delete[] _times;
+	_records = NULL;
+	_times = NULL;
+
+	SAFE_DELETE(_watched);
+
+	_next = 0;
+	_count = 0;
+
+	OnDisposed(this, nullptr);
+}
+bool VehicleTelemetryRecorder::Disposed::get()
+{
+	return (_records == NULL);
+}
+
+int VehicleTelemetryRecorder::AddVehicle(VehicleWheels^ vehicle)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNullOrDisposed(vehicle, "vehicle");
+
+	PxVehicleWheels* v = vehicle->UnmanagedPointer;
+
+	for (size_t i = 0; i < _watched->size(); i++)
+	{
+		if ((*_watched)[i] == v)
+			return (int)i;
+	}
+
+	vehicle->OnDisposed += gcnew EventHandler(this, &VehicleTelemetryRecorder::OnVehicleDisposed);
+
+	// Reuse the slot of a removed vehicle
+	for (size_t i = 0; i < _watched->size(); i++)
+	{
+		if ((*_watched)[i] == NULL)
+		{
+			(*_watched)[i] = v;
+			_watchedVehicles[(int)i] = vehicle;
+			return (int)i;
+		}
+	}
+
+	_watched->push_back(v);
+	_watchedVehicles->Add(vehicle);
+
+	return (int)_watched->size() - 1;
+}
+bool VehicleTelemetryRecorder::RemoveVehicle(VehicleWheels^ vehicle)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(vehicle, "vehicle");
+
+	int slot = _watchedVehicles->IndexOf(vehicle);
+	if (slot == -1)
+		return false;
+
+	vehicle->OnDisposed -= gcnew EventHandler(this, &VehicleTelemetryRecorder::OnVehicleDisposed);
+
+	// Keep the slots of the other vehicles stable
+	(*_watched)[slot] = NULL;
+	_watchedVehicles[slot] = nullptr;
+
+	return true;
+}
+
+void VehicleTelemetryRecorder::OnVehicleDisposed(Object^ sender, EventArgs^ e)
+{
+	// The native vehicle is gone, so stop matching its pointer, which PhysX may hand out again
+	if (!this->Disposed)
+		RemoveVehicle((VehicleWheels^)sender);
+}
+
+void VehicleTelemetryRecorder::Clear()
+{
+	ThrowIfThisDisposed();
+
+	_next = 0;
+	_count = 0;
+	_time = 0;
+}
+
+void VehicleTelemetryRecorder::Record(float timestep, PxVehicleWheels* const* vehicles, const PxVehicleWheelQueryResult* results, int count)
+{
+	if (this->Disposed)
+		return;
+
+	_time += timestep;
+
+	int watchedCount = (int)_watched->size();
+	if (watchedCount == 0)
+		return;
+
+	// The watched set is meant to be a small sample, so a linear search per vehicle is cheaper than a map
+	for (int i = 0; i < count; i++)
+	{
+		for (int slot = 0; slot < watchedCount; slot++)
+		{
+			if ((*_watched)[slot] != vehicles[i])
+				continue;
+
+			float* record = _records + (size_t)_next * (_recordSize - 1);
+
+			_times[_next] = _time;
+			record[0] = (float)slot;
+
+			RecordVehicle(record + 1, vehicles[i], results[i]);
+
+			_next = (_next + 1) % _capacity;
+			if (_count < _capacity)
+				_count++;
+
+			break;
+		}
+	}
+}
+
+void VehicleTelemetryRecorder::RecordVehicle(float* record, PxVehicleWheels* vehicle, const PxVehicleWheelQueryResult& result)
+{
+	const float nan = Single::NaN;
+	int channels = (int)_channels;
+
+	PxVehicleDrive* drive = NULL;
+	if (vehicle->getVehicleType() != PxVehicleTypes::eNODRIVE)
+		drive = static_cast<PxVehicleDrive*>(vehicle);
+
+	if (channels & (int)VehicleTelemetryChannel::ForwardSpeed)
+		*record++ = vehicle->computeForwardSpeed();
+	if (channels & (int)VehicleTelemetryChannel::SidewaysSpeed)
+		*record++ = vehicle->computeSidewaysSpeed();
+	if (channels & (int)VehicleTelemetryChannel::EngineRotationSpeed)
+		*record++ = (drive != NULL ? drive->mDriveDynData.getEngineRotationSpeed() : nan);
+	if (channels & (int)VehicleTelemetryChannel::Gear)
+		*record++ = (drive != NULL ? (float)drive->mDriveDynData.getCurrentGear() : nan);
+
+	if (_wheelChannelCount == 0)
+		return;
+
+	int wheels = PxMin((int)result.nbWheelQueryResults, _maxNumberOfWheels);
+
+	for (int w = 0; w < wheels; w++)
+	{
+		const PxWheelQueryResult& r = result.wheelQueryResults[w];
+
+		if (channels & (int)VehicleTelemetryChannel::WheelRotationSpeed)
+			*record++ = vehicle->mWheelsDynData.getWheelRotationSpeed(w);
+		if (channels & (int)VehicleTelemetryChannel::LongitudinalSlip)
+			*record++ = r.longitudinalSlip;
+		if (channels & (int)VehicleTelemetryChannel::LateralSlip)
+			*record++ = r.lateralSlip;
+		if (channels & (int)VehicleTelemetryChannel::SuspensionJounce)
+			*record++ = r.suspJounce;
+		if (channels & (int)VehicleTelemetryChannel::SuspensionSpringForce)
+			*record++ = r.suspSpringForce;
+		if (channels & (int)VehicleTelemetryChannel::TireFriction)
+			*record++ = r.tireFriction;
+		if (channels & (int)VehicleTelemetryChannel::SteerAngle)
+			*record++ = r.steerAngle;
+	}
+
+	for (int i = wheels * _wheelChannelCount; i < _maxNumberOfWheels * _wheelChannelCount; i++)
+	{
+		*record++ = nan;
+	}
+}
+
+int VehicleTelemetryRecorder::GetRecordIndex(int index)
+{
+	// Once the buffer has wrapped, the oldest record is the one about to be overwritten
+	int start = (_count < _capacity ? 0 : _next);
+
+	return (start + index) % _capacity;
+}
+
+array<float>^ VehicleTelemetryRecorder::GetRecord(int index)
+{
+	ThrowIfThisDisposed();
+
+	if (index < 0 || index >= _count)
+		throw gcnew ArgumentOutOfRangeException("index");
+
+	int r = GetRecordIndex(index);
+
+	auto values = gcnew array<float>(_recordSize);
+	pin_ptr<float> v = &values[0];
+
+	v[0] = (float)_times[r];
+	memcpy(v + 1, _records + (size_t)r * (_recordSize - 1), sizeof(float) * (_recordSize - 1));
+
+	return values;
+}
+double VehicleTelemetryRecorder::GetRecordTime(int index)
+{
+	ThrowIfThisDisposed();
+
+	if (index < 0 || index >= _count)
+		throw gcnew ArgumentOutOfRangeException("index");
+
+	return _times[GetRecordIndex(index)];
+}
+
+array<String^>^ VehicleTelemetryRecorder::GetColumnNames()
+{
+	ThrowIfThisDisposed();
+
+	auto names = gcnew List<String^>(_recordSize);
+
+	names->Add("Time");
+	names->Add("Vehicle");
+
+	for (int i = 0; i < ARRAYSIZE(VehicleChannelBits); i++)
+	{
+		auto channel = (VehicleTelemetryChannel)(1 << VehicleChannelBits[i]);
+
+		if (_channels.HasFlag(channel))
+			names->Add(channel.ToString());
+	}
+
+	for (int w = 0; w < _maxNumberOfWheels; w++)
+	{
+		for (int i = 0; i < ARRAYSIZE(WheelChannelBits); i++)
+		{
+			auto channel = (VehicleTelemetryChannel)(1 << WheelChannelBits[i]);
+
+			if (_channels.HasFlag(channel))
+				names->Add(String::Format("{0}{1}", channel, w));
+		}
+	}
+
+	return names->ToArray();
+}
+
+void VehicleTelemetryRecorder::SaveBinary(Stream^ stream)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(stream, "stream");
+
+	StreamOutputStream out(stream);
+
+	PxI32 header[] = { BinaryMagic, BinaryVersion, (PxI32)_channels, _maxNumberOfWheels, _recordSize, _count };
+	out.write(header, sizeof(header));
+
+	// Each record is its time followed by its values, the stream buffers the small writes into chunks
+	PxU32 valuesSize = (PxU32)(sizeof(float) * (_recordSize - 1));
+
+	for (int i = 0; i < _count; i++)
+	{
+		int r = GetRecordIndex(i);
+
+		out.write(&_times[r], sizeof(double));
+		out.write(_records + (size_t)r * (_recordSize - 1), valuesSize);
+	}
+
+	out.flush();
+}
+
+void VehicleTelemetryRecorder::SaveCsv(Stream^ stream)
+{
+	ThrowIfThisDisposed();
+	ThrowIfNull(stream, "stream");
+
+	auto writer = gcnew StreamWriter(stream, gcnew System::Text::UTF8Encoding(false), 64 * 1024, true);
+
+	try
+	{
+		writer->WriteLine(String::Join(",", GetColumnNames()));
+
+		for (int i = 0; i < _count; i++)
+		{
+			int r = GetRecordIndex(i);
+			const float* record = _records + (size_t)r * (_recordSize - 1);
+
+			writer->Write(_times[r].ToString("R", CultureInfo::InvariantCulture));
+
+			for (int j = 0; j < _recordSize - 1; j++)
+			{
+				writer->Write(',');
+
+				// NaN is written as an empty field
+				if (!Single::IsNaN(record[j]))
+					writer->Write(record[j].ToString("R", CultureInfo::InvariantCulture));
+			}
+
+			writer->WriteLine();
+		}
+	}
+	finally
+	{
+		delete writer;
+	}
+}
+
+//
+
+VehicleTelemetryChannel VehicleTelemetryRecorder::Channels::get()
+{
+	return _channels;
+}
+
+int VehicleTelemetryRecorder::Capacity::get()
+{
+	return _capacity;
+}
+
+int VehicleTelemetryRecorder::MaxNumberOfWheels::get()
+{
+	return _maxNumberOfWheels;
+}
+
+int VehicleTelemetryRecorder::RecordSize::get()
+{
+	return _recordSize;
+}
+
+int VehicleTelemetryRecorder::Count::get()
+{
+	return _count;
+}
+
+int VehicleTelemetryRecorder::VehicleCount::get()
+{
+	ThrowIfThisDisposed();
+
+	int n = 0;
+	for (size_t i = 0; i < _watched->size(); i++)
+	{
+		if ((*_watched)[i] != NULL)
+			n++;
+	}
+
+	return n;
+}
+
+double VehicleTelemetryRecorder::Time::get()
+{
+	return _time;
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "VehicleEnum.h"
+
+namespace PhysX
+{
+	ref class VehicleWheels;
+
+	/// <summary>
+	/// Records selected channels of a sample of vehicles into a fixed size ring buffer each time a VehicleUpdater
+	/// steps them, for offline tuning. Recording doesn't allocate, once the buffer is full the oldest records are overwritten.
+	/// </summary>
+	/// <remarks>
+	/// Each record holds the recorder time (kept as a double, see GetRecordTime), the slot of the vehicle (in the order vehicles were added), the selected vehicle
+	/// channels and then the selected wheel channels for each of MaxNumberOfWheels wheels. Values that aren't available,
+	/// such as the gear of a vehicle without a drive or wheels a vehicle doesn't have, are recorded as NaN.
+	/// </remarks>
+	public ref class VehicleTelemetryRecorder : IDisposable
+	{
+	public:
+		/// <summary>Raised before any disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposing;
+		/// <summary>Raised once all disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposed;
+
+		/// <summary>
+		/// The first four bytes of a binary export, "PXVT".
+		/// </summary>
+		literal int BinaryMagic = 0x54565850;
+		/// <summary>
+		/// The version of the binary export format.
+		/// </summary>
+		literal int BinaryVersion = 2;
+
+	private:
+		VehicleTelemetryChannel _channels;
+		int _capacity;
+		int _maxNumberOfWheels;
+		int _vehicleChannelCount;
+		int _wheelChannelCount;
+		int _recordSize;
+
+		// The slot and channel values of each record, RecordSize - 1 floats per record
+		float* _records;
+		// The time of each record, kept apart so it doesn't lose precision over long sessions
+		double* _times;
+		int _next;
+		int _count;
+		double _time;
+
+		// Read natively by Record, with the managed vehicles alongside to stop watching them when they are disposed
+		std::vector<PxVehicleWheels*>* _watched;
+		List<VehicleWheels^>^ _watchedVehicles;
+
+	public:
+		/// <summary>
+		/// Creates a telemetry recorder.
+		/// </summary>
+		/// <param name="channels">The channels to record.</param>
+		/// <param name="capacity">The number of records the ring buffer holds.</param>
+		/// <param name="maxNumberOfWheels">The number of wheels recorded per vehicle. If zero or less, 4 is used.</param>
+		VehicleTelemetryRecorder(VehicleTelemetryChannel channels, int capacity, [Optional] int maxNumberOfWheels);
+		~VehicleTelemetryRecorder();
+	protected:
+		!VehicleTelemetryRecorder();
+	public:
+		property bool Disposed
+		{
+			virtual bool get();
+		}
+
+		/// <summary>
+		/// Starts recording a vehicle. Returns the slot the vehicle's records are tagged with.
+		/// </summary>
+		int AddVehicle(VehicleWheels^ vehicle);
+		/// <summary>
+		/// Stops recording a vehicle. Records already in the buffer are kept.
+		/// Disposed vehicles are removed automatically.
+		/// </summary>
+		bool RemoveVehicle(VehicleWheels^ vehicle);
+
+		/// <summary>
+		/// Discards all records and resets the time to zero.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Gets the names of the values in each record, in order.
+		/// </summary>
+		array<String^>^ GetColumnNames();
+
+		/// <summary>
+		/// Gets the values of a record, where index 0 is the oldest record in the buffer.
+		/// The time is rounded to a float, use GetRecordTime for the exact value.
+		/// </summary>
+		array<float>^ GetRecord(int index);
+		/// <summary>
+		/// Gets the time of a record, where index 0 is the oldest record in the buffer.
+		/// </summary>
+		double GetRecordTime(int index);
+
+		/// <summary>
+		/// Writes the records, oldest first, in the compact binary format.
+		/// The header is BinaryMagic, BinaryVersion, Channels, MaxNumberOfWheels, RecordSize and Count as 32 bit integers,
+		/// followed by Count records, each a 64 bit float time and then RecordSize - 1 32 bit floats.
+		/// </summary>
+		void SaveBinary(System::IO::Stream^ stream);
+		/// <summary>
+		/// Writes the records, oldest first, as CSV with a header row of the column names.
+		/// </summary>
+		void SaveCsv(System::IO::Stream^ stream);
+
+		/// <summary>
+		/// Gets the channels recorded.
+		/// </summary>
+		property VehicleTelemetryChannel Channels
+		{
+			VehicleTelemetryChannel get();
+		}
+
+		/// <summary>
+		/// Gets the number of records the ring buffer holds.
+		/// </summary>
+		property int Capacity
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of wheels recorded per vehicle.
+		/// </summary>
+		property int MaxNumberOfWheels
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of values in each record.
+		/// </summary>
+		property int RecordSize
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of records in the buffer.
+		/// </summary>
+		property int Count
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of vehicles being recorded.
+		/// </summary>
+		property int VehicleCount
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the sum of the timesteps recorded since creation or the last Clear.
+		/// </summary>
+		property double Time
+		{
+			double get();
+		}
+
+	internal:
+		void Record(float timestep, PxVehicleWheels* const* vehicles, const PxVehicleWheelQueryResult* results, int count);
+
+	private:
+		void RecordVehicle(float* record, PxVehicleWheels* vehicle, const PxVehicleWheelQueryResult& result);
+		int GetRecordIndex(int index);
+		void OnVehicleDisposed(Object^ sender, EventArgs^ e);
+	};
+};
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "StdAfx.h"
+#include "VehicleTireForce.h"
+#include "VehicleTireModels.h"
+
+void VehicleTireForce::Evaluate(VehicleDefaultTireParameters parameters, array<VehicleTireForceInput>^ inputs, array<VehicleTireForceOutput>^ outputs)
+{
+	CheckArguments(inputs, outputs);
+
+	if (inputs->Length == 0)
+		return;
+
+	// The managed structs have the same layout as the native records, so both arrays are used in place
+	pin_ptr<VehicleTireForceInput> in = &inputs[0];
+	pin_ptr<VehicleTireForceOutput> out = &outputs[0];
+
+	pin_ptr<VehicleDefaultTireParameters> p = &parameters;
+
+	VehicleTireModels::EvaluateDefault(*(VehicleDefaultTireDataUnmanaged*)p, (VehicleTireForceInputUnmanaged*)in, (VehicleTireForceOutputUnmanaged*)out, inputs->Length);
+}
+void VehicleTireForce::Evaluate(VehiclePacejkaTireParameters parameters, array<VehicleTireForceInput>^ inputs, array<VehicleTireForceOutput>^ outputs)
+{
+	CheckArguments(inputs, outputs);
+
+	if (inputs->Length == 0)
+		return;
+
+	pin_ptr<VehicleTireForceInput> in = &inputs[0];
+	pin_ptr<VehicleTireForceOutput> out = &outputs[0];
+
+	pin_ptr<VehiclePacejkaTireParameters> p = &parameters;
+
+	VehicleTireModels::EvaluatePacejka(*(VehiclePacejkaTireDataUnmanaged*)p, (VehicleTireForceInputUnmanaged*)in, (VehicleTireForceOutputUnmanaged*)out, inputs->Length);
+}
+void VehicleTireForce::Evaluate(VehicleBrushTireParameters parameters, array<VehicleTireForceInput>^ inputs, array<VehicleTireForceOutput>^ outputs)
+{
+	CheckArguments(inputs, outputs);
+
+	if (inputs->Length == 0)
+		return;
+
+	pin_ptr<VehicleTireForceInput> in = &inputs[0];
+	pin_ptr<VehicleTireForceOutput> out = &outputs[0];
+
+	pin_ptr<VehicleBrushTireParameters> p = &parameters;
+
+	VehicleTireModels::EvaluateBrush(*(VehicleBrushTireDataUnmanaged*)p, (VehicleTireForceInputUnmanaged*)in, (VehicleTireForceOutputUnmanaged*)out, inputs->Length);
+}
+
+void VehicleTireForce::CheckArguments(array<VehicleTireForceInput>^ inputs, array<VehicleTireForceOutput>^ outputs)
+{
+	ThrowIfNull(inputs, "inputs");
+	ThrowIfNull(outputs, "outputs");
+
+	if (outputs->Length < inputs->Length)
+		throw gcnew ArgumentException("There must be an output for each input", "outputs");
+}
\ No newline at end of file
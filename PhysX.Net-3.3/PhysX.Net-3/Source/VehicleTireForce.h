@@ -0,0 +1,65 @@
+#pragma once
+
+#include "VehicleTireModelParameters.h"
+
+using namespace System::Runtime::InteropServices;
+
+namespace PhysX
+{
+	/// <summary>
+	/// The inputs to a tire force model for one tire.
+	/// </summary>
+	[StructLayout(LayoutKind::Sequential)]
+	public value class VehicleTireForceInput
+	{
+	public:
+		property float TireFriction;
+		property float LongitudinalSlip;
+		property float LateralSlip;
+		property float Camber;
+		property float WheelOmega;
+		property float WheelRadius;
+		property float ReciprocalWheelRadius;
+		property float RestTireLoad;
+		property float NormalisedTireLoad;
+		property float TireLoad;
+		property float Gravity;
+		property float ReciprocalGravity;
+	};
+
+	/// <summary>
+	/// The forces computed by a tire force model for one tire.
+	/// </summary>
+	[StructLayout(LayoutKind::Sequential)]
+	public value class VehicleTireForceOutput
+	{
+	public:
+		property float WheelTorque;
+		property float TireLongitudinalForceMagnitude;
+		property float TireLateralForceMagnitude;
+		property float TireAlignMoment;
+	};
+
+	/// <summary>
+	/// Evaluates the native tire force models outside of a vehicle update, e.g. to plot force curves while tuning.
+	/// </summary>
+	public ref class VehicleTireForce abstract sealed
+	{
+	public:
+		/// <summary>
+		/// Evaluates the default tire model for each input.
+		/// </summary>
+		static void Evaluate(VehicleDefaultTireParameters parameters, array<VehicleTireForceInput>^ inputs, array<VehicleTireForceOutput>^ outputs);
+		/// <summary>
+		/// Evaluates the Pacejka tire model for each input.
+		/// </summary>
+		static void Evaluate(VehiclePacejkaTireParameters parameters, array<VehicleTireForceInput>^ inputs, array<VehicleTireForceOutput>^ outputs);
+		/// <summary>
+		/// Evaluates the brush tire model for each input.
+		/// </summary>
+		static void Evaluate(VehicleBrushTireParameters parameters, array<VehicleTireForceInput>^ inputs, array<VehicleTireForceOutput>^ outputs);
+
+	private:
+		static void CheckArguments(array<VehicleTireForceInput>^ inputs, array<VehicleTireForceOutput>^ outputs);
+	};
+};
\ No newline at end of file
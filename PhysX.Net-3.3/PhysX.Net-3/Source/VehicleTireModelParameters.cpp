@@ -0,0 +1,42 @@
+#include "StdAfx.h"
+#include "VehicleTireModelParameters.h"
+#include "VehicleTyreData.h"
+
+VehicleDefaultTireParameters VehicleDefaultTireParameters::FromTireData(VehicleTireData^ tireData)
+{
+	ThrowIfNull(tireData, "tireData");
+
+	VehicleDefaultTireParameters p;
+	p.LateralStiffnessX = tireData->LateralStiffnessX;
+	p.LateralStiffnessY = tireData->LateralStiffnessY;
+	p.LongitudinalStiffnessPerUnitGravity = tireData->LongitudinalStiffnessPerUnitGravity;
+	p.CamberStiffnessPerUnitGravity = tireData->CamberStiffnessPerUnitGravity;
+
+	return p;
+}
+
+VehiclePacejkaTireParameters VehiclePacejkaTireParameters::Default::get()
+{
+	VehiclePacejkaTireParameters p;
+	p.LongitudinalB = 10.0f;
+	p.LongitudinalC = 1.65f;
+	p.LongitudinalE = 0.97f;
+	p.LateralB = 8.0f;
+	p.LateralC = 1.3f;
+	p.LateralE = 0.97f;
+	p.CamberSensitivity = 0.0f;
+	p.PneumaticTrail = 0.03f;
+
+	return p;
+}
+
+VehicleBrushTireParameters VehicleBrushTireParameters::Default::get()
+{
+	VehicleBrushTireParameters p;
+	p.LongitudinalStiffnessPerUnitGravity = 1000.0f;
+	p.LateralStiffnessPerUnitLoad = 17.0f;
+	p.CamberSensitivity = 0.0f;
+	p.ContactPatchHalfLength = 0.1f;
+
+	return p;
+}
\ No newline at end of file
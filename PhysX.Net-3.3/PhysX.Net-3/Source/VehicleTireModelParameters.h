@@ -0,0 +1,98 @@
+#pragma once
+
+using namespace System::Runtime::InteropServices;
+
+namespace PhysX
+{
+	ref class VehicleTireData;
+
+	/// <summary>
+	/// Parameters of the default tire model, as described by VehicleTireData.
+	/// </summary>
+	[StructLayout(LayoutKind::Sequential)]
+	public value class VehicleDefaultTireParameters
+	{
+	public:
+		/// <summary>
+		/// Creates parameters from the stiffness values of tire data.
+		/// </summary>
+		static VehicleDefaultTireParameters FromTireData(VehicleTireData^ tireData);
+
+		/// <summary>
+		/// The minimum normalised load (load/restLoad) that gives a flat lateral stiffness response.
+		/// </summary>
+		property float LateralStiffnessX;
+		/// <summary>
+		/// The maximum possible lateral stiffness divided by the rest tire load, per radian.
+		/// </summary>
+		property float LateralStiffnessY;
+		/// <summary>
+		/// Longitudinal stiffness of the tire per unit gravitational acceleration.
+		/// </summary>
+		property float LongitudinalStiffnessPerUnitGravity;
+		/// <summary>
+		/// Camber stiffness per unit gravitational acceleration.
+		/// </summary>
+		property float CamberStiffnessPerUnitGravity;
+	};
+
+	/// <summary>
+	/// Parameters of Pacejka's Magic Formula, F = D sin(C atan(Bx - E(Bx - atan(Bx)))), where the peak D is the
+	/// tire friction multiplied by the tire load. x is the longitudinal slip ratio, or the lateral slip angle in radians.
+	/// </summary>
+	[StructLayout(LayoutKind::Sequential)]
+	public value class VehiclePacejkaTireParameters
+	{
+	public:
+		/// <summary>
+		/// Gets typical parameters for a road tire on a dry surface.
+		/// </summary>
+		static property VehiclePacejkaTireParameters Default
+		{
+			VehiclePacejkaTireParameters get();
+		}
+
+		/// <summary>Stiffness factor of the longitudinal force curve.</summary>
+		property float LongitudinalB;
+		/// <summary>Shape factor of the longitudinal force curve.</summary>
+		property float LongitudinalC;
+		/// <summary>Curvature factor of the longitudinal force curve.</summary>
+		property float LongitudinalE;
+		/// <summary>Stiffness factor of the lateral force curve.</summary>
+		property float LateralB;
+		/// <summary>Shape factor of the lateral force curve.</summary>
+		property float LateralC;
+		/// <summary>Curvature factor of the lateral force curve.</summary>
+		property float LateralE;
+		/// <summary>Lateral slip angle offset per radian of camber.</summary>
+		property float CamberSensitivity;
+		/// <summary>Distance behind the contact point at which the lateral force acts, giving the aligning moment.</summary>
+		property float PneumaticTrail;
+	};
+
+	/// <summary>
+	/// Parameters of the brush tire model, in which the contact patch is a row of elastic bristles that stick to
+	/// the ground until the friction limit is reached.
+	/// </summary>
+	[StructLayout(LayoutKind::Sequential)]
+	public value class VehicleBrushTireParameters
+	{
+	public:
+		/// <summary>
+		/// Gets typical parameters for a road tire.
+		/// </summary>
+		static property VehicleBrushTireParameters Default
+		{
+			VehicleBrushTireParameters get();
+		}
+
+		/// <summary>Longitudinal slip stiffness per unit gravitational acceleration.</summary>
+		property float LongitudinalStiffnessPerUnitGravity;
+		/// <summary>Cornering stiffness per unit tire load, per radian.</summary>
+		property float LateralStiffnessPerUnitLoad;
+		/// <summary>Lateral slip angle offset per radian of camber.</summary>
+		property float CamberSensitivity;
+		/// <summary>Half the length of the contact patch.</summary>
+		property float ContactPatchHalfLength;
+	};
+};
\ No newline at end of file
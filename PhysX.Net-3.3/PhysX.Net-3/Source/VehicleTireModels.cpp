@@ -0,0 +1,212 @@
+/*
+	This file is compiled without the /clr flag (like ShapeUtil.cpp). PhysX calls the tire force shader for every
+	wheel of every vehicle on every substep, so it must not go through a managed-to-native thunk.
+*/
+
+#include <foundation\PxMath.h>
+#include <vehicle\PxVehicleWheels.h>
+#include "VehicleTireModels.h"
+
+using namespace physx;
+
+namespace
+{
+	template<typename TData>
+	struct TireModel;
+
+	// A port of the SDK's default tire model (PxVehicleComputeTireForceDefault), which is not exported.
+	// Based on the CarSimEd tire model, see Appendix F of the CarSimEd manual.
+	template<>
+	struct TireModel<VehicleDefaultTireDataUnmanaged>
+	{
+		static PX_FORCE_INLINE PxF32 smoothingFunction1(const PxF32 K)
+		{
+			return PxMin(1.0f, K - K*K/3.0f + K*K*K/27.0f);
+		}
+		static PX_FORCE_INLINE PxF32 smoothingFunction2(const PxF32 K)
+		{
+			return K - K*K + K*K*K/3.0f - K*K*K*K/27.0f;
+		}
+
+		static PX_FORCE_INLINE void compute(const VehicleDefaultTireDataUnmanaged& data, const VehicleTireForceInputUnmanaged& in, VehicleTireForceOutputUnmanaged& out)
+		{
+			out.wheelTorque = 0.0f;
+			out.tireLongForceMag = 0.0f;
+			out.tireLatForceMag = 0.0f;
+			out.tireAlignMoment = 0.0f;
+
+			if (in.latSlip == 0.0f && in.longSlip == 0.0f && in.camber == 0.0f)
+				return;
+
+			const PxF32 latStiff = in.restTireLoad * data.latStiffY * smoothingFunction1(in.normalisedTireLoad * 3.0f / data.latStiffX);
+			const PxF32 longStiff = data.longitudinalStiffnessPerUnitGravity * in.gravity;
+			const PxF32 recipLongStiff = in.recipGravity / data.longitudinalStiffnessPerUnitGravity;
+			const PxF32 camberStiff = data.camberStiffnessPerUnitGravity * in.gravity;
+
+			const PxF32 TEff = PxTan(in.latSlip - in.camber * camberStiff / latStiff);
+			const PxF32 K = PxSqrt(latStiff*TEff*latStiff*TEff + longStiff*in.longSlip*longStiff*in.longSlip) / (in.tireFriction * in.tireLoad);
+			const PxF32 FBar = smoothingFunction1(K);
+			const PxF32 MBar = smoothingFunction2(K);
+
+			PxF32 nu = 1.0f;
+			if (K <= 2.0f * PxPi)
+			{
+				const PxF32 latOverLong = latStiff * recipLongStiff;
+				nu = 0.5f * (1.0f + latOverLong - (1.0f - latOverLong) * PxCos(K * 0.5f));
+			}
+
+			const PxF32 FZero = in.tireFriction * in.tireLoad / PxSqrt(in.longSlip*in.longSlip + nu*TEff*nu*TEff);
+			const PxF32 fz = in.longSlip * FBar * FZero;
+			const PxF32 fx = -nu * TEff * FBar * FZero;
+			const PxF32 pneumaticTrail = 1.0f;
+			const PxF32 fMy = nu * pneumaticTrail * TEff * MBar * FZero;
+
+			out.wheelTorque = -fz * in.wheelRadius;
+			out.tireLongForceMag = fz;
+			out.tireLatForceMag = fx;
+			out.tireAlignMoment = fMy;
+		}
+	};
+
+	// Pacejka's Magic Formula, F = D sin(C atan(Bx - E(Bx - atan(Bx)))), with the peak D given by the friction and
+	// load. Longitudinal and lateral forces are evaluated separately then scaled back onto the friction ellipse.
+	template<>
+	struct TireModel<VehiclePacejkaTireDataUnmanaged>
+	{
+		static PX_FORCE_INLINE PxF32 magicFormula(const PxF32 x, const PxF32 B, const PxF32 C, const PxF32 E)
+		{
+			const PxF32 Bx = B * x;
+
+			return PxSin(C * PxAtan(Bx - E * (Bx - PxAtan(Bx))));
+		}
+
+		static PX_FORCE_INLINE void compute(const VehiclePacejkaTireDataUnmanaged& data, const VehicleTireForceInputUnmanaged& in, VehicleTireForceOutputUnmanaged& out)
+		{
+			const PxF32 D = in.tireFriction * in.tireLoad;
+
+			PxF32 fLong = magicFormula(in.longSlip, data.longB, data.longC, data.longE);
+			PxF32 fLat = -magicFormula(in.latSlip - in.camber * data.camberSensitivity, data.latB, data.latC, data.latE);
+
+			// Combined slip, the total force can't exceed the available friction
+			const PxF32 combined = fLong*fLong + fLat*fLat;
+			if (combined > 1.0f)
+			{
+				const PxF32 scale = PxRecipSqrt(combined);
+				fLong *= scale;
+				fLat *= scale;
+			}
+
+			out.tireLongForceMag = fLong * D;
+			out.tireLatForceMag = fLat * D;
+			out.tireAlignMoment = -out.tireLatForceMag * data.pneumaticTrail;
+			out.wheelTorque = -out.tireLongForceMag * in.wheelRadius;
+		}
+	};
+
+	// The brush model with a parabolic pressure distribution (Fiala), with combined slip handled by treating the
+	// longitudinal and lateral deflections of the bristles as one vector. The pneumatic trail is approximated as
+	// shrinking linearly from a third of the contact patch half length to zero at full sliding.
+	template<>
+	struct TireModel<VehicleBrushTireDataUnmanaged>
+	{
+		static PX_FORCE_INLINE void compute(const VehicleBrushTireDataUnmanaged& data, const VehicleTireForceInputUnmanaged& in, VehicleTireForceOutputUnmanaged& out)
+		{
+			out.wheelTorque = 0.0f;
+			out.tireLongForceMag = 0.0f;
+			out.tireLatForceMag = 0.0f;
+			out.tireAlignMoment = 0.0f;
+
+			const PxF32 longStiff = data.longitudinalStiffnessPerUnitGravity * in.gravity;
+			const PxF32 latStiff = data.lateralStiffnessPerUnitLoad * in.tireLoad;
+
+			const PxF32 sigmaLong = longStiff * in.longSlip;
+			const PxF32 sigmaLat = latStiff * PxTan(in.latSlip - in.camber * data.camberSensitivity);
+			const PxF32 sigma = PxSqrt(sigmaLong*sigmaLong + sigmaLat*sigmaLat);
+
+			if (sigma < 1e-6f)
+				return;
+
+			const PxF32 muF = in.tireFriction * in.tireLoad;
+			const PxF32 slide = 3.0f * muF;
+
+			PxF32 F = muF;
+			PxF32 trail = 0.0f;
+			if (sigma < slide)
+			{
+				F = sigma - sigma*sigma / (3.0f * muF) + sigma*sigma*sigma / (27.0f * muF*muF);
+				trail = data.contactPatchHalfLength / 3.0f * (1.0f - sigma / slide);
+			}
+
+			const PxF32 recipSigma = 1.0f / sigma;
+
+			out.tireLongForceMag = F * sigmaLong * recipSigma;
+			out.tireLatForceMag = -F * sigmaLat * recipSigma;
+			out.tireAlignMoment = -out.tireLatForceMag * trail;
+			out.wheelTorque = -out.tireLongForceMag * in.wheelRadius;
+		}
+	};
+
+	// The PxVehicleComputeTireForce signature, forwarding to the model so it's inlined into the shader
+	template<typename TData>
+	void computeTireForce
+	(
+		const void* shaderData,
+		const PxF32 tireFriction,
+		const PxF32 longSlip, const PxF32 latSlip, const PxF32 camber,
+		const PxF32 wheelOmega, const PxF32 wheelRadius, const PxF32 recipWheelRadius,
+		const PxF32 restTireLoad, const PxF32 normalisedTireLoad, const PxF32 tireLoad,
+		const PxF32 gravity, const PxF32 recipGravity,
+		PxF32& wheelTorque, PxF32& tireLongForceMag, PxF32& tireLatForceMag, PxF32& tireAlignMoment
+	)
+	{
+		const VehicleTireForceInputUnmanaged in =
+		{
+			tireFriction,
+			longSlip, latSlip, camber,
+			wheelOmega, wheelRadius, recipWheelRadius,
+			restTireLoad, normalisedTireLoad, tireLoad,
+			gravity, recipGravity
+		};
+		VehicleTireForceOutputUnmanaged out;
+
+		TireModel<TData>::compute(*static_cast<const TData*>(shaderData), in, out);
+
+		wheelTorque = out.wheelTorque;
+		tireLongForceMag = out.tireLongForceMag;
+		tireLatForceMag = out.tireLatForceMag;
+		tireAlignMoment = out.tireAlignMoment;
+	}
+
+	template<typename TData>
+	void evaluate(const TData& data, const VehicleTireForceInputUnmanaged* inputs, VehicleTireForceOutputUnmanaged* outputs, PxU32 count)
+	{
+		for (PxU32 i = 0; i < count; i++)
+			TireModel<TData>::compute(data, inputs[i], outputs[i]);
+	}
+}
+
+PxVehicleComputeTireForce VehicleTireModels::GetDefaultShader()
+{
+	return &computeTireForce<VehicleDefaultTireDataUnmanaged>;
+}
+PxVehicleComputeTireForce VehicleTireModels::GetPacejkaShader()
+{
+	return &computeTireForce<VehiclePacejkaTireDataUnmanaged>;
+}
+PxVehicleComputeTireForce VehicleTireModels::GetBrushShader()
+{
+	return &computeTireForce<VehicleBrushTireDataUnmanaged>;
+}
+
+void VehicleTireModels::EvaluateDefault(const VehicleDefaultTireDataUnmanaged& data, const VehicleTireForceInputUnmanaged* inputs, VehicleTireForceOutputUnmanaged* outputs, PxU32 count)
+{
+	evaluate(data, inputs, outputs, count);
+}
+void VehicleTireModels::EvaluatePacejka(const VehiclePacejkaTireDataUnmanaged& data, const VehicleTireForceInputUnmanaged* inputs, VehicleTireForceOutputUnmanaged* outputs, PxU32 count)
+{
+	evaluate(data, inputs, outputs, count);
+}
+void VehicleTireModels::EvaluateBrush(const VehicleBrushTireDataUnmanaged& data, const VehicleTireForceInputUnmanaged* inputs, VehicleTireForceOutputUnmanaged* outputs, PxU32 count)
+{
+	evaluate(data, inputs, outputs, count);
+}
\ No newline at end of file
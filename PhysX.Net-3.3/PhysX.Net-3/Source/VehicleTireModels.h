@@ -0,0 +1,92 @@
+#pragma once
+
+#include <foundation\PxSimpleTypes.h>
+#include <vehicle\PxVehicleWheels.h>
+
+/// <summary>
+/// The inputs PhysX passes to a tire force shader, as one record.
+/// </summary>
+struct VehicleTireForceInputUnmanaged
+{
+	physx::PxF32 tireFriction;
+	physx::PxF32 longSlip;
+	physx::PxF32 latSlip;
+	physx::PxF32 camber;
+	physx::PxF32 wheelOmega;
+	physx::PxF32 wheelRadius;
+	physx::PxF32 recipWheelRadius;
+	physx::PxF32 restTireLoad;
+	physx::PxF32 normalisedTireLoad;
+	physx::PxF32 tireLoad;
+	physx::PxF32 gravity;
+	physx::PxF32 recipGravity;
+};
+
+/// <summary>
+/// The outputs of a tire force shader, as one record.
+/// </summary>
+struct VehicleTireForceOutputUnmanaged
+{
+	physx::PxF32 wheelTorque;
+	physx::PxF32 tireLongForceMag;
+	physx::PxF32 tireLatForceMag;
+	physx::PxF32 tireAlignMoment;
+};
+
+// Shader data of each tire model, laid out to match the managed parameter structs
+
+struct VehicleDefaultTireDataUnmanaged
+{
+	physx::PxF32 latStiffX;
+	physx::PxF32 latStiffY;
+	physx::PxF32 longitudinalStiffnessPerUnitGravity;
+	physx::PxF32 camberStiffnessPerUnitGravity;
+};
+
+struct VehiclePacejkaTireDataUnmanaged
+{
+	physx::PxF32 longB;
+	physx::PxF32 longC;
+	physx::PxF32 longE;
+	physx::PxF32 latB;
+	physx::PxF32 latC;
+	physx::PxF32 latE;
+	physx::PxF32 camberSensitivity;
+	physx::PxF32 pneumaticTrail;
+};
+
+struct VehicleBrushTireDataUnmanaged
+{
+	physx::PxF32 longitudinalStiffnessPerUnitGravity;
+	physx::PxF32 lateralStiffnessPerUnitLoad;
+	physx::PxF32 camberSensitivity;
+	physx::PxF32 contactPatchHalfLength;
+};
+
+// Shader data of a tire, whichever the model
+union VehicleTireDataUnmanaged
+{
+	VehicleDefaultTireDataUnmanaged defaultModel;
+	VehiclePacejkaTireDataUnmanaged pacejka;
+	VehicleBrushTireDataUnmanaged brush;
+};
+
+/// <summary>
+/// Native tire force shaders for PxVehicleWheelsDynData::setTireForceShaderFunction.
+/// Each model is a specialization of a template evaluated inline by its shader and batch functions.
+/// </summary>
+/// <remarks>
+/// Compiled without /clr, so PhysX calls the shaders without a managed transition.
+/// </remarks>
+class VehicleTireModels
+{
+public:
+	static physx::PxVehicleComputeTireForce GetDefaultShader();
+	static physx::PxVehicleComputeTireForce GetPacejkaShader();
+	static physx::PxVehicleComputeTireForce GetBrushShader();
+
+	// Evaluate a model for many inputs, e.g. to plot force curves or benchmark a model
+	static void EvaluateDefault(const VehicleDefaultTireDataUnmanaged& data, const VehicleTireForceInputUnmanaged* inputs, VehicleTireForceOutputUnmanaged* outputs, physx::PxU32 count);
+	static void EvaluatePacejka(const VehiclePacejkaTireDataUnmanaged& data, const VehicleTireForceInputUnmanaged* inputs, VehicleTireForceOutputUnmanaged* outputs, physx::PxU32 count);
+	static void EvaluateBrush(const VehicleBrushTireDataUnmanaged& data, const VehicleTireForceInputUnmanaged* inputs, VehicleTireForceOutputUnmanaged* outputs, physx::PxU32 count);
+};
\ No newline at end of file
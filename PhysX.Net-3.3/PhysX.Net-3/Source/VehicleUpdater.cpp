@@ -0,0 +1,240 @@
+#include "StdAfx.h"
+#include "VehicleUpdater.h"
+#include "Physics.h"
+#include "VehicleWheels.h"
+#include "VehicleWheelQueryResult.h"
+#include "VehicleDrivableSurfaceToTireFrictionPairs.h"
+#include "VehicleTelemetryRecorder.h"
+
+using namespace System::Threading::Tasks;
+
+VehicleUpdater::VehicleUpdater(PhysX::Physics^ physics, int maxNumberOfTireTypes, int maxNumberOfSurfaceTypes)
+{
+	ThrowIfNullOrDisposed(physics, "physics");
+
+	_physics = physics;
+
+	_vehicles = new std::vector<PxVehicleWheels*>();
+	_vehicleQueryResults = new std::vector<PxVehicleWheelQueryResult>();
+	_wheelQueryResults = new std::vector<PxWheelQueryResult>();
+	_concurrentUpdates = new std::vector<PxVehicleConcurrentUpdateData>();
+	_wheelConcurrentUpdates = new std::vector<PxVehicleWheelConcurrentUpdateData>();
+	_vehicleCount = 0;
+
+	ObjectTable::AddObjectOwner(this, physics);
+
+	_frictionPairs = gcnew VehicleDrivableSurfaceToTireFrictionPairs(maxNumberOfTireTypes, maxNumberOfSurfaceTypes, this);
+}
+VehicleUpdater::~VehicleUpdater()
+{
+	this->!VehicleUpdater();
+}
+VehicleUpdater::!VehicleUpdater()
+{
+	OnDisposing(this, nullptr);
+
+	if (this->Disposed)
+		return;
+
+	delete _frictionPairs;
+	_frictionPairs = nullptr;
+
+	SAFE_DELETE(_vehicles);
+	SAFE_DELETE(_vehicleQueryResults);
+	SAFE_DELETE(_wheelQueryResults);
+	SAFE_DELETE(_concurrentUpdates);
+	SAFE_DELETE(_wheelConcurrentUpdates);
+	_vehicleCount = 0;
+
+	_telemetry = nullptr;
+	_physics = nullptr;
+
+	OnDisposed(this, nullptr);
+}
+bool VehicleUpdater::Disposed::get()
+{
+	return (_physics == nullptr);
+}
+
+void VehicleUpdater::Update(float timestep, Vector3 gravity, array<VehicleWheels^>^ vehicles)
+{
+	ThrowIfThisDisposed();
+
+	Prepare(vehicles, false);
+
+	if (_vehicleCount == 0)
+		return;
+
+	PxVehicleUpdates(timestep, UV(gravity), *_frictionPairs->UnmanagedPointer, _vehicleCount, &(*_vehicles)[0], &(*_vehicleQueryResults)[0]);
+
+	RecordTelemetry(timestep);
+}
+
+void VehicleUpdater::UpdateParallel(float timestep, Vector3 gravity, array<VehicleWheels^>^ vehicles, [Optional] int chunkSize)
+{
+	ThrowIfThisDisposed();
+
+	Prepare(vehicles, true);
+
+	if (_vehicleCount == 0)
+		return;
+
+	_timestep = timestep;
+	_gravity = gravity;
+	_chunkSize = (chunkSize <= 0 ? DefaultChunkSize : chunkSize);
+
+	int chunks = (_vehicleCount + _chunkSize - 1) / _chunkSize;
+
+	// Each chunk only writes to its own vehicles and buffers, changes to actors are deferred to the post update
+	Parallel::For(0, chunks, gcnew Action<int>(this, &VehicleUpdater::UpdateChunk));
+
+	PxVehiclePostUpdates(&(*_concurrentUpdates)[0], _vehicleCount, &(*_vehicles)[0]);
+
+	RecordTelemetry(timestep);
+}
+
+void VehicleUpdater::RecordTelemetry(float timestep)
+{
+	if (_telemetry == nullptr)
+		return;
+
+	_telemetry->Record(timestep, &(*_vehicles)[0], &(*_vehicleQueryResults)[0], _vehicleCount);
+}
+
+void VehicleUpdater::UpdateChunk(int chunk)
+{
+	int start = chunk * _chunkSize;
+	int count = Math::Min(_chunkSize, _vehicleCount - start);
+
+	PxVehicleUpdates
+	(
+		_timestep,
+		UV(_gravity),
+		*_frictionPairs->UnmanagedPointer,
+		count,
+		&(*_vehicles)[start],
+		&(*_vehicleQueryResults)[start],
+		&(*_concurrentUpdates)[start]
+	);
+}
+
+void VehicleUpdater::Prepare(array<VehicleWheels^>^ vehicles, bool concurrent)
+{
+	ThrowIfNull(vehicles, "vehicles");
+
+	int n = vehicles->Length;
+
+	// The buffers only ever grow, so steady state updates don't allocate
+	if ((int)_vehicles->size() < n)
+	{
+		_vehicles->resize(n);
+		_vehicleQueryResults->resize(n);
+	}
+
+	int wheelCount = 0;
+	for (int i = 0; i < n; i++)
+	{
+		ThrowIfNullOrDisposed(vehicles[i], "vehicles");
+
+		PxVehicleWheels* v = vehicles[i]->UnmanagedPointer;
+
+		(*_vehicles)[i] = v;
+		wheelCount += v->mWheelsSimData.getNbWheels();
+	}
+
+	if ((int)_wheelQueryResults->size() < wheelCount)
+		_wheelQueryResults->resize(wheelCount);
+
+	if (concurrent)
+	{
+		if ((int)_concurrentUpdates->size() < n)
+			_concurrentUpdates->resize(n);
+		if ((int)_wheelConcurrentUpdates->size() < wheelCount)
+			_wheelConcurrentUpdates->resize(wheelCount);
+	}
+
+	// Give each vehicle its slice of the wheel buffers
+	int offset = 0;
+	for (int i = 0; i < n; i++)
+	{
+		PxU32 wheels = (*_vehicles)[i]->mWheelsSimData.getNbWheels();
+
+		PxVehicleWheelQueryResult& r = (*_vehicleQueryResults)[i];
+		r.wheelQueryResults = wheels > 0 ? &(*_wheelQueryResults)[offset] : NULL;
+		r.nbWheelQueryResults = wheels;
+
+		if (concurrent)
+		{
+			PxVehicleConcurrentUpdateData& c = (*_concurrentUpdates)[i];
+			c.concurrentWheelUpdates = wheels > 0 ? &(*_wheelConcurrentUpdates)[offset] : NULL;
+			c.nbConcurrentWheelUpdates = wheels;
+		}
+
+		offset += wheels;
+	}
+
+	_vehicleCount = n;
+}
+
+PxVehicleWheelQueryResult& VehicleUpdater::GetVehicleQueryResult(int vehicleIndex)
+{
+	ThrowIfThisDisposed();
+
+	if (vehicleIndex < 0 || vehicleIndex >= _vehicleCount)
+		throw gcnew ArgumentOutOfRangeException("vehicleIndex");
+
+	return (*_vehicleQueryResults)[vehicleIndex];
+}
+
+VehicleWheelQueryResult^ VehicleUpdater::GetWheelQueryResult(int vehicleIndex, int wheelIndex)
+{
+	PxVehicleWheelQueryResult& r = GetVehicleQueryResult(vehicleIndex);
+
+	if (wheelIndex < 0 || wheelIndex >= (int)r.nbWheelQueryResults)
+		throw gcnew ArgumentOutOfRangeException("wheelIndex");
+
+	return VehicleWheelQueryResult::ToManaged(&r.wheelQueryResults[wheelIndex]);
+}
+array<VehicleWheelQueryResult^>^ VehicleUpdater::GetWheelQueryResults(int vehicleIndex)
+{
+	PxVehicleWheelQueryResult& r = GetVehicleQueryResult(vehicleIndex);
+
+	auto results = gcnew array<VehicleWheelQueryResult^>(r.nbWheelQueryResults);
+	for (int i = 0; i < results->Length; i++)
+	{
+		results[i] = VehicleWheelQueryResult::ToManaged(&r.wheelQueryResults[i]);
+	}
+
+	return results;
+}
+
+bool VehicleUpdater::IsInAir(int vehicleIndex)
+{
+	return PxVehicleIsInAir(GetVehicleQueryResult(vehicleIndex));
+}
+
+//
+
+PhysX::Physics^ VehicleUpdater::Physics::get()
+{
+	return _physics;
+}
+
+VehicleDrivableSurfaceToTireFrictionPairs^ VehicleUpdater::FrictionPairs::get()
+{
+	return _frictionPairs;
+}
+
+VehicleTelemetryRecorder^ VehicleUpdater::Telemetry::get()
+{
+	return _telemetry;
+}
+void VehicleUpdater::Telemetry::set(VehicleTelemetryRecorder^ value)
+{
+	_telemetry = value;
+}
+
+int VehicleUpdater::VehicleCount::get()
+{
+	return _vehicleCount;
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+namespace PhysX
+{
+	ref class Physics;
+	ref class VehicleWheels;
+	ref class VehicleWheelQueryResult;
+	ref class VehicleDrivableSurfaceToTireFrictionPairs;
+	ref class VehicleTelemetryRecorder;
+
+	/// <summary>
+	/// Steps a set of vehicles with PxVehicleUpdates, either in a single call or in parallel chunks.
+	/// The updater owns the surface/tire friction table and the per wheel query result and concurrent update
+	/// buffers, which are only reallocated when the total number of wheels grows.
+	/// </summary>
+	/// <remarks>
+	/// Suspension raycasts must be completed for the vehicles before each update.
+	/// Wheel query results are indexed by the position of the vehicle in the array passed to the last update.
+	/// </remarks>
+	public ref class VehicleUpdater : IDisposable
+	{
+	public:
+		/// <summary>Raised before any disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposing;
+		/// <summary>Raised once all disposing is performed.</summary>
+		virtual event EventHandler^ OnDisposed;
+
+		/// <summary>
+		/// The number of vehicles updated by each parallel task if no chunk size is given.
+		/// </summary>
+		literal int DefaultChunkSize = 32;
+
+	private:
+		PhysX::Physics^ _physics;
+		VehicleDrivableSurfaceToTireFrictionPairs^ _frictionPairs;
+		VehicleTelemetryRecorder^ _telemetry;
+
+		std::vector<PxVehicleWheels*>* _vehicles;
+		std::vector<PxVehicleWheelQueryResult>* _vehicleQueryResults;
+		std::vector<PxWheelQueryResult>* _wheelQueryResults;
+		std::vector<PxVehicleConcurrentUpdateData>* _concurrentUpdates;
+		std::vector<PxVehicleWheelConcurrentUpdateData>* _wheelConcurrentUpdates;
+		int _vehicleCount;
+
+		// State of the parallel update in progress, read by UpdateChunk
+		float _timestep;
+		Vector3 _gravity;
+		int _chunkSize;
+
+	public:
+		/// <summary>
+		/// Creates a vehicle updater. The vehicle SDK must be initalized.
+		/// </summary>
+		/// <param name="physics">The physics instance the vehicles belong to.</param>
+		/// <param name="maxNumberOfTireTypes">The maximum number of tire types in the friction table.</param>
+		/// <param name="maxNumberOfSurfaceTypes">The maximum number of drivable surface types in the friction table.</param>
+		VehicleUpdater(PhysX::Physics^ physics, int maxNumberOfTireTypes, int maxNumberOfSurfaceTypes);
+		~VehicleUpdater();
+	protected:
+		!VehicleUpdater();
+	public:
+		property bool Disposed
+		{
+			virtual bool get();
+		}
+
+		/// <summary>
+		/// Updates the vehicles in a single call to PxVehicleUpdates.
+		/// </summary>
+		/// <param name="timestep">The time to step the vehicles by.</param>
+		/// <param name="gravity">The gravity of the scene the vehicles are in.</param>
+		/// <param name="vehicles">The vehicles to update.</param>
+		void Update(float timestep, Vector3 gravity, array<VehicleWheels^>^ vehicles);
+
+		/// <summary>
+		/// Updates the vehicles in parallel chunks, then applies the deferred changes to their actors with
+		/// PxVehiclePostUpdates on the calling thread.
+		/// </summary>
+		/// <param name="timestep">The time to step the vehicles by.</param>
+		/// <param name="gravity">The gravity of the scene the vehicles are in.</param>
+		/// <param name="vehicles">The vehicles to update.</param>
+		/// <param name="chunkSize">The number of vehicles updated by each task. If zero or less, DefaultChunkSize is used.</param>
+		void UpdateParallel(float timestep, Vector3 gravity, array<VehicleWheels^>^ vehicles, [Optional] int chunkSize);
+
+		/// <summary>
+		/// Gets the result of a wheel from the last update.
+		/// </summary>
+		VehicleWheelQueryResult^ GetWheelQueryResult(int vehicleIndex, int wheelIndex);
+		/// <summary>
+		/// Gets the results of every wheel of a vehicle from the last update.
+		/// </summary>
+		array<VehicleWheelQueryResult^>^ GetWheelQueryResults(int vehicleIndex);
+
+		/// <summary>
+		/// Gets whether all the wheels of a vehicle were in the air in the last update.
+		/// </summary>
+		bool IsInAir(int vehicleIndex);
+
+		/// <summary>
+		/// Gets the physics instance the vehicles belong to.
+		/// </summary>
+		property PhysX::Physics^ Physics
+		{
+			PhysX::Physics^ get();
+		}
+
+		/// <summary>
+		/// Gets the table of friction values for each surface type and tire type combination.
+		/// </summary>
+		property VehicleDrivableSurfaceToTireFrictionPairs^ FrictionPairs
+		{
+			VehicleDrivableSurfaceToTireFrictionPairs^ get();
+		}
+
+		/// <summary>
+		/// Gets or sets the recorder sampling the vehicles after each update, or null to not record telemetry.
+		/// The updater doesn't own the recorder.
+		/// </summary>
+		property VehicleTelemetryRecorder^ Telemetry
+		{
+			VehicleTelemetryRecorder^ get();
+			void set(VehicleTelemetryRecorder^ value);
+		}
+
+		/// <summary>
+		/// Gets the number of vehicles in the last update.
+		/// </summary>
+		property int VehicleCount
+		{
+			int get();
+		}
+
+	private:
+		void Prepare(array<VehicleWheels^>^ vehicles, bool concurrent);
+		void UpdateChunk(int chunk);
+		void RecordTelemetry(float timestep);
+		PxVehicleWheelQueryResult& GetVehicleQueryResult(int vehicleIndex);
+	};
+};
\ No newline at end of file
@@ -10,6 +10,7 @@ VehicleWheels::VehicleWheels(PxVehicleWheels* wheels, PhysX::Physics^ owner)
 	ThrowIfNullOrDisposed(owner, "owner");
 
 	_wheels = wheels;
+	_wheelsDynData = gcnew VehicleWheelsDynData(wheels);
 
 	ObjectTable::Add((intptr_t)wheels, this, owner);
 }
@@ -27,6 +28,8 @@ VehicleWheels::!VehicleWheels()
 	// The derived types will dispose of the wheel instance.
 	_wheels = NULL;
 
+	_wheelsDynData->ReleaseShaderData();
+
 	OnDisposed(this, nullptr);
 }
 
@@ -63,6 +66,11 @@ PhysX::RigidDynamic^ VehicleWheels::Actor::get()
 	return ObjectTable::GetObject<RigidDynamic^>((intptr_t)actor);
 }
 
+VehicleWheelsDynData^ VehicleWheels::WheelsDynData::get()
+{
+	return _wheelsDynData;
+}
+
 PxVehicleWheels* VehicleWheels::UnmanagedPointer::get()
 {
 	return _wheels;
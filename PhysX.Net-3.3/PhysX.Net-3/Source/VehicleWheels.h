@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RigidDynamic.h"
+#include "VehicleWheelsDynData.h"
 
 namespace PhysX
 {
@@ -17,6 +18,7 @@ namespace PhysX
 
 	private:
 		PxVehicleWheels* _wheels;
+		VehicleWheelsDynData^ _wheelsDynData;
 
 	protected:
 		VehicleWheels(PxVehicleWheels* wheels, PhysX::Physics^ owner);
@@ -56,6 +58,14 @@ namespace PhysX
 			PhysX::RigidDynamic^ get();
 		}
 
+		/// <summary>
+		/// Gets the dynamics data of the wheels, including the tire force shader.
+		/// </summary>
+		property VehicleWheelsDynData^ WheelsDynData
+		{
+			VehicleWheelsDynData^ get();
+		}
+
 	internal:
 		property PxVehicleWheels* UnmanagedPointer
 		{
@@ -1,12 +1,119 @@
 #include "StdAfx.h"
 #include "VehicleWheelsDynData.h"
+#include "VehicleTireModels.h"
+
+VehicleWheelsDynData::VehicleWheelsDynData(PxVehicleWheels* wheels)
+{
+	if (wheels == NULL)
+		throw gcnew ArgumentNullException("wheels");
+
+	_wheels = wheels;
+	_shaderData = NULL;
+}
+
+void VehicleWheelsDynData::ReleaseShaderData()
+{
+	delete[] _shaderData;
+	_shaderData = NULL;
+}
 
 void VehicleWheelsDynData::SetToRestState()
 {
-	throw gcnew NotImplementedException();
+	_wheels->mWheelsDynData.setToRestState();
+}
+
+void VehicleWheelsDynData::SetTireForceShader(VehicleTireModel model)
+{
+	int n = this->NumberOfWheels;
+
+	if (_shaderData == NULL)
+		_shaderData = new VehicleTireDataUnmanaged[n];
+
+	PxVehicleComputeTireForce shader;
+	switch (model)
+	{
+		case VehicleTireModel::Default:
+			shader = VehicleTireModels::GetDefaultShader();
+			for (int i = 0; i < n; i++)
+			{
+				const PxVehicleTireData& tire = _wheels->mWheelsSimData.getTireData(i);
+
+				VehicleDefaultTireDataUnmanaged& d = _shaderData[i].defaultModel;
+				d.latStiffX = tire.mLatStiffX;
+				d.latStiffY = tire.mLatStiffY;
+				d.longitudinalStiffnessPerUnitGravity = tire.mLongitudinalStiffnessPerUnitGravity;
+				d.camberStiffnessPerUnitGravity = tire.mCamberStiffnessPerUnitGravity;
+			}
+			break;
+
+		case VehicleTireModel::Pacejka:
+		{
+			shader = VehicleTireModels::GetPacejkaShader();
+
+			VehiclePacejkaTireParameters defaults = VehiclePacejkaTireParameters::Default;
+			pin_ptr<VehiclePacejkaTireParameters> p = &defaults;
+			for (int i = 0; i < n; i++)
+				_shaderData[i].pacejka = *(VehiclePacejkaTireDataUnmanaged*)p;
+			break;
+		}
+
+		case VehicleTireModel::Brush:
+		{
+			shader = VehicleTireModels::GetBrushShader();
+
+			VehicleBrushTireParameters defaults = VehicleBrushTireParameters::Default;
+			pin_ptr<VehicleBrushTireParameters> p = &defaults;
+			for (int i = 0; i < n; i++)
+				_shaderData[i].brush = *(VehicleBrushTireDataUnmanaged*)p;
+			break;
+		}
+
+		default:
+			throw gcnew ArgumentOutOfRangeException("model");
+	}
+
+	_wheels->mWheelsDynData.setTireForceShaderFunction(shader);
+	for (int i = 0; i < n; i++)
+		_wheels->mWheelsDynData.setTireForceShaderData(i, &_shaderData[i]);
+
+	_tireModel = model;
+}
+
+VehicleTireDataUnmanaged* VehicleWheelsDynData::GetShaderData(int tireId, VehicleTireModel model)
+{
+	if (!_tireModel.HasValue || _tireModel.Value != model)
+		throw gcnew InvalidOperationException(String::Format("The {0} tire model must be set as the tire force shader first", model));
+	if (tireId < 0 || tireId >= this->NumberOfWheels)
+		throw gcnew ArgumentOutOfRangeException("tireId");
+
+	return &_shaderData[tireId];
+}
+
+void VehicleWheelsDynData::SetTireForceShaderData(int tireId, VehicleDefaultTireParameters parameters)
+{
+	pin_ptr<VehicleDefaultTireParameters> p = &parameters;
+
+	GetShaderData(tireId, VehicleTireModel::Default)->defaultModel = *(VehicleDefaultTireDataUnmanaged*)p;
+}
+void VehicleWheelsDynData::SetTireForceShaderData(int tireId, VehiclePacejkaTireParameters parameters)
+{
+	pin_ptr<VehiclePacejkaTireParameters> p = &parameters;
+
+	GetShaderData(tireId, VehicleTireModel::Pacejka)->pacejka = *(VehiclePacejkaTireDataUnmanaged*)p;
+}
+void VehicleWheelsDynData::SetTireForceShaderData(int tireId, VehicleBrushTireParameters parameters)
+{
+	pin_ptr<VehicleBrushTireParameters> p = &parameters;
+
+	GetShaderData(tireId, VehicleTireModel::Brush)->brush = *(VehicleBrushTireDataUnmanaged*)p;
+}
+
+Nullable<VehicleTireModel> VehicleWheelsDynData::TireModel::get()
+{
+	return _tireModel;
 }
 
-void VehicleWheelsDynData::SetTireForceShaderFunction(IVehicleComputeTireForceInput^ input, IVehicleComputeTireForceOutput^ output)
+int VehicleWheelsDynData::NumberOfWheels::get()
 {
-	throw gcnew NotImplementedException();
+	return _wheels->mWheelsSimData.getNbWheels();
 }
\ No newline at end of file
@@ -1,18 +1,73 @@
 #pragma once
 
+#include "VehicleEnum.h"
+#include "VehicleTireModelParameters.h"
+
+union VehicleTireDataUnmanaged;
+
 namespace PhysX
 {
-	interface class IVehicleComputeTireForceInput;
-	interface class IVehicleComputeTireForceOutput;
-
+	/// <summary>
+	/// Dynamics data of the wheels of a vehicle.
+	/// </summary>
 	public ref class VehicleWheelsDynData
 	{
+	private:
+		PxVehicleWheels* _wheels;
+
+		// The shader data of each tire, owned by us as PhysX only keeps a pointer to it
+		VehicleTireDataUnmanaged* _shaderData;
+		Nullable<VehicleTireModel> _tireModel;
+
+	internal:
+		VehicleWheelsDynData(PxVehicleWheels* wheels);
+
+		// Frees the tire shader data, once the vehicle is no longer updated
+		void ReleaseShaderData();
+
 	public:
+		/// <summary>
+		/// Sets all wheels to their rest state.
+		/// </summary>
 		void SetToRestState();
 
 		/// <summary>
-		/// Set the tire force shader function.
+		/// Sets a native tire force model as the tire force shader of the vehicle.
+		/// Every tire is given default parameters for the model; for the default model these are taken from the tire data
+		/// of the wheel, so the vehicle behaves as it does with the PhysX default shader until the parameters are changed.
+		/// </summary>
+		void SetTireForceShader(VehicleTireModel model);
+
+		/// <summary>
+		/// Sets the parameters of a tire. The default tire model must be the tire force shader.
 		/// </summary>
-		void SetTireForceShaderFunction(IVehicleComputeTireForceInput^ input, IVehicleComputeTireForceOutput^ output);
+		void SetTireForceShaderData(int tireId, VehicleDefaultTireParameters parameters);
+		/// <summary>
+		/// Sets the parameters of a tire. The Pacejka tire model must be the tire force shader.
+		/// </summary>
+		void SetTireForceShaderData(int tireId, VehiclePacejkaTireParameters parameters);
+		/// <summary>
+		/// Sets the parameters of a tire. The brush tire model must be the tire force shader.
+		/// </summary>
+		void SetTireForceShaderData(int tireId, VehicleBrushTireParameters parameters);
+
+		/// <summary>
+		/// Gets the native tire force model set as the tire force shader, or null if the PhysX default shader is used.
+		/// </summary>
+		property Nullable<VehicleTireModel> TireModel
+		{
+			Nullable<VehicleTireModel> get();
+		}
+
+		/// <summary>
+		/// Gets the number of wheels.
+		/// </summary>
+		property int NumberOfWheels
+		{
+			int get();
+		}
+
+	private:
+		VehicleTireDataUnmanaged* GetShaderData(int tireId, VehicleTireModel model);
 	};
 }
\ No newline at end of file
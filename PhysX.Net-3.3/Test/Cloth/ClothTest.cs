@@ -85,5 +85,297 @@ namespace PhysX.Test
 				}
 			}
 		}
+
+		[TestMethod]
+		public void LockParticleViewToCopyPositions()
+		{
+			var clothGrid = new ClothTestGrid(10, 10);
+
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var cloth = CreateCloth(physics.Physics, clothGrid);
+
+				using (var view = cloth.LockParticleView())
+				{
+					Assert.AreEqual(121, view.Count);
+					Assert.AreEqual(clothGrid.Points[5], view.GetPosition(5));
+					Assert.AreEqual(2, view.GetParticle(5).InverseWeight);
+
+					var positions = new Vector3[121];
+					view.CopyPositions(positions, 0);
+
+					CollectionAssert.AreEqual(clothGrid.Points, positions);
+
+					// Position into an interleaved vertex buffer of position, normal and texture coordinate
+					const int stride = 8 * sizeof(float);
+					var vertices = new float[121 * 8];
+					view.CopyPositions(new BoundedData(vertices, 0, 121, stride));
+
+					for (int i = 0; i < 121; i++)
+					{
+						Assert.AreEqual(clothGrid.Points[i], new Vector3(vertices[i * 8], vertices[i * 8 + 1], vertices[i * 8 + 2]));
+						Assert.AreEqual(0, vertices[i * 8 + 3]);
+					}
+				}
+
+				// The view unlocked the data, so it can be locked again
+				using (var view = cloth.LockParticleView())
+				{
+					Assert.AreEqual(121, view.Count);
+				}
+			}
+		}
+
+		[TestMethod]
+		public void ParticleReadbackIsDoubleBuffered()
+		{
+			var clothGrid = new ClothTestGrid(10, 10);
+
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var cloth = CreateCloth(physics.Physics, clothGrid);
+
+				var readback = new ClothParticleReadback(cloth);
+
+				readback.Capture();
+				var first = readback.Positions;
+
+				readback.Capture();
+				var second = readback.Positions;
+
+				Assert.AreNotSame(first, second);
+				Assert.AreEqual(2, readback.CaptureCount);
+				CollectionAssert.AreEqual(clothGrid.Points, second);
+
+				cloth.Dispose();
+
+				Assert.IsTrue(readback.Disposed);
+			}
+		}
+
+		[TestMethod]
+		public void SetParticlesFromOffset()
+		{
+			var clothGrid = new ClothTestGrid(10, 10);
+
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var cloth = CreateCloth(physics.Physics, clothGrid);
+
+				// A shared buffer with the cloth's particles starting at index 7
+				var buffer = new ClothParticle[7 + 121];
+				for (int i = 0; i < 121; i++)
+				{
+					buffer[7 + i] = new ClothParticle(clothGrid.Points[i] + new Vector3(0, 1, 0), 1);
+				}
+
+				cloth.SetParticles(buffer, 7, buffer, 7);
+
+				using (var view = cloth.LockParticleView())
+				{
+					Assert.AreEqual(clothGrid.Points[3] + new Vector3(0, 1, 0), view.GetPosition(3));
+				}
+
+				cloth.SetParticles(null, 0, null, 0);
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void ApplyFrameUpdates()
+		{
+			var clothGrid = new ClothTestGrid(10, 10);
+
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var cloths = new[] { CreateCloth(physics.Physics, clothGrid), CreateCloth(physics.Physics, clothGrid) };
+
+				// One buffer of each kind shared by both cloths
+				var motionConstraints = new ClothParticleMotionConstraint[2 * 121];
+				var spheres = new ClothCollisionSphere[3];
+				var accelerations = new Vector4[2 * 121];
+
+				for (int i = 0; i < motionConstraints.Length; i++)
+				{
+					motionConstraints[i] = new ClothParticleMotionConstraint() { Position = clothGrid.Points[i % 121], Radius = 1 };
+				}
+
+				var updates = new ClothFrameUpdate[4];
+				for (int i = 0; i < cloths.Length; i++)
+				{
+					updates[i] = new ClothFrameUpdate()
+					{
+						Cloth = cloths[i],
+						TargetPose = Matrix4x4.CreateTranslation(i, 0, 0),
+						MotionConstraints = motionConstraints,
+						MotionConstraintsOffset = i * 121,
+						CollisionSpheres = spheres,
+						CollisionSpheresOffset = i,
+						CollisionSphereCount = 2 - i,
+						ParticleAccelerations = accelerations,
+						ParticleAccelerationsOffset = i * 121
+					};
+				}
+
+				Cloth.ApplyFrameUpdates(updates, cloths.Length);
+
+				Assert.AreEqual(121, cloths[0].NumberOfMotionConstraints);
+				Assert.AreEqual(121, cloths[1].NumberOfMotionConstraints);
+				Assert.AreEqual(2, cloths[0].NumberOfCollisionSpheres);
+				Assert.AreEqual(1, cloths[1].NumberOfCollisionSpheres);
+				Assert.AreEqual(121, cloths[1].NumberOfParticleAccelerations);
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void LodManagerLowersDetailWithDistance()
+		{
+			var clothGrid = new ClothTestGrid(10, 10);
+
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var cloth = CreateCloth(physics.Physics, clothGrid);
+				cloth.SolverFrequency = 120;
+
+				var lod = new ClothLodManager()
+				{
+					FullDetailDistance = 10,
+					ReducedDetailDistance = 30,
+					SleepDistance = 60,
+					MinimalSolverFrequency = 30
+				};
+				lod.Add(cloth);
+
+				lod.Update(new[] { new Vector3(0, 0, 5) });
+				Assert.AreEqual(ClothLod.Full, lod.GetLevel(cloth));
+				Assert.AreEqual(120, cloth.SolverFrequency);
+
+				lod.Update(new[] { new Vector3(0, 0, 20) });
+				Assert.AreEqual(ClothLod.Reduced, lod.GetLevel(cloth));
+				Assert.AreEqual(60, cloth.SolverFrequency);
+
+				// The nearest viewer counts
+				lod.Update(new[] { new Vector3(0, 0, 200), new Vector3(0, 0, 40) });
+				Assert.AreEqual(ClothLod.Minimal, lod.GetLevel(cloth));
+				Assert.AreEqual(30, cloth.SolverFrequency);
+
+				lod.Update(new[] { new Vector3(0, 0, 100) });
+				Assert.AreEqual(ClothLod.Asleep, lod.GetLevel(cloth));
+				Assert.IsTrue(cloth.IsSleeping);
+
+				lod.SetVisible(cloth, false);
+				lod.Update(new[] { new Vector3(0, 0, 5) });
+				Assert.AreEqual(ClothLod.Asleep, lod.GetLevel(cloth));
+
+				Assert.IsTrue(lod.Remove(cloth));
+				Assert.AreEqual(120, cloth.SolverFrequency);
+				Assert.IsFalse(cloth.IsSleeping);
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void LodManagerOnlyWakesClothsWhenTheirDetailChanges()
+		{
+			var clothGrid = new ClothTestGrid(10, 10);
+
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var cloth = CreateCloth(physics.Physics, clothGrid);
+				cloth.SolverFrequency = 120;
+
+				var lod = new ClothLodManager();
+				lod.Add(cloth);
+
+				var viewer = new[] { new Vector3(0, 0, 5) };
+
+				lod.Update(viewer);
+				Assert.AreEqual(ClothLod.Full, lod.GetLevel(cloth));
+
+				// A cloth that fell asleep on its own stays asleep while its level doesn't change
+				cloth.PutToSleep();
+
+				lod.Update(viewer);
+				lod.Update(viewer);
+				Assert.IsTrue(cloth.IsSleeping);
+
+				// Lowering the detail changes its solver frequency, which needs it awake
+				lod.Update(new[] { new Vector3(0, 0, 20) });
+				Assert.AreEqual(ClothLod.Reduced, lod.GetLevel(cloth));
+				Assert.IsFalse(cloth.IsSleeping);
+
+				// Coming back from the asleep level wakes it
+				lod.Update(new[] { new Vector3(0, 0, 100) });
+				Assert.IsTrue(cloth.IsSleeping);
+
+				lod.Update(new[] { new Vector3(0, 0, 20) });
+				Assert.AreEqual(ClothLod.Reduced, lod.GetLevel(cloth));
+				Assert.IsFalse(cloth.IsSleeping);
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void LodManagerKeepsToBudget()
+		{
+			var clothGrid = new ClothTestGrid(10, 10);
+
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var near = CreateCloth(physics.Physics, clothGrid);
+				var far = CreateCloth(physics.Physics, clothGrid);
+				far.GlobalPose = Matrix4x4.CreateTranslation(0, 0, 8);
+
+				var lod = new ClothLodManager() { FullDetailDistance = 100, ReducedDetailDistance = 200, SleepDistance = 300 };
+				lod.Add(near);
+				lod.Add(far);
+
+				var viewer = new[] { new Vector3(0, 0, -1) };
+
+				lod.Update(viewer);
+				Assert.AreEqual(ClothLod.Full, lod.GetLevel(far));
+
+				// Calibrate as if both cloths at full detail took 2 ms, then allow only 1.5 ms
+				lod.ReportStepTime(TimeSpan.FromMilliseconds(2));
+				lod.BudgetMilliseconds = 1.5;
+
+				lod.Update(viewer);
+
+				Assert.AreEqual(ClothLod.Full, lod.GetLevel(near));
+				Assert.AreNotEqual(ClothLod.Full, lod.GetLevel(far));
+				Assert.IsTrue(lod.EstimatedCost <= 1.5);
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		private Cloth CreateCloth(Physics physics, ClothTestGrid clothGrid)
+		{
+			using (var cooking = physics.CreateCooking())
+			{
+				var clothMeshDesc = new ClothMeshDesc()
+				{
+					Points = clothGrid.Points,
+					Triangles = ArrayUtil.ToByteArray(clothGrid.Indices)
+				};
+
+				var stream = new MemoryStream();
+
+				cooking.CookClothFabric(clothMeshDesc, new Vector3(0, -9.81f, 0), stream);
+
+				stream.Position = 0;
+
+				var clothFabric = physics.CreateClothFabric(stream);
+
+				var particles = clothGrid.Points.Select(p => new ClothParticle(p, 2)).ToArray();
+
+				return physics.CreateCloth(Matrix4x4.Identity, clothFabric, particles, 0);
+			}
+		}
 	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 ﻿using System;
 using System.Linq;
 using System.Numerics;
+using System.Threading.Tasks;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 
 namespace PhysX.Test.Controller
@@ -50,5 +51,226 @@ namespace PhysX.Test.Controller
 				Assert.AreEqual(ControllerCollisionFlag.Down, controllerState.CollisionFlags);
 			}
 		}
+
+		[TestMethod]
+		public void MoveAll()
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				var controllerManager = core.Scene.CreateControllerManager();
+
+				var material = core.Physics.CreateMaterial(0.1f, 0.1f, 0.1f);
+
+				// Spread out so they can't touch each other
+				var controllers = Enumerable.Range(0, 8)
+					.Select(i => controllerManager.CreateController<CapsuleController>(new CapsuleControllerDesc()
+					{
+						Height = 2,
+						Radius = 0.5f,
+						Material = material,
+						Position = new Vector3(i * 10, 5, 0)
+					}))
+					.Cast<PhysX.Controller>()
+					.ToArray();
+
+				var ground = CreateBoxActor(core.Scene, new Vector3(100, 1, 100), new Vector3(0, 0.5f, 0));
+
+				var displacements = Enumerable.Repeat(new Vector3(0, -0.5f, 0), controllers.Length).ToArray();
+				var results = new ControllerMoveResult[controllers.Length];
+
+				for (int i = 0; i < 10; i++)
+				{
+					controllerManager.MoveAll(controllers, displacements, results, TimeSpan.FromSeconds(1 / 60.0), 0.001f);
+				}
+
+				for (int i = 0; i < controllers.Length; i++)
+				{
+					Assert.AreEqual(ControllerCollisionFlag.Down, results[i].CollisionFlags);
+					Assert.AreEqual(controllers[i].FootPosition, results[i].FootPosition);
+				}
+
+				// Concurrent calls on one manager are serialized, each with its own inputs and results
+				var firstHalf = controllers.Take(4).ToArray();
+				var secondHalf = controllers.Skip(4).ToArray();
+				var firstResults = new ControllerMoveResult[4];
+				var secondResults = new ControllerMoveResult[4];
+
+				Parallel.Invoke
+				(
+					() => controllerManager.MoveAll(firstHalf, displacements, firstResults, TimeSpan.FromSeconds(1 / 60.0), 0.001f),
+					() => controllerManager.MoveAll(secondHalf, displacements, secondResults, TimeSpan.FromSeconds(1 / 60.0), 0.001f)
+				);
+
+				for (int i = 0; i < 4; i++)
+				{
+					Assert.AreEqual(ControllerCollisionFlag.Down, firstResults[i].CollisionFlags);
+					Assert.AreEqual(firstHalf[i].FootPosition, firstResults[i].FootPosition);
+					Assert.AreEqual(ControllerCollisionFlag.Down, secondResults[i].CollisionFlags);
+					Assert.AreEqual(secondHalf[i].FootPosition, secondResults[i].FootPosition);
+				}
+
+				AssertNoPhysXErrors(core);
+			}
+		}
+
+		[TestMethod]
+		public void HitBufferRecordsShapeHits()
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				var controllerManager = core.Scene.CreateControllerManager();
+
+				var hitBuffer = new ControllerHitBuffer(controllerManager, 64);
+				hitBuffer.SetShapeBehaviorFlags(new FilterData(1, 0, 0, 0), ControllerBehaviorFlag.CctCanRideOnObject);
+
+				var controller = controllerManager.CreateController<CapsuleController>(new CapsuleControllerDesc()
+				{
+					Height = 2,
+					Radius = 0.5f,
+					Material = core.Physics.CreateMaterial(0.1f, 0.1f, 0.1f),
+					Position = new Vector3(0, 3, 0),
+					HitBuffer = hitBuffer
+				});
+
+				var box = CreateBoxActor(core.Scene, new Vector3(10, 1, 10), new Vector3(0, 0.5f, 0));
+				box.Shapes.First().QueryFilterData = new FilterData(1, 0, 0, 0);
+
+				for (int i = 0; i < 10; i++)
+				{
+					controller.Move(new Vector3(0, -0.5f, 0), TimeSpan.FromSeconds(1 / 60.0));
+				}
+
+				Assert.IsTrue(hitBuffer.Count > 0);
+				Assert.AreEqual(0, hitBuffer.DroppedCount);
+
+				var hits = new ControllerHitRecord[hitBuffer.Count];
+				Assert.AreEqual(hits.Length, hitBuffer.CopyTo(hits, 0));
+
+				Assert.AreEqual(ControllerHitType.Shape, hits[0].Type);
+				Assert.AreEqual(hits[0].WorldNormal, hitBuffer.GetHit(0).WorldNormal);
+				Assert.AreEqual(controller, hitBuffer.GetController(0));
+				Assert.AreEqual(box.Shapes.First(), hitBuffer.GetShape(0));
+				Assert.IsNull(hitBuffer.GetOtherController(0));
+
+				hitBuffer.Clear();
+
+				Assert.AreEqual(0, hitBuffer.Count);
+
+				AssertNoPhysXErrors(core);
+			}
+		}
+
+		[TestMethod]
+		public void HitBufferBehaviorFlagsAreLookedUpByFilterData()
+		{
+			// Only the platform with the filter data in the table can be ridden
+			Assert.AreEqual(2, RidePlatform(new FilterData(1, 0, 0, 0)), 0.1f);
+			Assert.AreEqual(0, RidePlatform(new FilterData(2, 0, 0, 0)), 0.1f);
+		}
+
+		private float RidePlatform(FilterData platformFilterData)
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				var controllerManager = core.Scene.CreateControllerManager();
+
+				var hitBuffer = new ControllerHitBuffer(controllerManager, 64);
+				hitBuffer.SetShapeBehaviorFlags(new FilterData(1, 0, 0, 0), ControllerBehaviorFlag.CctCanRideOnObject);
+
+				var controller = controllerManager.CreateController<CapsuleController>(new CapsuleControllerDesc()
+				{
+					Height = 2,
+					Radius = 0.5f,
+					Material = core.Physics.CreateMaterial(0.1f, 0.1f, 0.1f),
+					Position = new Vector3(0, 3, 0),
+					HitBuffer = hitBuffer
+				});
+
+				var platform = CreateBoxActor(core.Scene, new Vector3(10, 1, 10), new Vector3(0, 0.5f, 0));
+				platform.Flags = RigidDynamicFlags.Kinematic;
+				platform.Shapes.First().QueryFilterData = platformFilterData;
+
+				// Land on the platform, then move it sideways under the controller
+				for (int i = 0; i < 20; i++)
+				{
+					if (i >= 10)
+						platform.SetKinematicTarget(Matrix4x4.CreateTranslation((i - 9) * 0.2f, 0.5f, 0));
+
+					core.Scene.Simulate(1 / 60.0f);
+					core.Scene.FetchResults(block: true);
+
+					controller.Move(new Vector3(0, -0.5f, 0), TimeSpan.FromSeconds(1 / 60.0));
+				}
+
+				Assert.IsTrue(hitBuffer.Count > 0);
+
+				AssertNoPhysXErrors(core);
+
+				return controller.Position.X;
+			}
+		}
+
+		[TestMethod]
+		public void DisposedHitBufferIsKeptAliveByItsControllers()
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				var controllerManager = core.Scene.CreateControllerManager();
+
+				var hitBuffer = new ControllerHitBuffer(controllerManager, 64);
+
+				var controller = controllerManager.CreateController<CapsuleController>(new CapsuleControllerDesc()
+				{
+					Height = 2,
+					Radius = 0.5f,
+					Material = core.Physics.CreateMaterial(0.1f, 0.1f, 0.1f),
+					Position = new Vector3(0, 3, 0),
+					HitBuffer = hitBuffer
+				});
+
+				CreateBoxActor(core.Scene, new Vector3(10, 1, 10), new Vector3(0, 0.5f, 0));
+
+				hitBuffer.Dispose();
+
+				Assert.IsTrue(hitBuffer.Disposed);
+
+				// The controller still reports its hits to the native buffer
+				for (int i = 0; i < 10; i++)
+				{
+					controller.Move(new Vector3(0, -0.5f, 0), TimeSpan.FromSeconds(1 / 60.0));
+				}
+
+				controller.Dispose();
+
+				AssertNoPhysXErrors(core);
+			}
+		}
+
+		[TestMethod]
+		[ExpectedException(typeof(InvalidOperationException))]
+		public void ReadingCountOfDisposedHitBufferThrows()
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				var controllerManager = core.Scene.CreateControllerManager();
+
+				var hitBuffer = new ControllerHitBuffer(controllerManager, 64);
+
+				var controller = controllerManager.CreateController<CapsuleController>(new CapsuleControllerDesc()
+				{
+					Height = 2,
+					Radius = 0.5f,
+					Material = core.Physics.CreateMaterial(0.1f, 0.1f, 0.1f),
+					HitBuffer = hitBuffer
+				});
+
+				hitBuffer.Dispose();
+
+				// Frees the native buffer
+				controller.Dispose();
+
+				int count = hitBuffer.Count;
+			}
+		}
 	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 ﻿using System;
 using System.Collections.Generic;
 using System.Linq;
+using System.Numerics;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 
 namespace PhysX.Test.Controller
@@ -24,5 +25,43 @@ namespace PhysX.Test.Controller
 				Assert.IsTrue(obstacleContext.Disposed);
 			}
 		}
+
+		[TestMethod]
+		public void UpdateObstacles()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var controllerManager = physics.Scene.CreateControllerManager();
+
+				var obstacleContext = controllerManager.CreateObstacleContext();
+
+				var box = obstacleContext.AddObstacle(new BoxObstacle() { HalfExtents = new Vector3(1, 2, 3) });
+				var capsule = obstacleContext.AddObstacle(new CapsuleObstacle() { Radius = 1, HalfHeight = 2 });
+
+				var rotation = Quaternion.CreateFromAxisAngle(Vector3.UnitY, 0.5f);
+
+				var states = new[]
+				{
+					new ObstacleState() { Position = new Vector3(5, 0, 0), Rotation = rotation, Extents = new Vector3(4, 5, 6) },
+					new ObstacleState() { Position = new Vector3(0, 5, 0), Rotation = rotation, Extents = new Vector3(3, 4, 0) },
+					new ObstacleState()
+				};
+
+				// Pose only, the unknown handle is skipped
+				int updated = obstacleContext.UpdateObstacles(new[] { box, capsule, 12345 }, states);
+
+				Assert.AreEqual(2, updated);
+				Assert.AreEqual(new Vector3(5, 0, 0), obstacleContext.GetObstacleState(box).Position);
+				Assert.AreEqual(new Vector3(1, 2, 3), obstacleContext.GetObstacleState(box).Extents);
+				Assert.AreEqual(new Vector3(1, 2, 0), obstacleContext.GetObstacleState(capsule).Extents);
+
+				obstacleContext.UpdateObstacles(new[] { box, capsule }, states, updateExtents: true);
+
+				Assert.AreEqual(new Vector3(4, 5, 6), obstacleContext.GetObstacleState(box).Extents);
+				Assert.AreEqual(new Vector3(3, 4, 0), obstacleContext.GetObstacleState(capsule).Extents);
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
 	}
 }
\ No newline at end of file
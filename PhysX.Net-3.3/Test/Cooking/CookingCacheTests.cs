@@ -0,0 +1,114 @@
+﻿using System;
+using System.Diagnostics;
+using System.IO;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace PhysX.Test.Cooking
+{
+	[TestClass]
+	public class CookingCacheTests : Test
+	{
+		private string _directory;
+
+		[TestInitialize]
+		public void CreateCacheDirectory()
+		{
+			_directory = Path.Combine(Path.GetTempPath(), "PhysX.Net.CookingCache." + Guid.NewGuid().ToString("N"));
+		}
+
+		[TestCleanup]
+		public void DeleteCacheDirectory()
+		{
+			if (Directory.Exists(_directory))
+				Directory.Delete(_directory, true);
+		}
+
+		[TestMethod]
+		public void SecondCreateIsAHit()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var cooking = physics.Physics.CreateCooking())
+			{
+				var cache = new CookingCache(physics.Physics, cooking, _directory);
+
+				var desc = CookingTestUtil.CreateGridMeshDesc(25);
+
+				var first = cache.CreateTriangleMesh(desc);
+				var second = cache.CreateTriangleMesh(desc);
+
+				Assert.IsNotNull(first);
+				Assert.IsNotNull(second);
+				Assert.AreEqual(1, cache.Misses);
+				Assert.AreEqual(1, cache.Hits);
+				Assert.AreEqual(1, cache.Count);
+				Assert.AreEqual(first.NumberOfTriangles, second.NumberOfTriangles);
+			}
+		}
+
+		[TestMethod]
+		public void CookingParametersArePartOfTheKey()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var cooking = physics.Physics.CreateCooking())
+			{
+				var cache = new CookingCache(physics.Physics, cooking, _directory);
+
+				var desc = CookingTestUtil.CreateGridMeshDesc(10);
+
+				string key = cache.ComputeKey(desc);
+
+				var parameters = cooking.Parameters;
+				parameters.MeshWeldTolerance += 0.1f;
+				cooking.Parameters = parameters;
+
+				Assert.AreNotEqual(key, cache.ComputeKey(desc));
+			}
+		}
+
+		/// <summary>
+		/// Warm start benchmark, a new cache over the same directory (e.g. after a server restart) serves every mesh without cooking.
+		/// </summary>
+		[TestMethod]
+		public void WarmStartFromIndex()
+		{
+			const int meshCount = 20;
+
+			var descs = new TriangleMeshDesc[meshCount];
+			for (int i = 0; i < meshCount; i++)
+				descs[i] = CookingTestUtil.CreateGridMeshDesc(20 + i);
+
+			TimeSpan cold, warm;
+
+			using (var physics = CreatePhysicsAndScene())
+			using (var cooking = physics.Physics.CreateCooking())
+			{
+				var cache = new CookingCache(physics.Physics, cooking, _directory);
+
+				var sw = Stopwatch.StartNew();
+				foreach (var desc in descs)
+					cache.CreateTriangleMesh(desc);
+				cold = sw.Elapsed;
+
+				Assert.AreEqual(meshCount, cache.Misses);
+			}
+
+			using (var physics = CreatePhysicsAndScene())
+			using (var cooking = physics.Physics.CreateCooking())
+			{
+				var cache = new CookingCache(physics.Physics, cooking, _directory);
+
+				Assert.AreEqual(meshCount, cache.Count);
+
+				var sw = Stopwatch.StartNew();
+				foreach (var desc in descs)
+					cache.CreateTriangleMesh(desc);
+				warm = sw.Elapsed;
+
+				Assert.AreEqual(meshCount, cache.Hits);
+				Assert.AreEqual(0, cache.Misses);
+			}
+
+			Trace.WriteLine(String.Format("Cold: {0} ms, warm: {1} ms", cold.TotalMilliseconds, warm.TotalMilliseconds));
+		}
+	}
+}
@@ -0,0 +1,107 @@
+﻿using System;
+using System.Linq;
+using System.Threading.Tasks;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace PhysX.Test.Cooking
+{
+	[TestClass]
+	public class CookingServiceTests : Test
+	{
+		[TestMethod]
+		public void CookManyTriangleMeshes()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var service = new CookingService(physics.Physics, null, 4))
+			{
+				var tasks = Enumerable.Range(0, 16)
+					.Select(i => service.CookTriangleMesh(CookingTestUtil.CreateGridMeshDesc(10 + i)))
+					.ToArray();
+
+				Task.WaitAll(tasks);
+
+				for (int i = 0; i < tasks.Length; i++)
+				{
+					var size = 10 + i;
+
+					Assert.IsNotNull(tasks[i].Result);
+					Assert.AreEqual(size * size * 2, tasks[i].Result.NumberOfTriangles);
+				}
+
+				Assert.AreEqual(0, service.PendingJobs);
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void HighPriorityJobsRunFirst()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var service = new CookingService(physics.Physics, null, 1))
+			{
+				// Occupy the only worker so the rest queue up
+				var blocker = service.CookTriangleMesh(CookingTestUtil.CreateGridMeshDesc(150));
+
+				var low = service.CookTriangleMesh(CookingTestUtil.CreateGridMeshDesc(20), CookingPriority.Low);
+				var high = service.CookTriangleMesh(CookingTestUtil.CreateGridMeshDesc(20), CookingPriority.High);
+
+				var first = Task.WhenAny(low, high).Result;
+
+				Assert.AreSame(high, first);
+
+				Task.WaitAll(blocker, low, high);
+			}
+		}
+
+		[TestMethod]
+		public void DisposeCancelsQueuedJobs()
+		{
+			var physics = CreatePhysicsAndScene();
+
+			Task<TriangleMesh> queued;
+
+			var service = new CookingService(physics.Physics, null, 1);
+			using (service)
+			{
+				service.CookTriangleMesh(CookingTestUtil.CreateGridMeshDesc(150));
+
+				queued = service.CookTriangleMesh(CookingTestUtil.CreateGridMeshDesc(150));
+			}
+
+			Assert.AreEqual(0, service.PendingJobs);
+
+			try
+			{
+				queued.Wait();
+			}
+			catch (AggregateException)
+			{
+			}
+
+			Assert.IsTrue(queued.IsCanceled || queued.IsCompleted);
+
+			physics.Dispose();
+		}
+
+		[TestMethod]
+		[ExpectedException(typeof(ArgumentException))]
+		public void InvalidHeightFieldDescIsRejected()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var service = new CookingService(physics.Physics, null, 1))
+			{
+				var samples = HeightFieldTestUtil.CreateSampleData(10, 10);
+
+				var desc = new HeightFieldDesc()
+				{
+					NumberOfRows = 20,
+					NumberOfColumns = 20,
+					SampleData = new BoundedData(samples, 0, samples.Length, 4)
+				};
+
+				service.CreateHeightField(desc);
+			}
+		}
+	}
+}
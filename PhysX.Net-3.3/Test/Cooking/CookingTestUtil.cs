@@ -0,0 +1,23 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace PhysX.Test.Cooking
+{
+	public static class CookingTestUtil
+	{
+		/// <summary>
+		/// Creates the description of a flat triangle mesh grid of size by size vertices.
+		/// </summary>
+		public static TriangleMeshDesc CreateGridMeshDesc(int size)
+		{
+			var grid = new VertexGrid(size, size);
+
+			return new TriangleMeshDesc()
+			{
+				Points = grid.Points,
+				Triangles = grid.Indices
+			};
+		}
+	}
+}
@@ -2,6 +2,7 @@
 using System.Collections.Generic;
 using System.IO;
 using System.Linq;
+using System.Runtime.InteropServices;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 using PhysX.Test.Util;
 
@@ -34,5 +35,133 @@ namespace PhysX.Test.Cooking
 				}
 			}
 		}
+
+		[TestMethod]
+		public void CreateTriangleMeshFromMappedFile()
+		{
+			string filename = Path.GetTempFileName();
+
+			try
+			{
+				using (var physics = CreatePhysicsAndScene())
+				{
+					var grid = new VertexGrid(25, 25);
+
+					using (var cooking = physics.Physics.CreateCooking())
+					using (var file = File.Create(filename))
+					{
+						var desc = new TriangleMeshDesc()
+						{
+							Points = grid.Points,
+							Triangles = grid.Indices
+						};
+
+						Assert.IsTrue(cooking.CookTriangleMesh(desc, file));
+					}
+
+					var triangleMesh = physics.Physics.CreateTriangleMesh(filename);
+
+					Assert.IsNotNull(triangleMesh);
+					Assert.AreEqual(grid.Indices.Length / 3, triangleMesh.NumberOfTriangles);
+				}
+			}
+			finally
+			{
+				File.Delete(filename);
+			}
+		}
+
+		[TestMethod]
+		public void CookInterleavedVertexBuffer()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var cooking = physics.Physics.CreateCooking())
+			{
+				var grid = new VertexGrid(25, 25);
+
+				// Position, normal and texture coordinate per vertex, as a renderer would lay it out
+				const int floatsPerVertex = 8;
+				var vertices = new float[grid.Points.Length * floatsPerVertex];
+				for (int i = 0; i < grid.Points.Length; i++)
+				{
+					vertices[i * floatsPerVertex + 0] = grid.Points[i].X;
+					vertices[i * floatsPerVertex + 1] = grid.Points[i].Y;
+					vertices[i * floatsPerVertex + 2] = grid.Points[i].Z;
+				}
+
+				var desc = new StridedTriangleMeshDesc()
+				{
+					Points = new BoundedData(vertices, 0, grid.Points.Length, floatsPerVertex * sizeof(float)),
+					Triangles = new BoundedData(grid.Indices, 0, grid.Indices.Length / 3, 3 * sizeof(int))
+				};
+
+				var stream = new MemoryStream();
+
+				Assert.IsTrue(cooking.CookTriangleMesh(desc, stream));
+
+				stream.Position = 0;
+
+				var triangleMesh = physics.Physics.CreateTriangleMesh(stream);
+
+				Assert.AreEqual(grid.Indices.Length / 3, triangleMesh.NumberOfTriangles);
+			}
+		}
+
+		[TestMethod]
+		public void CookTriangleMeshFromNativeMemory()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var cooking = physics.Physics.CreateCooking())
+			{
+				var grid = new VertexGrid(25, 25);
+
+				var points = grid.Points.SelectMany(p => new[] { p.X, p.Y, p.Z }).ToArray();
+				var indices = grid.Indices.Select(i => (short)i).ToArray();
+
+				IntPtr pointData = Marshal.AllocHGlobal(points.Length * sizeof(float));
+				IntPtr indexData = Marshal.AllocHGlobal(indices.Length * sizeof(short));
+
+				try
+				{
+					Marshal.Copy(points, 0, pointData, points.Length);
+					Marshal.Copy(indices, 0, indexData, indices.Length);
+
+					var desc = new StridedTriangleMeshDesc()
+					{
+						Points = new BoundedData(pointData, grid.Points.Length, 3 * sizeof(float)),
+						Triangles = new BoundedData(indexData, indices.Length / 3, 3 * sizeof(short)),
+						Flags = MeshFlag.Indices16Bit
+					};
+
+					var stream = new MemoryStream();
+
+					Assert.IsTrue(cooking.CookTriangleMesh(desc, stream));
+				}
+				finally
+				{
+					Marshal.FreeHGlobal(pointData);
+					Marshal.FreeHGlobal(indexData);
+				}
+			}
+		}
+
+		[TestMethod]
+		[ExpectedException(typeof(ArgumentOutOfRangeException))]
+		public void CookStridedPointsPastEndOfBuffer()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var cooking = physics.Physics.CreateCooking())
+			{
+				var vertices = new float[8];
+
+				var desc = new StridedTriangleMeshDesc()
+				{
+					// 3 points at a stride of 4 floats need 11 floats
+					Points = new BoundedData(vertices, 0, 3, 4 * sizeof(float))
+				};
+
+				cooking.CookTriangleMesh(desc, new MemoryStream());
+			}
+		}
 	}
 }
\ No newline at end of file
@@ -31,6 +31,127 @@ namespace PhysX.Test.Geometry
 			Assert.AreEqual(2.0f, hit.Distance);
 		}
 
+		[TestMethod]
+		public void Overlap()
+		{
+			var sphere = new SphereGeometry(1);
+			var box = new BoxGeometry(2, 2, 2);
+
+			Assert.IsTrue(GeometryQuery.Overlap(sphere, Matrix4x4.CreateTranslation(2.5f, 0, 0), box, Matrix4x4.Identity));
+			Assert.IsFalse(GeometryQuery.Overlap(sphere, Matrix4x4.CreateTranslation(3.5f, 0, 0), box, Matrix4x4.Identity));
+		}
+
+		[TestMethod]
+		public void OverlapBatchMatchesSingleOverlaps()
+		{
+			var sphere = new SphereGeometry(0.5f);
+			var box = new BoxGeometry(5, 1, 5);
+			var boxPose = Matrix4x4.CreateRotationY(0.3f) * Matrix4x4.CreateTranslation(1, 0, 2);
+
+			var random = new Random(3);
+			var poses = new Matrix4x4[10000];
+			for (int i = 0; i < poses.Length; i++)
+				poses[i] = Matrix4x4.CreateTranslation((float)random.NextDouble() * 20 - 10, (float)random.NextDouble() * 4 - 2, (float)random.NextDouble() * 20 - 10);
+
+			var results = new bool[poses.Length];
+
+			int overlaps = GeometryQuery.Overlap(sphere, poses, box, boxPose, results);
+
+			Assert.IsTrue(overlaps > 0 && overlaps < poses.Length);
+			Assert.AreEqual(results.Count(r => r), overlaps);
+
+			for (int i = 0; i < poses.Length; i++)
+				Assert.AreEqual(GeometryQuery.Overlap(sphere, poses[i], box, boxPose), results[i]);
+		}
+
+		[TestMethod]
+		public void Raycast()
+		{
+			var sphere = new SphereGeometry(2);
+
+			var hits = GeometryQuery.Raycast(new Vector3(0, 0, -10), new Vector3(0, 0, 1), sphere, Matrix4x4.Identity, 100);
+
+			Assert.AreEqual(1, hits.Length);
+			Assert.AreEqual(8, hits[0].Distance, 0.001f);
+			Assert.IsTrue((hits[0].Position - new Vector3(0, 0, -2)).Length() < 0.001f);
+
+			var misses = GeometryQuery.Raycast(new Vector3(0, 5, -10), new Vector3(0, 0, 1), sphere, Matrix4x4.Identity, 100);
+
+			Assert.AreEqual(0, misses.Length);
+		}
+
+		[TestMethod]
+		public void RaycastBatch()
+		{
+			var box = new BoxGeometry(1, 1, 1);
+
+			var origins = new[] { new Vector3(-5, 0, 0), new Vector3(-5, 3, 0), new Vector3(0, 10, 0) };
+			var directions = new[] { new Vector3(1, 0, 0), new Vector3(1, 0, 0), new Vector3(0, -1, 0) };
+			var distances = new float[origins.Length];
+			var normals = new Vector3[origins.Length];
+
+			int hits = GeometryQuery.Raycast(origins, directions, box, Matrix4x4.Identity, 100, distances, normals: normals);
+
+			Assert.AreEqual(2, hits);
+			Assert.AreEqual(4, distances[0], 0.001f);
+			Assert.AreEqual(float.MaxValue, distances[1]);
+			Assert.AreEqual(9, distances[2], 0.001f);
+			Assert.AreEqual(new Vector3(-1, 0, 0), normals[0]);
+			Assert.AreEqual(new Vector3(0, 1, 0), normals[2]);
+		}
+
+		[TestMethod]
+		public void ComputePenetration()
+		{
+			var sphere = new SphereGeometry(1);
+
+			Vector3 direction;
+			float depth;
+
+			Assert.IsTrue(GeometryQuery.ComputePenetration(sphere, Matrix4x4.CreateTranslation(1.5f, 0, 0), sphere, Matrix4x4.Identity, out direction, out depth));
+			Assert.AreEqual(0.5f, depth, 0.001f);
+			Assert.IsTrue((direction - new Vector3(1, 0, 0)).Length() < 0.001f);
+
+			var poses = new[] { Matrix4x4.CreateTranslation(1.5f, 0, 0), Matrix4x4.CreateTranslation(0, 5, 0) };
+			var directions = new Vector3[poses.Length];
+			var depths = new float[poses.Length];
+
+			Assert.AreEqual(1, GeometryQuery.ComputePenetration(sphere, poses, sphere, Matrix4x4.Identity, directions, depths));
+			Assert.AreEqual(0.5f, depths[0], 0.001f);
+			Assert.AreEqual(0, depths[1]);
+			Assert.AreEqual(Vector3.Zero, directions[1]);
+		}
+
+		[TestMethod]
+		public void PointDistance()
+		{
+			var box = new BoxGeometry(1, 1, 1);
+
+			Vector3 closestPoint;
+			float distance = GeometryQuery.PointDistance(new Vector3(4, 0, 0), box, Matrix4x4.Identity, out closestPoint);
+
+			Assert.AreEqual(3, distance, 0.001f);
+			Assert.IsTrue((closestPoint - new Vector3(1, 0, 0)).Length() < 0.001f);
+
+			Assert.AreEqual(2, GeometryQuery.PointDistance(new Vector3(0, 3, 0), box, Matrix4x4.Identity), 0.001f);
+
+			var points = new[] { new Vector3(4, 0, 0), new Vector3(0, 0, 0), new Vector3(0, -3, 0) };
+			var distances = new float[points.Length];
+
+			GeometryQuery.PointDistance(points, box, Matrix4x4.Identity, distances);
+
+			Assert.AreEqual(3, distances[0], 0.001f);
+			Assert.AreEqual(0, distances[1], 0.001f);
+			Assert.AreEqual(2, distances[2], 0.001f);
+		}
+
+		[TestMethod]
+		[ExpectedException(typeof(ArgumentException))]
+		public void PointDistanceRejectsUnsupportedGeometry()
+		{
+			GeometryQuery.PointDistance(new Vector3(0, 1, 0), new PlaneGeometry(), Matrix4x4.Identity);
+		}
+
 		[TestMethod]
 		public void GetWorldBounds()
 		{
@@ -1,6 +1,8 @@
 ﻿using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.Linq;
+using System.Numerics;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 
 namespace PhysX.Test
@@ -99,5 +101,223 @@ namespace PhysX.Test
 				}
 			}
 		}
+
+		[TestMethod]
+		public void CreateHeightFieldFromSampleData()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				const int rows = 25, columns = 25;
+				var samples = HeightFieldTestUtil.CreateSampleData(rows, columns);
+
+				var heightFieldDesc = new HeightFieldDesc()
+				{
+					NumberOfRows = rows,
+					NumberOfColumns = columns,
+					SampleData = new BoundedData(samples, 0, samples.Length, 4)
+				};
+
+				using (var heightField = physics.Physics.CreateHeightField(heightFieldDesc))
+				{
+					var saved = heightField.GetSamples();
+
+					Assert.AreEqual(rows * columns, saved.Length);
+					for (int i = 0; i < samples.Length; i++)
+						Assert.AreEqual(samples[i].Height, saved[i].Height);
+				}
+
+				AssertNoPhysXErrors(physics.Physics);
+			}
+		}
+
+		[TestMethod]
+		public void TooFewSamplesMakeTheDescriptionInvalid()
+		{
+			var samples = HeightFieldTestUtil.CreateSampleData(10, 10);
+
+			var heightFieldDesc = new HeightFieldDesc()
+			{
+				NumberOfRows = 20,
+				NumberOfColumns = 20,
+				SampleData = new BoundedData(samples, 0, samples.Length, 4)
+			};
+
+			Assert.IsFalse(heightFieldDesc.IsValid());
+		}
+
+		[TestMethod]
+		public void ModifySamplesDigsACrater()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				const int rows = 32, columns = 32;
+				var samples = new HeightFieldSampleData[rows * columns];
+				for (int i = 0; i < samples.Length; i++)
+					samples[i].Height = 100;
+
+				var heightFieldDesc = new HeightFieldDesc()
+				{
+					NumberOfRows = rows,
+					NumberOfColumns = columns,
+					SampleData = new BoundedData(samples, 0, samples.Length, 4)
+				};
+
+				using (var heightField = physics.Physics.CreateHeightField(heightFieldDesc))
+				{
+					// A 4x4 hole starting at row 10, column 12
+					var crater = new HeightFieldSampleData[4 * 4];
+					for (int i = 0; i < crater.Length; i++)
+						crater[i].Height = -50;
+
+					Assert.IsTrue(heightField.ModifySamples(12, 10, 4, 4, crater, shrinkBounds: true));
+
+					Assert.AreEqual(-50, heightField.GetHeight(11, 13), 0.001f);
+					Assert.AreEqual(100, heightField.GetHeight(5, 5), 0.001f);
+
+					var saved = heightField.GetSamples();
+					Assert.AreEqual(-50, saved[10 * columns + 12].Height);
+					Assert.AreEqual(-50, saved[13 * columns + 15].Height);
+					Assert.AreEqual(100, saved[14 * columns + 15].Height);
+					Assert.AreEqual(100, saved[13 * columns + 16].Height);
+				}
+
+				AssertNoPhysXErrors(physics.Physics);
+			}
+		}
+
+		[TestMethod]
+		public void SampleHeightsMatchesGetHeight()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				const int rows = 40, columns = 30;
+				var samples = HeightFieldTestUtil.CreateSampleData(rows, columns);
+
+				// Alternate the tesselation so both diagonals are covered
+				for (int i = 0; i < samples.Length; i += 2)
+					samples[i].MaterialIndex0 = new BitAndByte(0, true);
+
+				var heightFieldDesc = new HeightFieldDesc()
+				{
+					NumberOfRows = rows,
+					NumberOfColumns = columns,
+					SampleData = new BoundedData(samples, 0, samples.Length, 4)
+				};
+
+				using (var heightField = physics.Physics.CreateHeightField(heightFieldDesc))
+				{
+					var random = new Random(5);
+
+					var xz = new Vector2[20000];
+					for (int i = 0; i < xz.Length; i++)
+						xz[i] = new Vector2((float)random.NextDouble() * (rows - 1), (float)random.NextDouble() * (columns - 1));
+
+					var heights = new float[xz.Length];
+					var parallelHeights = new float[xz.Length];
+
+					heightField.SampleHeights(xz, heights);
+					heightField.SampleHeights(xz, parallelHeights, parallel: true);
+
+					for (int i = 0; i < xz.Length; i++)
+					{
+						Assert.AreEqual(heightField.GetHeight(xz[i].X, xz[i].Y), heights[i], 0.01f);
+						Assert.AreEqual(heights[i], parallelHeights[i]);
+					}
+				}
+
+				AssertNoPhysXErrors(physics.Physics);
+			}
+		}
+
+		[TestMethod]
+		public void SampleSurfaceOfSlope()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				const int rows = 10, columns = 10;
+
+				// Rises by 2 per row
+				var samples = new HeightFieldSampleData[rows * columns];
+				for (int r = 0; r < rows; r++)
+				{
+					for (int c = 0; c < columns; c++)
+						samples[r * columns + c] = new HeightFieldSampleData((short)(r * 2), new BitAndByte(3, false), new BitAndByte(4, false));
+				}
+
+				var heightFieldDesc = new HeightFieldDesc()
+				{
+					NumberOfRows = rows,
+					NumberOfColumns = columns,
+					SampleData = new BoundedData(samples, 0, samples.Length, 4)
+				};
+
+				using (var heightField = physics.Physics.CreateHeightField(heightFieldDesc))
+				{
+					var xz = new[] { new Vector2(2.5f, 4.2f), new Vector2(7.1f, 0.3f), new Vector2(50, -3) };
+					var heights = new float[xz.Length];
+					var normals = new Vector3[xz.Length];
+					var materials = new short[xz.Length];
+
+					heightField.SampleSurface(xz, heights, normals, materials);
+
+					Assert.AreEqual(5, heights[0], 0.001f);
+					Assert.AreEqual(14.2f, heights[1], 0.001f);
+
+					// Clamped to the last row
+					Assert.AreEqual(18, heights[2], 0.001f);
+
+					var expected = Vector3.Normalize(new Vector3(-2, 1, 0));
+					foreach (var normal in normals)
+						Assert.IsTrue((normal - expected).Length() < 0.001f);
+
+					foreach (var material in materials)
+						Assert.IsTrue(material == 3 || material == 4);
+				}
+
+				AssertNoPhysXErrors(physics.Physics);
+			}
+		}
+
+		/// <summary>
+		/// Large terrain benchmark, compares creating a height field from sample objects against packed sample data.
+		/// </summary>
+		[TestMethod]
+		public void CreateLargeHeightFieldFromObjectsAndSampleData()
+		{
+			const int rows = 2048, columns = 2048;
+
+			using (var physics = CreatePhysicsAndScene())
+			{
+				long before = GC.GetTotalMemory(true);
+				var sw = Stopwatch.StartNew();
+
+				var objects = HeightFieldTestUtil.CreateSampleGrid(rows, columns);
+				long objectBytes = GC.GetTotalMemory(false) - before;
+
+				using (physics.Physics.CreateHeightField(new HeightFieldDesc() { NumberOfRows = rows, NumberOfColumns = columns, Samples = objects }))
+				{
+				}
+				var objectTime = sw.Elapsed;
+
+				objects = null;
+
+				before = GC.GetTotalMemory(true);
+				sw.Restart();
+
+				var data = HeightFieldTestUtil.CreateSampleData(rows, columns);
+				long dataBytes = GC.GetTotalMemory(false) - before;
+
+				using (physics.Physics.CreateHeightField(new HeightFieldDesc() { NumberOfRows = rows, NumberOfColumns = columns, SampleData = new BoundedData(data, 0, data.Length, 4) }))
+				{
+				}
+				var dataTime = sw.Elapsed;
+
+				Assert.IsTrue(dataBytes < objectBytes);
+
+				Trace.WriteLine(String.Format("Sample objects: {0} ms, {1} MB", objectTime.TotalMilliseconds, objectBytes >> 20));
+				Trace.WriteLine(String.Format("Sample data: {0} ms, {1} MB", dataTime.TotalMilliseconds, dataBytes >> 20));
+				Trace.WriteLine(String.Format("Peak working set: {0} MB", Process.GetCurrentProcess().PeakWorkingSet64 >> 20));
+			}
+		}
 	}
 }
\ No newline at end of file
@@ -28,5 +28,22 @@ namespace PhysX.Test
 
 			return samples;
 		}
+
+		public static HeightFieldSampleData[] CreateSampleData(int rows, int columns, short height = 100)
+		{
+			var samples = new HeightFieldSampleData[rows * columns];
+
+			for (int r = 0; r < rows; r++)
+			{
+				for (int c = 0; c < columns; c++)
+				{
+					double h = System.Math.Sin(c) * System.Math.Cos(r) * height;
+
+					samples[r * columns + c].Height = (short)h;
+				}
+			}
+
+			return samples;
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Numerics;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace PhysX.Test
+{
+	[TestClass]
+	public class TerrainPagerTest : Test
+	{
+		[TestMethod]
+		public void LoadsTilesAroundPointOfInterest()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var material = physics.Physics.CreateMaterial(0.5f, 0.5f, 0.1f);
+
+				using (var pager = new TerrainPager(physics.Scene, material, CreateTile, 10))
+				{
+					pager.Update(new[] { new Vector3(5, 0, 5) }, waitForTiles: true);
+
+					// The tiles with a negative coordinate have no terrain
+					Assert.AreEqual(4, pager.ActiveTileCount);
+					Assert.AreEqual(0, pager.PendingTileCount);
+					Assert.IsTrue(pager.IsTileActive(0, 0));
+					Assert.IsTrue(pager.IsTileActive(1, 1));
+					Assert.IsFalse(pager.IsTileActive(-1, 0));
+					Assert.IsNull(pager.GetTileActor(-1, 0));
+
+					var actor = pager.GetTileActor(1, 0);
+					Assert.AreEqual(physics.Scene, actor.Scene);
+					Assert.AreEqual(new Vector3(10, 0, 0), actor.GlobalPose.Translation);
+				}
+
+				AssertNoPhysXErrors(physics.Physics);
+			}
+		}
+
+		[TestMethod]
+		public void TilesLeftBehindAreRemovedAndEvicted()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var material = physics.Physics.CreateMaterial(0.5f, 0.5f, 0.1f);
+
+				using (var pager = new TerrainPager(physics.Scene, material, CreateTile, 10))
+				{
+					pager.MaximumCachedTiles = 2;
+
+					pager.Update(new[] { new Vector3(5, 0, 5) }, waitForTiles: true);
+
+					var actor = pager.GetTileActor(1, 1);
+
+					pager.Update(new[] { new Vector3(1005, 0, 1005) }, waitForTiles: true);
+
+					Assert.AreEqual(9, pager.ActiveTileCount);
+					Assert.AreEqual(2, pager.CachedTileCount);
+					Assert.IsFalse(pager.IsTileActive(0, 0));
+					Assert.IsTrue(pager.IsTileActive(100, 100));
+
+					// The nearest tiles are evicted last, so (1, 1) is still cached but out of the scene
+					Assert.IsFalse(actor.Disposed);
+					Assert.AreEqual(9, physics.Scene.GetNumberOfActors(ActorTypeSelectionFlag.RigidStatic));
+
+					// Coming back puts the cached tile back without loading it again
+					pager.Update(new[] { new Vector3(5, 0, 5) });
+
+					Assert.IsTrue(pager.IsTileActive(1, 1));
+					Assert.AreEqual(actor, pager.GetTileActor(1, 1));
+				}
+
+				AssertNoPhysXErrors(physics.Physics);
+			}
+		}
+
+		[TestMethod]
+		public void DisposingThePagerDisposesTheTiles()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var material = physics.Physics.CreateMaterial(0.5f, 0.5f, 0.1f);
+
+				RigidStatic actor;
+				using (var pager = new TerrainPager(physics.Scene, material, CreateTile, 10))
+				{
+					pager.Update(new[] { new Vector3(5, 0, 5) }, waitForTiles: true);
+
+					actor = pager.GetTileActor(0, 0);
+				}
+
+				Assert.IsTrue(actor.Disposed);
+				Assert.AreEqual(0, physics.Scene.GetNumberOfActors(ActorTypeSelectionFlag.RigidStatic));
+			}
+		}
+
+		private static HeightFieldDesc CreateTile(int tileX, int tileZ)
+		{
+			if (tileX < 0 || tileZ < 0)
+				return null;
+
+			const int rows = 9, columns = 9;
+			var samples = HeightFieldTestUtil.CreateSampleData(rows, columns);
+
+			return new HeightFieldDesc()
+			{
+				NumberOfRows = rows,
+				NumberOfColumns = columns,
+				SampleData = new BoundedData(samples, 0, samples.Length, 4)
+			};
+		}
+	}
+}
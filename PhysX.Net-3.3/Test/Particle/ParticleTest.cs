@@ -1,6 +1,7 @@
 ﻿using System;
 using System.Collections.Generic;
 using System.Linq;
+using System.Numerics;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 using PhysX;
 
@@ -45,5 +46,364 @@ namespace PhysX.Test
 				Assert.IsTrue(fluid.Disposed);
 			}
 		}
+
+		[TestMethod]
+		public void ReadParticlesSkipsReleasedParticles()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				ParticleSystem particleSystem = physics.Physics.CreateParticleSystem(100);
+
+				var positions = new Vector3[40];
+				for (int i = 0; i < positions.Length; i++)
+				{
+					positions[i] = new Vector3(i, 0, 0);
+				}
+
+				particleSystem.CreateParticles(new ParticleCreationData()
+				{
+					NumberOfParticles = positions.Length,
+					PositionBuffer = positions,
+					IndexBuffer = Enumerable.Range(0, positions.Length).ToArray()
+				});
+
+				// Punch holes in the first and second bitmap words
+				particleSystem.ReleaseParticles(3, new uint[] { 0, 7, 33 });
+
+				using (var data = particleSystem.LockParticleReadData())
+				{
+					Assert.AreEqual(37, data.NumberOfValidParticles);
+
+					var readPositions = new Vector3[50];
+					var readIndices = new int[50];
+
+					int count = data.ReadParticles(readPositions, null, readIndices, 5);
+
+					Assert.AreEqual(37, count);
+					CollectionAssert.AreEqual(Enumerable.Range(0, 40).Except(new[] { 0, 7, 33 }).ToArray(), readIndices.Skip(5).Take(count).ToArray());
+
+					for (int i = 0; i < count; i++)
+					{
+						Assert.AreEqual(new Vector3(readIndices[5 + i], 0, 0), readPositions[5 + i]);
+					}
+
+					CollectionAssert.AreEqual(readPositions.Skip(5).Take(count).ToArray(), data.GetPositions());
+
+					data.Unlock();
+				}
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void CreateAndReleaseParticlesThroughIndexPool()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				ParticleSystem particleSystem = physics.Physics.CreateParticleSystem(8);
+
+				var positions = new Vector3[10];
+				var indices = new int[10];
+
+				// Only 8 indices are free
+				int created = particleSystem.CreateParticles
+				(
+					positions: new BoundedData(positions, 0, positions.Length, 12),
+					indices: new BoundedData(indices, 0, indices.Length, 4)
+				);
+
+				Assert.AreEqual(8, created);
+				Assert.AreEqual(8, particleSystem.IndexPool.AllocatedCount);
+				CollectionAssert.AreEquivalent(Enumerable.Range(0, 8).ToArray(), indices.Take(8).ToArray());
+
+				// Release two particles, their indices are reused by the next creation
+				particleSystem.ReleaseParticles(new BoundedData(indices, 0, 2, 4));
+
+				Assert.AreEqual(6, particleSystem.IndexPool.AllocatedCount);
+
+				var moved = new[] { new Vector3(1, 2, 3), new Vector3(4, 5, 6) };
+				var reused = new int[2];
+
+				created = particleSystem.CreateParticles(new BoundedData(moved, 0, 2, 12), indices: new BoundedData(reused, 0, 2, 4));
+
+				Assert.AreEqual(2, created);
+				CollectionAssert.AreEquivalent(indices.Take(2).ToArray(), reused);
+
+				particleSystem.SetPositions(new BoundedData(new[] { new Vector3(7, 8, 9) }, 0, 1, 12), new BoundedData(reused, 4, 1, 4));
+
+				using (var data = particleSystem.LockParticleReadData())
+				{
+					var readPositions = new Vector3[8];
+					var readIndices = new int[8];
+
+					Assert.AreEqual(8, data.ReadParticles(readPositions, null, readIndices));
+					Assert.AreEqual(new Vector3(1, 2, 3), readPositions[Array.IndexOf(readIndices, reused[0])]);
+					Assert.AreEqual(new Vector3(7, 8, 9), readPositions[Array.IndexOf(readIndices, reused[1])]);
+
+					data.Unlock();
+				}
+
+				particleSystem.ReleaseParticles();
+
+				Assert.AreEqual(0, particleSystem.IndexPool.AllocatedCount);
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void EmitterEmitsAndRecyclesParticles()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				ParticleSystem particleSystem = physics.Physics.CreateParticleSystem(100);
+
+				var emitter = new ParticleEmitter(particleSystem, 50)
+				{
+					Type = ParticleEmitterType.ConstantFlowRate,
+					Shape = ParticleEmitterShape.Ellipse,
+					DimensionX = 1,
+					DimensionY = 2,
+					LocalPose = Matrix4x4.CreateTranslation(0, 10, 0),
+					Rate = 100,
+					ParticleLifetime = 0.25f
+				};
+
+				CollectionAssert.AreEqual(new[] { emitter }, particleSystem.Emitters.ToArray());
+
+				Assert.AreEqual(10, particleSystem.UpdateEmitters(0.1f));
+				Assert.AreEqual(10, emitter.ParticleCount);
+				Assert.AreEqual(10, particleSystem.IndexPool.AllocatedCount);
+
+				particleSystem.UpdateEmitters(0.1f);
+				particleSystem.UpdateEmitters(0.1f);
+
+				// The first 10 particles have expired and been released
+				particleSystem.UpdateEmitters(0.1f);
+
+				Assert.AreEqual(30, emitter.ParticleCount);
+				Assert.AreEqual(30, particleSystem.IndexPool.AllocatedCount);
+
+				using (var data = particleSystem.LockParticleReadData())
+				{
+					Assert.AreEqual(30, data.NumberOfValidParticles);
+
+					foreach (var p in data.GetPositions())
+					{
+						// Inside the ellipse in the XY plane of the pose
+						Assert.AreEqual(0, p.Z, 0.001f);
+						Assert.IsTrue(p.X * p.X + (p.Y - 10) * (p.Y - 10) / 4 <= 1.001f);
+					}
+
+					data.Unlock();
+				}
+
+				emitter.ReleaseParticles();
+
+				Assert.AreEqual(0, emitter.ParticleCount);
+				Assert.AreEqual(0, particleSystem.IndexPool.AllocatedCount);
+
+				emitter.Dispose();
+
+				Assert.AreEqual(0, particleSystem.Emitters.Count());
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void EmittersForgetParticlesReleasedWithTheParticleSystem()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				ParticleSystem particleSystem = physics.Physics.CreateParticleSystem(100);
+
+				var emitter = new ParticleEmitter(particleSystem, 50)
+				{
+					Type = ParticleEmitterType.ConstantFlowRate,
+					Rate = 100,
+					ParticleLifetime = 0.25f
+				};
+
+				particleSystem.UpdateEmitters(0.1f);
+				particleSystem.UpdateEmitters(0.1f);
+
+				Assert.AreEqual(20, emitter.ParticleCount);
+
+				particleSystem.ReleaseParticles();
+
+				Assert.AreEqual(0, emitter.ParticleCount);
+				Assert.AreEqual(0, particleSystem.IndexPool.AllocatedCount);
+
+				// The indices of the released particles are reused, expiring them again would release the new particles
+				Assert.AreEqual(10, particleSystem.UpdateEmitters(0.1f));
+				particleSystem.UpdateEmitters(0.1f);
+				particleSystem.UpdateEmitters(0.1f);
+				particleSystem.UpdateEmitters(0.1f);
+
+				Assert.AreEqual(30, emitter.ParticleCount);
+				Assert.AreEqual(30, particleSystem.IndexPool.AllocatedCount);
+
+				using (var data = particleSystem.LockParticleReadData())
+				{
+					Assert.AreEqual(30, data.NumberOfValidParticles);
+
+					data.Unlock();
+				}
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void EmitterReleasesParticlesAfterLifetimeChanges()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				ParticleSystem particleSystem = physics.Physics.CreateParticleSystem(100);
+
+				var emitter = new ParticleEmitter(particleSystem, 50)
+				{
+					Type = ParticleEmitterType.ConstantFlowRate,
+					Rate = 100
+				};
+
+				// These particles live until they are released explicitly
+				particleSystem.UpdateEmitters(0.1f);
+
+				emitter.ParticleLifetime = 0.25f;
+
+				particleSystem.UpdateEmitters(0.1f);
+				particleSystem.UpdateEmitters(0.1f);
+				particleSystem.UpdateEmitters(0.1f);
+
+				Assert.AreEqual(40, emitter.ParticleCount);
+
+				// The first particles with a lifetime expire, behind the older ones without
+				particleSystem.UpdateEmitters(0.1f);
+
+				Assert.AreEqual(40, emitter.ParticleCount);
+				Assert.AreEqual(40, particleSystem.IndexPool.AllocatedCount);
+
+				// Shorter lived particles expire ahead of the longer lived ones emitted before them
+				emitter.ParticleLifetime = 0.05f;
+
+				particleSystem.UpdateEmitters(0.1f);
+				particleSystem.UpdateEmitters(0.1f);
+
+				Assert.AreEqual(30, emitter.ParticleCount);
+				Assert.AreEqual(30, particleSystem.IndexPool.AllocatedCount);
+
+				using (var data = particleSystem.LockParticleReadData())
+				{
+					Assert.AreEqual(30, data.NumberOfValidParticles);
+
+					data.Unlock();
+				}
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void ExtractFluidSurfaceOfParticleCube()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				ParticleSystem particleSystem = physics.Physics.CreateParticleSystem(1000);
+
+				// A 10x10x10 cube of particles 0.1 apart, centered on the origin
+				var positions = new Vector3[1000];
+				for (int i = 0; i < positions.Length; i++)
+				{
+					positions[i] = new Vector3(i % 10, (i / 10) % 10, i / 100) * 0.1f - new Vector3(0.45f);
+				}
+
+				particleSystem.CreateParticles(new BoundedData(positions, 0, positions.Length, 12));
+
+				using (var extractor = new FluidSurfaceExtractor() { CellSize = 0.05f, ParticleRadius = 0.2f })
+				using (var data = particleSystem.LockParticleReadData())
+				{
+					extractor.MaximumBlocks = 1;
+					int serialTriangles = extractor.Extract(data);
+
+					extractor.MaximumBlocks = 4;
+					int triangles = extractor.Extract(data);
+
+					data.Unlock();
+
+					// Blocks only duplicate vertices on their seams, the triangles are the same
+					Assert.IsTrue(triangles > 0);
+					Assert.AreEqual(serialTriangles, triangles);
+					Assert.AreEqual(triangles * 3, extractor.IndexCount);
+
+					var vertices = new Vector3[extractor.VertexCount];
+					var normals = new Vector3[extractor.VertexCount];
+					var indices = new int[extractor.IndexCount];
+
+					extractor.WriteMesh(vertices, normals, indices);
+
+					Assert.IsTrue(indices.All(i => i >= 0 && i < vertices.Length));
+
+					for (int i = 0; i < vertices.Length; i++)
+					{
+						// The surface wraps the cube, within the particle radius, with normals pointing away from it
+						Assert.IsTrue(Math.Abs(vertices[i].X) <= 0.65f && Math.Abs(vertices[i].Y) <= 0.65f && Math.Abs(vertices[i].Z) <= 0.65f);
+						Assert.IsTrue(Math.Max(Math.Abs(vertices[i].X), Math.Max(Math.Abs(vertices[i].Y), Math.Abs(vertices[i].Z))) >= 0.45f);
+						Assert.AreEqual(1, normals[i].Length(), 0.001f);
+						Assert.IsTrue(Vector3.Dot(normals[i], vertices[i]) > 0);
+					}
+				}
+			}
+		}
+
+		[TestMethod]
+		[ExpectedException(typeof(ArgumentOutOfRangeException))]
+		public void FluidSurfaceGridSizeIsLimited()
+		{
+			using (var extractor = new FluidSurfaceExtractor())
+			{
+				extractor.MaximumCellsPerAxis = FluidSurfaceExtractor.MaximumCellsPerAxisLimit;
+
+				// A grid of 2049^3 nodes doesn't fit in 32 bits
+				extractor.MaximumCellsPerAxis = 2048;
+			}
+		}
+
+		[TestMethod]
+		public void ReadParticlesInterleaved()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				ParticleSystem particleSystem = physics.Physics.CreateParticleSystem(10);
+
+				particleSystem.CreateParticles(new ParticleCreationData()
+				{
+					NumberOfParticles = 3,
+					PositionBuffer = new[] { new Vector3(1, 2, 3), new Vector3(4, 5, 6), new Vector3(7, 8, 9) },
+					IndexBuffer = new[] { 2, 4, 6 }
+				});
+
+				using (var data = particleSystem.LockParticleReadData())
+				{
+					// Position and index per vertex, 4 floats wide
+					var vertices = new float[4 * 3];
+
+					int count = data.ReadParticles
+					(
+						positions: new BoundedData(vertices, 0, 3, 16),
+						indices: new BoundedData(vertices, 12, 3, 16)
+					);
+
+					Assert.AreEqual(3, count);
+					Assert.AreEqual(4f, vertices[4]);
+					Assert.AreEqual(9f, vertices[10]);
+					Assert.AreEqual(6, BitConverter.ToInt32(BitConverter.GetBytes(vertices[11]), 0));
+
+					data.Unlock();
+				}
+			}
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,89 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Numerics;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace PhysX.Test
+{
+	[TestClass]
+	public class CullActorsTests : Test
+	{
+		[TestMethod]
+		public void CullActorsWithFrustum()
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				var ahead = CreateBoxActor(core.Scene, 0, 2, 20);
+				var behind = CreateBoxActor(core.Scene, 0, 2, -20);
+				var aside = CreateBoxActor(core.Scene, 50, 2, 20);
+				var tooFar = CreateBoxActor(core.Scene, 0, 2, 200);
+
+				var results = new Actor[10];
+
+				int count = core.Scene.CullActors(new[] { CreateViewProjection(new Vector3(0, 0, 1)) }, results);
+
+				Assert.AreEqual(1, count);
+				Assert.AreEqual(ahead, results[0]);
+			}
+		}
+
+		[TestMethod]
+		public void CullActorsWithSeveralFrusta()
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				var ahead = CreateBoxActor(core.Scene, 0, 2, 20);
+				var behind = CreateBoxActor(core.Scene, 0, 2, -20);
+				var both = CreateBoxActor(core.Scene, 0, 2, 0);
+
+				var frusta = new[] { CreateViewProjection(new Vector3(0, 0, 1)), CreateViewProjection(new Vector3(0, 0, -1)) };
+
+				var results = new Actor[10];
+				var masks = new int[10];
+
+				int count = core.Scene.CullActors(frusta, results, masks);
+
+				Assert.AreEqual(3, count);
+
+				var visibility = Enumerable.Range(0, count).ToDictionary(i => results[i], i => masks[i]);
+
+				Assert.AreEqual(1, visibility[ahead]);
+				Assert.AreEqual(2, visibility[behind]);
+				Assert.AreEqual(3, visibility[both]);
+			}
+		}
+
+		[TestMethod]
+		public void CullActorsWithPlanesIntoSmallBuffer()
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				for (int i = 0; i < 5; i++)
+					CreateBoxActor(core.Scene, i * 10, 0, 0);
+
+				// The half space x < 25
+				var planes = new[] { new Plane(new Vector3(1, 0, 0), -25) };
+				var bounds = new Bounds3(new Vector3(-100, -100, -100), new Vector3(100, 100, 100));
+
+				var results = new Actor[2];
+
+				int count = core.Scene.CullActors(planes, bounds, results);
+
+				Assert.AreEqual(3, count);
+				Assert.IsNotNull(results[0]);
+				Assert.IsNotNull(results[1]);
+			}
+		}
+
+		private static Matrix4x4 CreateViewProjection(Vector3 direction)
+		{
+			var eye = new Vector3(0, 2, 0);
+
+			var view = Matrix4x4.CreateLookAt(eye, eye + direction, Vector3.UnitY);
+			var projection = Matrix4x4.CreatePerspectiveFieldOfView((float)Math.PI / 2, 1, 0.1f, 100);
+
+			return view * projection;
+		}
+	}
+}
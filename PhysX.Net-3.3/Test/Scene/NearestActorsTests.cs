@@ -0,0 +1,73 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Numerics;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace PhysX.Test
+{
+	[TestClass]
+	public class NearestActorsTests : Test
+	{
+		[TestMethod]
+		public void FindNearestActors()
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				var actors = Enumerable.Range(1, 5).Select(i => CreateBoxActor(core.Scene, i * 10, 0, 0)).ToArray();
+
+				var results = new Actor[2];
+				var distances = new float[2];
+
+				int count = core.Scene.FindNearestActors(new Vector3(22, 0, 0), 100, results, distances);
+
+				Assert.AreEqual(2, count);
+				Assert.AreEqual(actors[1], results[0]);
+				Assert.AreEqual(actors[2], results[1]);
+
+				// Distances are to the closest point of the 5x5x5 boxes
+				Assert.AreEqual(0, distances[0], 0.001f);
+				Assert.AreEqual(5.5f, distances[1], 0.001f);
+			}
+		}
+
+		[TestMethod]
+		public void FindActorsWithinRadiusIntoSmallBuffer()
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				var actors = Enumerable.Range(0, 5).Select(i => CreateBoxActor(core.Scene, i * 10, 0, 0)).ToArray();
+
+				var results = new Actor[2];
+
+				int count = core.Scene.FindActorsWithinRadius(new Vector3(0, 0, 0), 20, results);
+
+				Assert.AreEqual(3, count);
+				Assert.AreEqual(actors[0], results[0]);
+				Assert.AreEqual(actors[1], results[1]);
+			}
+		}
+
+		[TestMethod]
+		public void FindNearestDynamicActors()
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				var material = core.Physics.CreateMaterial(0.5f, 0.5f, 0.1f);
+
+				var wall = core.Physics.CreateRigidStatic(Matrix4x4.CreateTranslation(1, 0, 0));
+				wall.CreateShape(new BoxGeometry(1, 1, 1), material);
+				core.Scene.AddActor(wall);
+
+				var box = CreateBoxActor(core.Scene, 10, 0, 0);
+
+				var results = new Actor[4];
+
+				int count = core.Scene.FindNearestActors(Vector3.Zero, 50, results, null, new QueryFilterData(QueryFlag.Dynamic));
+
+				Assert.AreEqual(1, count);
+				Assert.AreEqual(box, results[0]);
+			}
+		}
+	}
+}
@@ -40,6 +40,77 @@ namespace PhysX.Test.Serialization
 			}
 		}
 
+		[TestMethod]
+		public void DeserializeBinaryCollectionFromMappedFile()
+		{
+			string filename = Path.GetTempFileName();
+
+			try
+			{
+				// Serialize
+				using (var core = CreatePhysicsAndScene())
+				{
+					var box = CreateBoxActor(core.Scene, 5, 5, 5);
+
+					var collection = core.Physics.CreateCollection();
+					collection.Add(box);
+
+					var sr = PhysX.Serialization.CreateSerializationRegistry(core.Physics);
+
+					PhysX.Serialization.Complete(collection, sr);
+
+					using (var file = File.Create(filename))
+					{
+						bool result = PhysX.Serialization.SerializeCollectionToBinary(file, collection, sr);
+
+						Assert.IsTrue(result);
+					}
+				}
+
+				// Deserialize
+				using (var core = CreatePhysicsAndScene())
+				{
+					var sr = PhysX.Serialization.CreateSerializationRegistry(core.Physics);
+
+					var collection = PhysX.Serialization.CreateCollectionFromBinary(filename, sr);
+
+					Assert.IsNotNull(collection);
+					Assert.IsTrue(collection.NumberOfObjects >= 3); // Actor, shape and material
+					AssertNoPhysXErrors(core);
+				}
+			}
+			finally
+			{
+				File.Delete(filename);
+			}
+		}
+
+		[TestMethod]
+		public void FailedSerializationLeavesStreamUnchanged()
+		{
+			using (var core = CreatePhysicsAndScene())
+			{
+				var box = CreateBoxActor(core.Scene, 5, 5, 5);
+
+				// Not completed, so the shape and material the actor needs are missing
+				var collection = core.Physics.CreateCollection();
+				collection.Add(box);
+
+				var sr = PhysX.Serialization.CreateSerializationRegistry(core.Physics);
+
+				using (var stream = new MemoryStream())
+				{
+					stream.Write(new byte[] { 1, 2, 3 }, 0, 3);
+
+					bool result = PhysX.Serialization.SerializeCollectionToBinary(stream, collection, sr);
+
+					Assert.IsFalse(result);
+					Assert.AreEqual(3, stream.Length);
+					Assert.AreEqual(3, stream.Position);
+				}
+			}
+		}
+
 		//[TestMethod]
 		//public void DeserializeCollection()
 		//{
@@ -0,0 +1,105 @@
+﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using PhysX.Test.Cooking;
+
+namespace PhysX.Test.Stream
+{
+	/// <summary>
+	/// Cooked data is written to managed streams through the native StreamOutputStream, so it is tested via Cooking.
+	/// </summary>
+	[TestClass]
+	public class StreamOutputStreamTest : Test
+	{
+		private class RecordingStream : MemoryStream
+		{
+			public readonly List<int> WriteSizes = new List<int>();
+
+			public override void Write(byte[] buffer, int offset, int count)
+			{
+				WriteSizes.Add(count);
+
+				base.Write(buffer, offset, count);
+			}
+		}
+
+		private class FailingStream : MemoryStream
+		{
+			public int WritesBeforeFailure { get; set; }
+
+			public override void Write(byte[] buffer, int offset, int count)
+			{
+				if (WritesBeforeFailure-- <= 0)
+					throw new InvalidDataException("Disk full");
+
+				base.Write(buffer, offset, count);
+			}
+		}
+
+		[TestMethod]
+		public void OutputIsWrittenInChunks()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var cooking = physics.Physics.CreateCooking())
+			{
+				// Large enough for the cooked mesh to span several 64 KB chunks
+				var grid = new VertexGrid(100, 100);
+
+				var desc = new TriangleMeshDesc()
+				{
+					Points = grid.Points,
+					Triangles = grid.Indices
+				};
+
+				var stream = new RecordingStream();
+
+				Assert.IsTrue(cooking.CookTriangleMesh(desc, stream));
+
+				Assert.IsTrue(stream.WriteSizes.Count > 1);
+				Assert.IsTrue(stream.WriteSizes.All(s => s > 0 && s <= 64 * 1024));
+				Assert.IsTrue(stream.WriteSizes.Take(stream.WriteSizes.Count - 1).All(s => s == 64 * 1024));
+				Assert.AreEqual(stream.Length, stream.WriteSizes.Sum());
+
+				// The same bytes as cooking into a plain stream
+				var expected = new MemoryStream();
+				Assert.IsTrue(cooking.CookTriangleMesh(desc, expected));
+
+				CollectionAssert.AreEqual(expected.ToArray(), stream.ToArray());
+			}
+		}
+
+		[TestMethod]
+		public void StreamExceptionIsRethrown()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var cooking = physics.Physics.CreateCooking())
+			{
+				var grid = new VertexGrid(100, 100);
+
+				var desc = new TriangleMeshDesc()
+				{
+					Points = grid.Points,
+					Triangles = grid.Indices
+				};
+
+				var stream = new FailingStream() { WritesBeforeFailure = 1 };
+
+				try
+				{
+					cooking.CookTriangleMesh(desc, stream);
+
+					Assert.Fail("Expected an IOException");
+				}
+				catch (IOException ex)
+				{
+					Assert.IsInstanceOfType(ex.InnerException, typeof(InvalidDataException));
+				}
+
+				// The chunk written before the failure is rolled back
+				Assert.AreEqual(0, stream.Length);
+			}
+		}
+	}
+}
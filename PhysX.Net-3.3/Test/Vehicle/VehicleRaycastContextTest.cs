@@ -0,0 +1,109 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Numerics;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace PhysX.Test.Vehicle
+{
+	[TestClass]
+	public class VehicleRaycastContextTest : Test
+	{
+		[TestMethod]
+		public void RaycastWithNoVehicles()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var context = new VehicleRaycastContext(physics.Scene, 16, 0xFFFF))
+			{
+				context.Raycast(new VehicleWheels[0]);
+
+				Assert.AreEqual(16, context.MaxNumberOfWheels);
+				Assert.AreEqual(0, context.ResultCount);
+				Assert.AreEqual(0, context.GetResults(new VehicleSuspensionRaycastHit[16], 0));
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void RaycastWithOneVehicleExcluded()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				Assert.IsTrue(physics.Physics.VehicleSDK.Initalize());
+
+				var material = physics.Physics.CreateMaterial(0.8f, 0.8f, 0.1f);
+				VehicleTestUtil.CreateGround(physics.Scene, material);
+
+				var vehicles = new VehicleWheels[]
+				{
+					VehicleTestUtil.CreateVehicle(physics.Scene, material, new Vector3(0, 1.3f, 0)),
+					VehicleTestUtil.CreateVehicle(physics.Scene, material, new Vector3(10, 1.3f, 0))
+				};
+
+				using (var context = new VehicleRaycastContext(physics.Scene, 8, VehicleTestUtil.DrivableSurface))
+				{
+					context.Raycast(vehicles, new[] { false, true });
+
+					Assert.AreEqual(4, context.ResultCount);
+					Assert.IsFalse(context.WasRaycast(0));
+					Assert.IsTrue(context.WasRaycast(1));
+
+					// The second vehicle's results follow the slots reserved for the first vehicle's wheels
+					for (int w = 0; w < 4; w++)
+					{
+						var hit = context.GetResult(1, w);
+
+						Assert.IsTrue(hit.HasBlock);
+						Assert.AreEqual(0, hit.Position.Y, 0.01f);
+						Assert.AreEqual(10, hit.Position.X, 1.1f);
+					}
+
+					var results = new VehicleSuspensionRaycastHit[8];
+
+					Assert.AreEqual(4, context.GetResults(results, 0));
+					Assert.IsTrue(results.Take(4).All(r => r.HasBlock));
+				}
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		[ExpectedException(typeof(ArgumentException))]
+		public void ExcludedVehiclesCountTowardsMaxNumberOfWheels()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				Assert.IsTrue(physics.Physics.VehicleSDK.Initalize());
+
+				var material = physics.Physics.CreateMaterial(0.8f, 0.8f, 0.1f);
+
+				var vehicles = new VehicleWheels[]
+				{
+					VehicleTestUtil.CreateVehicle(physics.Scene, material, new Vector3(0, 1.3f, 0)),
+					VehicleTestUtil.CreateVehicle(physics.Scene, material, new Vector3(10, 1.3f, 0))
+				};
+
+				// PhysX needs a result for every wheel of every vehicle, even those that are skipped
+				using (var context = new VehicleRaycastContext(physics.Scene, 4))
+				{
+					context.Raycast(vehicles, new[] { false, true });
+				}
+			}
+		}
+
+		[TestMethod]
+		public void DisposingSceneDisposesContext()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var context = new VehicleRaycastContext(physics.Scene, 4);
+
+				physics.Scene.Dispose();
+
+				Assert.IsTrue(context.Disposed);
+			}
+		}
+	}
+}
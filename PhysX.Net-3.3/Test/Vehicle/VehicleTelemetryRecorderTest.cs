@@ -0,0 +1,219 @@
+﻿using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Globalization;
+using System.Linq;
+using System.Numerics;
+using System.Text;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace PhysX.Test.Vehicle
+{
+	[TestClass]
+	public class VehicleTelemetryRecorderTest : Test
+	{
+		[TestMethod]
+		public void ColumnNamesMatchRecordSize()
+		{
+			var channels = VehicleTelemetryChannel.ForwardSpeed | VehicleTelemetryChannel.Gear | VehicleTelemetryChannel.LongitudinalSlip | VehicleTelemetryChannel.SuspensionJounce;
+
+			using (var recorder = new VehicleTelemetryRecorder(channels, 16, 2))
+			{
+				var names = recorder.GetColumnNames();
+
+				Assert.AreEqual(2 + 2 + 2 * 2, recorder.RecordSize);
+				Assert.AreEqual(recorder.RecordSize, names.Length);
+
+				CollectionAssert.AreEqual
+				(
+					new[] { "Time", "Vehicle", "ForwardSpeed", "Gear", "LongitudinalSlip0", "SuspensionJounce0", "LongitudinalSlip1", "SuspensionJounce1" },
+					names
+				);
+			}
+		}
+
+		[TestMethod]
+		public void SaveEmptyBinary()
+		{
+			using (var recorder = new VehicleTelemetryRecorder(VehicleTelemetryChannel.VehicleChannels, 8))
+			using (var stream = new MemoryStream())
+			{
+				recorder.SaveBinary(stream);
+
+				stream.Position = 0;
+				var reader = new BinaryReader(stream);
+
+				Assert.AreEqual(VehicleTelemetryRecorder.BinaryMagic, reader.ReadInt32());
+				Assert.AreEqual(VehicleTelemetryRecorder.BinaryVersion, reader.ReadInt32());
+				Assert.AreEqual((int)VehicleTelemetryChannel.VehicleChannels, reader.ReadInt32());
+				Assert.AreEqual(4, reader.ReadInt32());
+				Assert.AreEqual(recorder.RecordSize, reader.ReadInt32());
+				Assert.AreEqual(0, reader.ReadInt32());
+				Assert.AreEqual(stream.Length, stream.Position);
+			}
+		}
+
+		[TestMethod]
+		public void SaveEmptyCsv()
+		{
+			using (var recorder = new VehicleTelemetryRecorder(VehicleTelemetryChannel.ForwardSpeed, 8))
+			using (var stream = new MemoryStream())
+			{
+				recorder.SaveCsv(stream);
+
+				var csv = Encoding.UTF8.GetString(stream.ToArray());
+
+				Assert.AreEqual("Time,Vehicle,ForwardSpeed" + Environment.NewLine, csv);
+			}
+		}
+
+		[TestMethod]
+		public void UpdaterWithTelemetry()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var updater = new VehicleUpdater(physics.Physics, 1, 1))
+			using (var recorder = new VehicleTelemetryRecorder(VehicleTelemetryChannel.ForwardSpeed, 8))
+			{
+				updater.Telemetry = recorder;
+				updater.Update(1 / 60f, new Vector3(0, -9.81f, 0), new VehicleWheels[0]);
+
+				Assert.AreEqual(0, recorder.Count);
+				Assert.AreSame(recorder, updater.Telemetry);
+			}
+		}
+
+		[TestMethod]
+		public void RecordPastCapacity()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var recorder = CreateRecording(physics, 8, 20))
+			{
+				Assert.AreEqual(8, recorder.Count);
+				Assert.AreEqual(20 / 60.0, recorder.Time, 1e-6);
+
+				// The oldest 12 records were overwritten, the remaining ones are in order
+				for (int i = 0; i < recorder.Count; i++)
+				{
+					var record = recorder.GetRecord(i);
+
+					Assert.AreEqual((13 + i) / 60.0, recorder.GetRecordTime(i), 1e-6);
+					Assert.AreEqual((float)recorder.GetRecordTime(i), record[0]);
+					Assert.AreEqual(0, record[1]);
+					Assert.IsFalse(Single.IsNaN(record[2]));
+				}
+			}
+		}
+
+		[TestMethod]
+		public void SaveBinaryAfterWrapping()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var recorder = CreateRecording(physics, 8, 20))
+			using (var stream = new MemoryStream())
+			{
+				recorder.SaveBinary(stream);
+
+				stream.Position = 0;
+				var reader = new BinaryReader(stream);
+
+				Assert.AreEqual(VehicleTelemetryRecorder.BinaryMagic, reader.ReadInt32());
+				Assert.AreEqual(VehicleTelemetryRecorder.BinaryVersion, reader.ReadInt32());
+				Assert.AreEqual((int)recorder.Channels, reader.ReadInt32());
+				Assert.AreEqual(4, reader.ReadInt32());
+				Assert.AreEqual(recorder.RecordSize, reader.ReadInt32());
+				Assert.AreEqual(8, reader.ReadInt32());
+
+				for (int i = 0; i < 8; i++)
+				{
+					var expected = recorder.GetRecord(i);
+
+					Assert.AreEqual(recorder.GetRecordTime(i), reader.ReadDouble());
+
+					for (int j = 1; j < recorder.RecordSize; j++)
+						Assert.AreEqual(expected[j], reader.ReadSingle());
+				}
+
+				Assert.AreEqual(stream.Length, stream.Position);
+			}
+		}
+
+		[TestMethod]
+		public void SaveCsvAfterWrapping()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var recorder = CreateRecording(physics, 8, 20))
+			using (var stream = new MemoryStream())
+			{
+				recorder.SaveCsv(stream);
+
+				var lines = Encoding.UTF8.GetString(stream.ToArray()).Split(new[] { Environment.NewLine }, StringSplitOptions.RemoveEmptyEntries);
+
+				Assert.AreEqual(9, lines.Length);
+				Assert.AreEqual(String.Join(",", recorder.GetColumnNames()), lines[0]);
+
+				for (int i = 0; i < 8; i++)
+				{
+					var fields = lines[i + 1].Split(',');
+					var expected = recorder.GetRecord(i);
+
+					Assert.AreEqual(recorder.RecordSize, fields.Length);
+					Assert.AreEqual(recorder.GetRecordTime(i), Double.Parse(fields[0], CultureInfo.InvariantCulture));
+
+					for (int j = 1; j < recorder.RecordSize; j++)
+						Assert.AreEqual(expected[j], Single.Parse(fields[j], CultureInfo.InvariantCulture));
+				}
+			}
+		}
+
+		[TestMethod]
+		public void DisposedVehicleIsNoLongerRecorded()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var recorder = new VehicleTelemetryRecorder(VehicleTelemetryChannel.ForwardSpeed, 8))
+			{
+				Assert.IsTrue(physics.Physics.VehicleSDK.Initalize());
+
+				var material = physics.Physics.CreateMaterial(0.8f, 0.8f, 0.1f);
+				var vehicle = VehicleTestUtil.CreateVehicle(physics.Scene, material, new Vector3(0, 1.3f, 0));
+
+				Assert.AreEqual(0, recorder.AddVehicle(vehicle));
+				Assert.AreEqual(1, recorder.VehicleCount);
+
+				vehicle.Dispose();
+
+				Assert.AreEqual(0, recorder.VehicleCount);
+			}
+		}
+
+		/// <summary>
+		/// Drives a vehicle for a number of frames, recording it after each update.
+		/// </summary>
+		private static VehicleTelemetryRecorder CreateRecording(PhysicsAndSceneTestUnit physics, int capacity, int frames)
+		{
+			var scene = physics.Scene;
+			scene.Gravity = new Vector3(0, -9.81f, 0);
+
+			Assert.IsTrue(physics.Physics.VehicleSDK.Initalize());
+
+			var material = physics.Physics.CreateMaterial(0.8f, 0.8f, 0.1f);
+			VehicleTestUtil.CreateGround(scene, material);
+
+			var vehicle = VehicleTestUtil.CreateVehicle(scene, material, new Vector3(0, 1.3f, 0));
+			vehicle.Actor.LinearVelocity = new Vector3(0, 0, 10);
+
+			var recorder = new VehicleTelemetryRecorder(VehicleTelemetryChannel.ForwardSpeed | VehicleTelemetryChannel.SuspensionJounce, capacity);
+			recorder.AddVehicle(vehicle);
+
+			using (var raycasts = new VehicleRaycastContext(scene, 4, VehicleTestUtil.DrivableSurface))
+			using (var updater = new VehicleUpdater(physics.Physics, 1, 1))
+			{
+				updater.FrictionPairs.Setup(1, new[] { material }, new[] { 0 });
+				updater.Telemetry = recorder;
+
+				VehicleTestUtil.Simulate(scene, raycasts, updater, new VehicleWheels[] { vehicle }, frames);
+			}
+
+			return recorder;
+		}
+	}
+}
@@ -0,0 +1,143 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Numerics;
+
+namespace PhysX.Test.Vehicle
+{
+	public static class VehicleTestUtil
+	{
+		/// <summary>
+		/// The query filter word 3 bit marking drivable shapes, as used by VehicleRaycastContext.
+		/// </summary>
+		public const int DrivableSurface = 1;
+
+		public const float WheelRadius = 0.5f;
+
+		/// <summary>
+		/// Creates a large box to drive on, with its top face at y = 0.
+		/// </summary>
+		public static RigidStatic CreateGround(Scene scene, Material material)
+		{
+			var ground = scene.Physics.CreateRigidStatic(Matrix4x4.CreateTranslation(0, -1, 0));
+
+			var shape = ground.CreateShape(new BoxGeometry(500, 1, 500), material);
+			shape.QueryFilterData = new FilterData(0, 0, 0, DrivableSurface);
+
+			scene.AddActor(ground);
+
+			return ground;
+		}
+
+		/// <summary>
+		/// Creates a four wheeled car with its chassis center at the given position. The vehicle SDK must be initalized.
+		/// </summary>
+		public static VehicleDrive4W CreateVehicle(Scene scene, Material material, Vector3 position)
+		{
+			const float chassisMass = 1500;
+			const float wheelMass = 20;
+			var chassisHalfExtents = new Vector3(1, 0.5f, 2.5f);
+
+			var wheelCenters = new[]
+			{
+				// Front left, front right, rear left, rear right, driving towards +Z with +Y up
+				new Vector3(-1, -0.8f, 1.5f),
+				new Vector3(1, -0.8f, 1.5f),
+				new Vector3(-1, -0.8f, -1.5f),
+				new Vector3(1, -0.8f, -1.5f)
+			};
+
+			var physics = scene.Physics;
+
+			var actor = physics.CreateRigidDynamic(Matrix4x4.CreateTranslation(position));
+
+			// The wheel shapes come first so they map to wheels 0 to 3. They only exist to be posed by the vehicle.
+			foreach (var center in wheelCenters)
+			{
+				var wheel = actor.CreateShape(new SphereGeometry(WheelRadius), material, Matrix4x4.CreateTranslation(center));
+				wheel.Flags = ShapeFlag.Visualization;
+			}
+
+			actor.CreateShape(new BoxGeometry(chassisHalfExtents), material);
+
+			var size = chassisHalfExtents * 2;
+
+			actor.Mass = chassisMass;
+			actor.MassSpaceInertiaTensor = new Vector3
+			(
+				(size.Y * size.Y + size.Z * size.Z) * chassisMass / 12,
+				(size.X * size.X + size.Z * size.Z) * chassisMass / 12,
+				(size.X * size.X + size.Y * size.Y) * chassisMass / 12
+			);
+			actor.CenterOfMassLocalPose = Matrix4x4.Identity;
+
+			var wheelsData = new VehicleWheelsSimData(4);
+			wheelsData.SetChassisMass(chassisMass);
+
+			// Start from the SDK's defaults and only change what this car needs
+			for (int i = 0; i < 4; i++)
+			{
+				var wheel = wheelsData.GetWheelData(i);
+				wheel.Radius = WheelRadius;
+				wheel.Width = 0.4f;
+				wheel.Mass = wheelMass;
+				wheel.MomentOfInertia = 0.5f * wheelMass * WheelRadius * WheelRadius;
+				wheel.MaxHandBrakeTorque = i < 2 ? 0 : 4000;
+				wheel.MaxSteer = i < 2 ? (float)Math.PI / 3 : 0;
+				wheelsData.SetWheelData(i, wheel);
+
+				var tire = wheelsData.GetTireData(i);
+				tire.Type = 0;
+				wheelsData.SetTireData(i, tire);
+
+				var suspension = wheelsData.GetSuspensionData(i);
+				suspension.MaxCompression = 0.3f;
+				suspension.MaxDroop = 0.1f;
+				suspension.SpringStrength = 35000;
+				suspension.SpringDamperRate = 4500;
+				suspension.SprungMass = chassisMass / 4;
+				wheelsData.SetSuspensionData(i, suspension);
+
+				wheelsData.SetSuspensionTravelDirection(i, new Vector3(0, -1, 0));
+				wheelsData.SetWheelCentreOffset(i, wheelCenters[i]);
+				wheelsData.SetSuspensionForceApplicationPointOffset(i, new Vector3(wheelCenters[i].X, -0.3f, wheelCenters[i].Z));
+				wheelsData.SetTireForceApplicationPointOffset(i, new Vector3(wheelCenters[i].X, -0.3f, wheelCenters[i].Z));
+			}
+
+			var driveData = new VehicleDriveSimData4W();
+
+			var ackermann = driveData.GetAckermannGeometryData();
+			ackermann.AxleSeparation = wheelCenters[0].Z - wheelCenters[2].Z;
+			ackermann.FrontWidth = wheelCenters[1].X - wheelCenters[0].X;
+			ackermann.RearWidth = wheelCenters[3].X - wheelCenters[2].X;
+			driveData.SetAckermannGeometryData(ackermann);
+
+			var vehicle = new VehicleDrive4W(physics, actor, wheelsData, driveData, 0);
+
+			scene.AddActor(actor);
+
+			return vehicle;
+		}
+
+		/// <summary>
+		/// Raycasts and updates the vehicles for a number of 60 Hz frames, simulating the scene after each.
+		/// </summary>
+		public static void Simulate(Scene scene, VehicleRaycastContext raycasts, VehicleUpdater updater, VehicleWheels[] vehicles, int frames, bool parallel = false)
+		{
+			const float timestep = 1 / 60f;
+
+			for (int i = 0; i < frames; i++)
+			{
+				raycasts.Raycast(vehicles);
+
+				if (parallel)
+					updater.UpdateParallel(timestep, scene.Gravity, vehicles, 1);
+				else
+					updater.Update(timestep, scene.Gravity, vehicles);
+
+				scene.Simulate(timestep);
+				scene.FetchResults(true);
+			}
+		}
+	}
+}
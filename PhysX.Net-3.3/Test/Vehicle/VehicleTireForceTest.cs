@@ -0,0 +1,117 @@
+﻿using System;
+using System.Diagnostics;
+using System.Linq;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace PhysX.Test.Vehicle
+{
+	[TestClass]
+	public class VehicleTireForceTest : Test
+	{
+		private static readonly VehicleDefaultTireParameters DefaultParameters = new VehicleDefaultTireParameters()
+		{
+			LateralStiffnessX = 2,
+			LateralStiffnessY = 17.9f,
+			LongitudinalStiffnessPerUnitGravity = 1000,
+			CamberStiffnessPerUnitGravity = 5.73f
+		};
+
+		[TestMethod]
+		public void ZeroSlipGivesZeroForce()
+		{
+			var inputs = new[] { CreateInput(0, 0) };
+			var outputs = new VehicleTireForceOutput[1];
+
+			VehicleTireForce.Evaluate(DefaultParameters, inputs, outputs);
+			Assert.AreEqual(0, outputs[0].TireLongitudinalForceMagnitude);
+			Assert.AreEqual(0, outputs[0].TireLateralForceMagnitude);
+
+			VehicleTireForce.Evaluate(VehiclePacejkaTireParameters.Default, inputs, outputs);
+			Assert.AreEqual(0, outputs[0].TireLongitudinalForceMagnitude);
+			Assert.AreEqual(0, outputs[0].TireLateralForceMagnitude);
+
+			VehicleTireForce.Evaluate(VehicleBrushTireParameters.Default, inputs, outputs);
+			Assert.AreEqual(0, outputs[0].TireLongitudinalForceMagnitude);
+			Assert.AreEqual(0, outputs[0].TireLateralForceMagnitude);
+		}
+
+		[TestMethod]
+		public void ForcesFollowSlipAndStayWithinFriction()
+		{
+			var inputs = new[] { CreateInput(0.1f, 0.1f), CreateInput(1, 0.5f) };
+			var outputs = new VehicleTireForceOutput[2];
+
+			Action check = () =>
+			{
+				foreach (var output in outputs)
+				{
+					// Longitudinal force drives with positive slip, lateral force opposes the slip angle
+					Assert.IsTrue(output.TireLongitudinalForceMagnitude > 0);
+					Assert.IsTrue(output.TireLateralForceMagnitude < 0);
+					Assert.AreEqual(-output.TireLongitudinalForceMagnitude * inputs[0].WheelRadius, output.WheelTorque, 1e-3f);
+
+					float total = (float)Math.Sqrt(output.TireLongitudinalForceMagnitude * output.TireLongitudinalForceMagnitude + output.TireLateralForceMagnitude * output.TireLateralForceMagnitude);
+
+					Assert.IsTrue(total <= inputs[0].TireFriction * inputs[0].TireLoad * 1.001f);
+				}
+			};
+
+			VehicleTireForce.Evaluate(VehiclePacejkaTireParameters.Default, inputs, outputs);
+			check();
+
+			VehicleTireForce.Evaluate(VehicleBrushTireParameters.Default, inputs, outputs);
+			check();
+		}
+
+		/// <summary>
+		/// Tire evaluations per second of each native model, relative to the default model.
+		/// </summary>
+		[TestMethod]
+		public void EvaluationsPerSecond()
+		{
+			const int count = 1000000;
+
+			var random = new Random(1);
+			var inputs = Enumerable.Range(0, count)
+				.Select(i => CreateInput((float)random.NextDouble() - 0.5f, (float)random.NextDouble() - 0.5f))
+				.ToArray();
+			var outputs = new VehicleTireForceOutput[count];
+
+			Func<Action, double> measure = evaluate =>
+			{
+				// Warm up, then time
+				evaluate();
+
+				var sw = Stopwatch.StartNew();
+				evaluate();
+
+				return count / sw.Elapsed.TotalSeconds;
+			};
+
+			double defaultRate = measure(() => VehicleTireForce.Evaluate(DefaultParameters, inputs, outputs));
+			double pacejkaRate = measure(() => VehicleTireForce.Evaluate(VehiclePacejkaTireParameters.Default, inputs, outputs));
+			double brushRate = measure(() => VehicleTireForce.Evaluate(VehicleBrushTireParameters.Default, inputs, outputs));
+
+			Trace.WriteLine(String.Format("Default: {0:N0}/s", defaultRate));
+			Trace.WriteLine(String.Format("Pacejka: {0:N0}/s ({1:P0} of default)", pacejkaRate, pacejkaRate / defaultRate));
+			Trace.WriteLine(String.Format("Brush: {0:N0}/s ({1:P0} of default)", brushRate, brushRate / defaultRate));
+		}
+
+		private static VehicleTireForceInput CreateInput(float longitudinalSlip, float lateralSlip)
+		{
+			return new VehicleTireForceInput()
+			{
+				TireFriction = 1,
+				LongitudinalSlip = longitudinalSlip,
+				LateralSlip = lateralSlip,
+				WheelRadius = 0.5f,
+				ReciprocalWheelRadius = 2,
+				RestTireLoad = 4000,
+				NormalisedTireLoad = 1,
+				TireLoad = 4000,
+				Gravity = 9.81f,
+				ReciprocalGravity = 1 / 9.81f
+			};
+		}
+	}
+}
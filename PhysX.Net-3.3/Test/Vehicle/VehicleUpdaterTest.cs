@@ -0,0 +1,158 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Numerics;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace PhysX.Test.Vehicle
+{
+	[TestClass]
+	public class VehicleUpdaterTest : Test
+	{
+		[TestMethod]
+		public void SetupFrictionPairs()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var updater = new VehicleUpdater(physics.Physics, 2, 2))
+			{
+				var tarmac = physics.Physics.CreateMaterial(0.5f, 0.5f, 0.1f);
+				var grass = physics.Physics.CreateMaterial(0.3f, 0.3f, 0.1f);
+
+				var pairs = updater.FrictionPairs;
+
+				Assert.AreEqual(2, pairs.MaxNumberOfTireTypes);
+				Assert.AreEqual(2, pairs.MaxNumberOfSurfaceTypes);
+
+				pairs.Setup(2, new[] { tarmac, grass }, new[] { 0, 1 });
+				pairs.SetTypePairFriction(1, 0, 0.7f);
+
+				Assert.AreEqual(0.7f, pairs.GetTypePairFriction(1, 0));
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void UpdateWithNoVehicles()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			using (var updater = new VehicleUpdater(physics.Physics, 1, 1))
+			{
+				updater.Update(1 / 60f, new Vector3(0, -9.81f, 0), new VehicleWheels[0]);
+				updater.UpdateParallel(1 / 60f, new Vector3(0, -9.81f, 0), new VehicleWheels[0]);
+
+				Assert.AreEqual(0, updater.VehicleCount);
+			}
+		}
+
+		[TestMethod]
+		public void UpdateVehicle()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var scene = physics.Scene;
+				scene.Gravity = new Vector3(0, -9.81f, 0);
+
+				Assert.IsTrue(physics.Physics.VehicleSDK.Initalize());
+
+				var material = physics.Physics.CreateMaterial(0.8f, 0.8f, 0.1f);
+				VehicleTestUtil.CreateGround(scene, material);
+
+				var vehicle = VehicleTestUtil.CreateVehicle(scene, material, new Vector3(0, 1.3f, 0));
+				vehicle.Actor.LinearVelocity = new Vector3(0, 0, 10);
+
+				using (var raycasts = new VehicleRaycastContext(scene, 4, VehicleTestUtil.DrivableSurface))
+				using (var updater = new VehicleUpdater(physics.Physics, 1, 1))
+				{
+					updater.FrictionPairs.Setup(1, new[] { material }, new[] { 0 });
+
+					VehicleTestUtil.Simulate(scene, raycasts, updater, new VehicleWheels[] { vehicle }, 60);
+
+					Assert.AreEqual(1, updater.VehicleCount);
+					Assert.IsFalse(updater.IsInAir(0));
+
+					var wheels = updater.GetWheelQueryResults(0);
+
+					Assert.AreEqual(4, wheels.Length);
+
+					foreach (var wheel in wheels)
+					{
+						Assert.IsFalse(wheel.IsInAir);
+						Assert.AreEqual(0, wheel.TireContactPoint.Y, 0.01f);
+						Assert.AreEqual(1, wheel.TireContactNormal.Y, 0.01f);
+						Assert.IsTrue(wheel.SuspensionSpringForce > 0);
+					}
+
+					// Resting on its suspension, and rolled forward
+					var position = vehicle.Actor.GlobalPose.Translation;
+
+					Assert.IsTrue(position.Y > 0.8f && position.Y < 1.3f);
+					Assert.IsTrue(position.Z > 1);
+				}
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void UpdateVehiclesInParallel()
+		{
+			using (var physics = CreatePhysicsAndScene())
+			{
+				var scene = physics.Scene;
+				scene.Gravity = new Vector3(0, -9.81f, 0);
+
+				Assert.IsTrue(physics.Physics.VehicleSDK.Initalize());
+
+				var material = physics.Physics.CreateMaterial(0.8f, 0.8f, 0.1f);
+				VehicleTestUtil.CreateGround(scene, material);
+
+				// Three vehicles in chunks of one, so the chunks and their wheel buffers are all exercised
+				var vehicles = Enumerable.Range(0, 3)
+					.Select(i => VehicleTestUtil.CreateVehicle(scene, material, new Vector3(i * 10, 1.3f, 0)))
+					.ToArray<VehicleWheels>();
+
+				using (var raycasts = new VehicleRaycastContext(scene, 12, VehicleTestUtil.DrivableSurface))
+				using (var updater = new VehicleUpdater(physics.Physics, 1, 1))
+				{
+					updater.FrictionPairs.Setup(1, new[] { material }, new[] { 0 });
+
+					VehicleTestUtil.Simulate(scene, raycasts, updater, vehicles, 60, parallel: true);
+
+					Assert.AreEqual(3, updater.VehicleCount);
+
+					for (int i = 0; i < vehicles.Length; i++)
+					{
+						Assert.IsFalse(updater.IsInAir(i));
+
+						var wheels = updater.GetWheelQueryResults(i);
+
+						Assert.AreEqual(4, wheels.Length);
+						Assert.IsTrue(wheels.All(w => w.SuspensionSpringForce > 0));
+
+						var position = vehicles[i].Actor.GlobalPose.Translation;
+
+						Assert.AreEqual(i * 10, position.X, 0.1f);
+						Assert.IsTrue(position.Y > 0.8f && position.Y < 1.3f);
+					}
+				}
+
+				AssertNoPhysXErrors(physics);
+			}
+		}
+
+		[TestMethod]
+		public void DisposingPhysicsDisposesUpdater()
+		{
+			var physics = CreatePhysicsAndScene();
+
+			var updater = new VehicleUpdater(physics.Physics, 1, 1);
+			var pairs = updater.FrictionPairs;
+
+			physics.Dispose();
+
+			Assert.IsTrue(updater.Disposed);
+			Assert.IsTrue(pairs.Disposed);
+		}
+	}
+}